@@ -0,0 +1,84 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#ifndef CORE23_BENCHMARK_H
+#define CORE23_BENCHMARK_H
+
+#include <core/Object.h>
+#include <chrono>
+#include <cstdio>
+
+/**
+ * The helpers shared by the benchmarks of Core23 library. The benchmarks must be
+ * built with the optimizations of Release builds (cmake -DCMAKE_BUILD_TYPE=Release).
+ */
+namespace benchmark {
+
+    using namespace core;
+
+    /**
+     * Keep the given computed value (prevent the compiler to remove the measured code).
+     */
+    inline void consume(glong value) {
+        static glong volatile sink = 0;
+        sink = sink + value;
+    }
+
+    /**
+     * Run the given action (performing the given count of operations) and return the
+     * average duration of one operation in nanoseconds. The action is run once to warm
+     * the caches, then the best time of the given count of runs is kept.
+     */
+    template<class Action>
+    gdouble nanosPerOp(glong operations, Action &&action, gint runs = 3) {
+        action();
+        glong best = -1;
+        for (gint i = 0; i < runs; ++i) {
+            // the Chrono class is not implemented on all systems
+            std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+            action();
+            glong const elapsed = (glong) std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+            if (best < 0 || elapsed < best)
+                best = elapsed;
+        }
+        return (gdouble) best / (gdouble) (operations > 0 ? operations : 1);
+    }
+
+    /**
+     * Print the result of measure with the given name.
+     */
+    inline void report(const char *name, gdouble nanos) {
+        std::printf("%-56s %12.2f ns/op\n", name, nanos);
+        std::fflush(stdout);
+    }
+
+    /**
+     * The xorshift generator of reproducible random bits.
+     */
+    class Random CORE_FINAL {
+    private:
+        native::GENERIC_UINT64 state;
+
+    public:
+        CORE_EXPLICIT Random(glong seed) : state((native::GENERIC_UINT64) seed | 1) {}
+
+        glong nextLong() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return (glong) state;
+        }
+
+        /**
+         * Return a random value in range [0, bound)
+         */
+        gint nextInt(gint bound) {
+            return (gint) ((native::GENERIC_UINT64) nextLong() % (native::GENERIC_UINT64) bound);
+        }
+    };
+
+} // benchmark
+
+#endif //CORE23_BENCHMARK_H
@@ -0,0 +1,87 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "Benchmark.h"
+#include <core/Double.h>
+#include <core/Float.h>
+#include <core/StringBuffer.h>
+#include <core/native/CharArray.h>
+#include <core/native/DoubleArray.h>
+
+using namespace core;
+using namespace native;
+using namespace benchmark;
+
+/**
+ * The throughput of the floating-point formatting (Schubfach): Double::toChars,
+ * Double::toString, StringBuffer::append(gdouble) and Float::toChars, compared
+ * with the "%.17g" formatting of the C library, on 10^6 values of three kinds:
+ * random bits, prices with two decimals (CSV/JSON data) and small integers.
+ */
+gint main() {
+    gint const N = 1000000;
+    Random random = Random(17);
+    DoubleArray bits = DoubleArray(N);
+    DoubleArray prices = DoubleArray(N);
+    DoubleArray integers = DoubleArray(N);
+    for (gint i = 0; i < N; ++i) {
+        gdouble d;
+        do {
+            d = Double::fromLongBits(random.nextLong());
+        } while (Double::isNaN(d) || Double::isInfinite(d));
+        bits[i] = d;
+        prices[i] = random.nextInt(10000000) / 100.0;
+        integers[i] = random.nextInt(100000);
+    }
+    const DoubleArray *const inputs[3] = {&bits, &prices, &integers};
+    const char *const kinds[3] = {"random bits", "prices", "integers"};
+
+    CharArray chars = CharArray(32);
+    char buffer[32];
+    for (gint k = 0; k < 3; ++k) {
+        const DoubleArray &values = *inputs[k];
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "Double::toChars (%s)", kinds[k]);
+        report(name, nanosPerOp(N, [&]() {
+            glong count = 0;
+            for (gint i = 0; i < N; ++i)
+                count += Double::toChars(values[i], chars, 0);
+            consume(count);
+        }));
+
+        std::snprintf(name, sizeof(name), "Double::toString (%s)", kinds[k]);
+        report(name, nanosPerOp(N, [&]() {
+            glong count = 0;
+            for (gint i = 0; i < N; ++i)
+                count += Double::toString(values[i]).length();
+            consume(count);
+        }));
+
+        std::snprintf(name, sizeof(name), "StringBuffer::append(gdouble) (%s)", kinds[k]);
+        report(name, nanosPerOp(N, [&]() {
+            StringBuffer sb = StringBuffer();
+            for (gint i = 0; i < N; ++i)
+                sb.append(values[i]).append(',');
+            consume(sb.length());
+        }));
+
+        std::snprintf(name, sizeof(name), "Float::toChars (%s)", kinds[k]);
+        report(name, nanosPerOp(N, [&]() {
+            glong count = 0;
+            for (gint i = 0; i < N; ++i)
+                count += Float::toChars((gfloat) values[i], chars, 0);
+            consume(count);
+        }));
+
+        std::snprintf(name, sizeof(name), "snprintf(\"%%.17g\") (%s)", kinds[k]);
+        report(name, nanosPerOp(N, [&]() {
+            glong count = 0;
+            for (gint i = 0; i < N; ++i)
+                count += std::snprintf(buffer, sizeof(buffer), "%.17g", values[i]);
+            consume(count);
+        }));
+    }
+    return 0;
+}
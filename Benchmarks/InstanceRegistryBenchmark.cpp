@@ -0,0 +1,64 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "Benchmark.h"
+#include <core/Integer.h>
+#include <core/private/Unsafe.h>
+
+using namespace core;
+using namespace native;
+using namespace benchmark;
+
+/**
+ * The cost of the registry of dynamic instances (Unsafe::storeInstance, loadInstance and
+ * deleteInstance) while the count of live instances grows from 10^3 to 10^6. The cost per
+ * operation must stay flat: the registry is a set of open-addressing tables, not a list.
+ * <ul>
+ * <li> lookup: Unsafe::copyInstance(x, true) of each live instance (one loadInstance)
+ * <li> churn: Unsafe::allocateInstance then Unsafe::destroyInstance of one more instance
+ *      (one storeInstance and one deleteInstance, plus the allocation)
+ * <li> baseline: Unsafe::allocateMemory then Unsafe::freeMemory of one more instance
+ *      (the allocation alone)
+ * </ul>
+ */
+gint main() {
+    gint const CHURN = 1000000;
+    for (gint live = 1000; live <= 1000000; live *= 10) {
+        Integer **const instances = new Integer *[live];
+        for (gint i = 0; i < live; ++i)
+            instances[i] = &Unsafe::allocateInstance<Integer>(i);
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "lookup with %d live instances", live);
+        report(name, nanosPerOp(live, [&]() {
+            glong h = 0;
+            for (gint i = 0; i < live; ++i)
+                h += (glong) &Unsafe::copyInstance(*instances[i], true);
+            consume(h);
+        }));
+
+        std::snprintf(name, sizeof(name), "churn with %d live instances", live);
+        report(name, nanosPerOp(CHURN, [&]() {
+            for (gint i = 0; i < CHURN; ++i) {
+                Integer &instance = Unsafe::allocateInstance<Integer>(i);
+                consume(instance.intValue());
+                Unsafe::destroyInstance(instance);
+            }
+        }));
+
+        std::snprintf(name, sizeof(name), "baseline with %d live instances", live);
+        report(name, nanosPerOp(CHURN, [&]() {
+            for (gint i = 0; i < CHURN; ++i) {
+                glong const address = Unsafe::allocateMemory(sizeof(Integer));
+                consume(address);
+                Unsafe::freeMemory(address);
+            }
+        }));
+
+        for (gint i = 0; i < live; ++i)
+            Unsafe::destroyInstance(*instances[i]);
+        delete[] instances;
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "Benchmark.h"
+#include <core/util/Arrays.h>
+#include <core/native/IntArray.h>
+#include <core/native/DoubleArray.h>
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+using namespace core;
+using namespace native;
+using namespace util;
+using namespace benchmark;
+
+/**
+ * The cost of Arrays::sort (Dual-Pivot Quicksort) on int and double arrays of 10^3 to
+ * 10^7 elements, against std::sort on the same values, for the usual input patterns:
+ * random, sorted, reversed, organ pipe (ascending then descending) and few unique values
+ * (8 distinct values). The largest size can be given as argument (10^8 for example).
+ * Each measure sorts 10^7 elements in total (a copy of the input at each repetition)
+ * and the results are given in nanoseconds per element (the copy included).
+ */
+namespace {
+
+    gint const PATTERNS = 5;
+    const char *const PATTERN_NAMES[PATTERNS] = {"random", "sorted", "reversed", "organ pipe", "few unique"};
+
+    glong generate(Random &random, gint pattern, gint index, gint length) {
+        switch (pattern) {
+            case 0:
+                return random.nextLong();
+            case 1:
+                return index;
+            case 2:
+                return length - index;
+            case 3:
+                return index < length / 2 ? index : length - index;
+            default:
+                return random.nextInt(8);
+        }
+    }
+
+    template<class Array, class T>
+    void measure(const char *type, gint length, gint pattern) {
+        Random random = Random(length + pattern);
+        std::vector<T> values = std::vector<T>((size_t) length);
+        for (gint i = 0; i < length; ++i)
+            values[(size_t) i] = (T) generate(random, pattern, i, length);
+        Array source = Array(length);
+        for (gint i = 0; i < length; ++i)
+            source[i] = values[(size_t) i];
+        gint const repetitions = length < 10000000 ? 10000000 / length : 1;
+        glong const operations = (glong) repetitions * length;
+        char name[80];
+
+        Array array = Array(length);
+        std::snprintf(name, sizeof(name), "Arrays::sort(%s) %9d %s", type, length, PATTERN_NAMES[pattern]);
+        report(name, nanosPerOp(operations, [&]() {
+            for (gint r = 0; r < repetitions; ++r) {
+                array = source;
+                Arrays::sort(array);
+                consume((glong) array[length / 2]);
+            }
+        }, 2));
+
+        std::vector<T> copy = std::vector<T>((size_t) length);
+        std::snprintf(name, sizeof(name), "std::sort(%s) %11d %s", type, length, PATTERN_NAMES[pattern]);
+        report(name, nanosPerOp(operations, [&]() {
+            for (gint r = 0; r < repetitions; ++r) {
+                copy = values;
+                std::sort(copy.begin(), copy.end());
+                consume((glong) copy[(size_t) length / 2]);
+            }
+        }, 2));
+    }
+}
+
+gint main(gint argc, char **argv) {
+    gint const maxLength = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    for (gint length = 1000; length <= maxLength && length > 0; length *= 10) {
+        for (gint pattern = 0; pattern < PATTERNS; ++pattern) {
+            measure<IntArray, gint>("int", length, pattern);
+            measure<DoubleArray, gdouble>("double", length, pattern);
+        }
+    }
+    return 0;
+}
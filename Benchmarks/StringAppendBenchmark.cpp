@@ -0,0 +1,53 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "Benchmark.h"
+#include <core/String.h>
+#include <core/StringBuffer.h>
+#include <core/StringRope.h>
+
+using namespace core;
+using namespace native;
+using namespace benchmark;
+
+/**
+ * The cost of 10^7 small appends (one char, or a string of 8 chars) to a StringBuffer and
+ * to a StringRope, followed by the conversion of the result to String. The cost per append
+ * must not grow with the length of the result: the StringBuffer grows geometrically, and
+ * the StringRope never moves the chars already appended. The results are given in
+ * nanoseconds per append (the final toString included).
+ */
+gint main() {
+    gint const N = 10000000;
+    String const word = "abcdefgh"_S;
+
+    report("StringBuffer::append(gchar) x 10^7", nanosPerOp(N, [&]() {
+        StringBuffer sb = StringBuffer();
+        for (gint i = 0; i < N; ++i)
+            sb.append((gchar) ('a' + (i & 15)));
+        consume(sb.toString().length());
+    }));
+
+    report("StringRope::append(gchar) x 10^7", nanosPerOp(N, [&]() {
+        StringRope rope = StringRope();
+        for (gint i = 0; i < N; ++i)
+            rope.append((gchar) ('a' + (i & 15)));
+        consume(rope.toString().length());
+    }));
+
+    report("StringBuffer::append(String[8]) x 10^7", nanosPerOp(N, [&]() {
+        StringBuffer sb = StringBuffer();
+        for (gint i = 0; i < N; ++i)
+            sb.append(word);
+        consume(sb.toString().length());
+    }));
+
+    report("StringRope::append(String[8]) x 10^7", nanosPerOp(N, [&]() {
+        StringRope rope = StringRope();
+        for (gint i = 0; i < N; ++i)
+            rope.append(word);
+        consume(rope.toString().length());
+    }));
+    return 0;
+}
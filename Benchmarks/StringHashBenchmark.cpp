@@ -0,0 +1,118 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "Benchmark.h"
+#include <core/String.h>
+#include <core/StringBuffer.h>
+#include <core/native/ObjectArray.h>
+#include <cmath>
+
+using namespace core;
+using namespace native;
+using namespace benchmark;
+
+/**
+ * The collision rate and the throughput of String hashes: the polynomial hash code
+ * (String::hash, memoized) and the seeded 64-bit hash (String::hash64) used by the
+ * HashMap for the String keys, over three key sets of 2^17 keys: identifiers with
+ * a numeric suffix, URLs, and keys built on purpose to have the same hash code
+ * (concatenations of "Aa" and "BB").
+ */
+namespace {
+
+    gint const N = 1 << 17;
+
+    /**
+     * The hash of HashMap for the String keys (see HashMap::KeyHash).
+     */
+    gint seededHash(const String &key, glong seed) {
+        glong const h = key.hash64(seed);
+        return (gint) (h ^ (h >> 32));
+    }
+
+    /**
+     * The hash of HashMap for the other keys (see HashMap::KeyHash).
+     */
+    gint spreadHash(const String &key) {
+        gint const h = key.hash();
+        return h ^ (h >> 16);
+    }
+
+    /**
+     * Return the number of keys that fall in a non-empty bucket, when they are
+     * placed in a table of 2N buckets (the table of HashMap after N insertions).
+     */
+    template<class Hash>
+    gint collisions(const ObjectArray &keys, Hash &&hash) {
+        gint const capacity = 2 * N;
+        gbyte *const used = new gbyte[capacity]();
+        gint count = 0;
+        for (gint i = 0; i < N; ++i) {
+            gint const index = hash((const String &) keys[i]) & (capacity - 1);
+            if (used[index])
+                count += 1;
+            used[index] = 1;
+        }
+        delete[] used;
+        return count;
+    }
+}
+
+gint main() {
+    glong const seed = (glong) 0x9E3779B97F4A7C15ULL;
+    ObjectArray identifiers = ObjectArray(N);
+    ObjectArray urls = ObjectArray(N);
+    ObjectArray crafted = ObjectArray(N);
+    for (gint i = 0; i < N; ++i) {
+        identifiers.set(i, "customer_"_S + String::valueOf(i));
+        urls.set(i, "https://www.example.com/catalog/item/"_S + String::valueOf(i * 7919) + "?lang=en"_S);
+        // "Aa" and "BB" have the same hash code, the 17 bits of i select one of them at each position
+        StringBuffer key = StringBuffer();
+        for (gint j = 0; j < 17; ++j)
+            key.append(((i >> j) & 1) != 0 ? "Aa"_S : "BB"_S);
+        crafted.set(i, key.toString());
+    }
+    const ObjectArray *const keySets[3] = {&identifiers, &urls, &crafted};
+    const char *const kinds[3] = {"identifiers", "urls", "crafted collisions"};
+
+    // the expected count for a uniform hash: N - 2N (1 - (1 - 1/2N)^N)
+    std::printf("bucket collisions of %d keys in %d buckets (uniform hash: ~%.0f)\n", N, 2 * N,
+                N - 2.0 * N * (1 - std::exp(-0.5)));
+    for (gint k = 0; k < 3; ++k) {
+        const ObjectArray &keys = *keySets[k];
+        std::printf("    %-20s String::hash %7d    String::hash64 %7d\n", kinds[k],
+                    collisions(keys, [](const String &key) { return spreadHash(key); }),
+                    collisions(keys, [seed](const String &key) { return seededHash(key, seed); }));
+    }
+
+    for (gint k = 0; k < 3; ++k) {
+        const ObjectArray &keys = *keySets[k];
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "String::hash, memoized (%s)", kinds[k]);
+        report(name, nanosPerOp(N, [&]() {
+            glong h = 0;
+            for (gint i = 0; i < N; ++i)
+                h += spreadHash((const String &) keys[i]);
+            consume(h);
+        }));
+
+        std::snprintf(name, sizeof(name), "String::hash64 (%s)", kinds[k]);
+        report(name, nanosPerOp(N, [&]() {
+            glong h = 0;
+            for (gint i = 0; i < N; ++i)
+                h += seededHash((const String &) keys[i], seed);
+            consume(h);
+        }));
+
+        std::snprintf(name, sizeof(name), "String::equals, same keys (%s)", kinds[k]);
+        report(name, nanosPerOp(N, [&]() {
+            glong h = 0;
+            for (gint i = 0; i < N; ++i)
+                h += keys[i].equals(keys[(i + 1) & (N - 1)]) ? 1 : 0;
+            consume(h);
+        }));
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "Benchmark.h"
+#include <core/String.h>
+#include <core/StringBuffer.h>
+
+using namespace core;
+using namespace native;
+using namespace benchmark;
+
+/**
+ * The throughput of the String search kernels (indexOf, lastIndexOf, contains and count)
+ * against the naive scalar loops over the same chars, on texts of 2^20 random lowercase
+ * letters stored with one byte (LATIN1) or two bytes (UTF16) per char. The searched char
+ * and the searched strings are absent from the texts, so that the whole text is scanned.
+ * The results are given in nanoseconds per char of text.
+ */
+namespace {
+
+    gint const N = 1 << 20;
+
+    gint naiveIndexOf(const gchar *text, gint length, gchar ch) {
+        for (gint i = 0; i < length; ++i)
+            if (text[i] == ch)
+                return i;
+        return -1;
+    }
+
+    gint naiveIndexOf(const gchar *text, gint length, const gchar *str, gint count) {
+        for (gint i = 0; i + count <= length; ++i) {
+            gint j = 0;
+            while (j < count && text[i + j] == str[j])
+                j += 1;
+            if (j == count)
+                return i;
+        }
+        return -1;
+    }
+
+    gint naiveCount(const gchar *text, gint length, gchar ch) {
+        gint count = 0;
+        for (gint i = 0; i < length; ++i)
+            count += text[i] == ch ? 1 : 0;
+        return count;
+    }
+}
+
+gint main() {
+    Random random = Random(42);
+    StringBuffer letters = StringBuffer();
+    for (gint i = 0; i < N; ++i)
+        letters.append((gchar) ('a' + random.nextInt(26)));
+    String const latin1 = letters.toString();
+    // one char out of LATIN1 range (at the end) stores the whole text with UTF16
+    letters.set(N - 1, (gchar) 0x3A9);
+    String const utf16 = letters.toString();
+    const String *const texts[2] = {&latin1, &utf16};
+    const char *const coders[2] = {"LATIN1", "UTF16"};
+
+    gchar *const chars = new gchar[N];
+    // the needle is absent from the texts ("#" is not a letter)
+    String const needle = "abcdefgh#"_S;
+    gchar const needleChars[9] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', '#'};
+
+    for (gint k = 0; k < 2; ++k) {
+        const String &text = *texts[k];
+        for (gint i = 0; i < N; ++i)
+            chars[i] = text.charAt(i);
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "String::indexOf(ch) (%s)", coders[k]);
+        report(name, nanosPerOp(N, [&]() { consume(text.indexOf('#')); }, 10));
+        std::snprintf(name, sizeof(name), "naive indexOf(ch) (%s)", coders[k]);
+        report(name, nanosPerOp(N, [&]() { consume(naiveIndexOf(chars, N, '#')); }, 10));
+
+        std::snprintf(name, sizeof(name), "String::lastIndexOf(ch) (%s)", coders[k]);
+        report(name, nanosPerOp(N, [&]() { consume(text.lastIndexOf('#')); }, 10));
+
+        std::snprintf(name, sizeof(name), "String::indexOf(str) (%s)", coders[k]);
+        report(name, nanosPerOp(N, [&]() { consume(text.indexOf(needle)); }, 10));
+        std::snprintf(name, sizeof(name), "String::contains(str) (%s)", coders[k]);
+        report(name, nanosPerOp(N, [&]() { consume(text.contains(needle) ? 1 : 0); }, 10));
+        std::snprintf(name, sizeof(name), "naive indexOf(str) (%s)", coders[k]);
+        report(name, nanosPerOp(N, [&]() { consume(naiveIndexOf(chars, N, needleChars, 9)); }, 10));
+
+        std::snprintf(name, sizeof(name), "String::count(\"e\") (%s)", coders[k]);
+        report(name, nanosPerOp(N, [&]() { consume(text.count("e"_S)); }, 10));
+        std::snprintf(name, sizeof(name), "naive count(ch) (%s)", coders[k]);
+        report(name, nanosPerOp(N, [&]() { consume(naiveCount(chars, N, 'e')); }, 10));
+    }
+    delete[] chars;
+    return 0;
+}
@@ -0,0 +1,27 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "Comparable.h"
+#include <core/ClassCastException.h>
+
+namespace core {
+
+    namespace native {
+
+        void AnyComparable::incomparable(const Object &o1, const Object &o2) {
+            ClassCastException("Could not compare object of type " + o1.classname()
+                               + " with object of type " + o2.classname())
+                    .throws(__trace("core.Comparable"));
+        }
+
+        gint AnyComparable::compare(const Object &o1, const Object &o2) {
+            if (!Class<AnyComparable>::hasInstance(o1))
+                ClassCastException("Could not cast object of type " + o1.classname() + " to core.Comparable")
+                        .throws(__trace("core.Comparable"));
+            return CORE_DYN_CAST(const AnyComparable &, o1).compareToObject(o2);
+        }
+
+    } // native
+
+} // core
@@ -9,6 +9,42 @@
 
 namespace core {
 
+    namespace native {
+
+        /**
+         * The base of all Comparable classes, whatever the type of compared objects.
+         * It gives the natural ordering of objects whose class is known only at runtime
+         * (for example the elements of ObjectArray sorted by Arrays::sort). A class that
+         * implements Comparable for several types has no natural ordering.
+         */
+        class AnyComparable {
+        protected:
+            /**
+             * Compares this object with the specified object for order, with the natural
+             * ordering of the class of this object.
+             *
+             * @throws ClassCastException if the specified object's type prevents it
+             *         from being compared to this object.
+             */
+            virtual gint compareToObject(const Object &other) const = 0;
+
+            /**
+             * Throws ClassCastException, the given objects are not mutually comparable.
+             */
+            static void incomparable(const Object &o1, const Object &o2);
+
+        public:
+            /**
+             * Compares the given objects with the natural ordering of the class of first one.
+             *
+             * @throws ClassCastException if the first object is not Comparable, or if the
+             *         second object's type prevents it from being compared to the first one.
+             */
+            static gint compare(const Object &o1, const Object &o2);
+        };
+
+    } // native
+
     /**
      * This interface imposes a total ordering on the objects of each class that
      * implements it.  This ordering is referred to as the class's <i>natural
@@ -79,7 +115,7 @@ namespace core {
      * @see Comparator
      */
     template<class T>
-    class Comparable {
+    class Comparable : public native::AnyComparable {
     public:
         /**
          * Compares this object with the specified object for order.  Returns a
@@ -116,6 +152,15 @@ namespace core {
          *         from being compared to this object.
          */
         virtual gint compareTo(const T& other) const = 0;
+
+    protected:
+        gint compareToObject(const Object &other) const override {
+            if (!Class<T>::hasInstance(other)) {
+                incomparable(CORE_DYN_CAST(const Object &, *this), other);
+                return 0;
+            }
+            return compareTo(CORE_DYN_CAST(const T &, other));
+        }
     };
 
 } // core
@@ -6,6 +6,7 @@
 #define CORE23_DOUBLE_H
 
 #include <core/Comparable.h>
+#include <core/CharSequence.h>
 
 namespace core {
 
@@ -335,6 +336,29 @@ namespace core {
          */
         static gdouble parseDouble(const String &str);
 
+        /**
+         * Parses the <b style="color: orange;"> CharSequence</b> argument as a <b>double</b>,
+         * beginning at the specified <b> beginIndex</b> and extending to <b> endIndex - 1</b>
+         * (with the format accepted by <b>parseDouble(String)</b>). The chars of String
+         * and StringView are read in place: no substring is created.
+         *
+         * <p>The method does not take steps to guard against the
+         * <b> CharSequence</b> being mutated while parsing.
+         *
+         * @param      csq   the <b> CharSequence</b> containing the <b>double</b>
+         *                  representation to be parsed
+         * @param      beginIndex   the beginning index, inclusive.
+         * @param      endIndex     the ending index, exclusive.
+         * @return     the <b>double</b> represented by the subsequence.
+         * @throws     IndexException  if <b> beginIndex</b> is
+         *             negative, or if <b> beginIndex</b> is greater than
+         *             <b> endIndex</b> or if <b> endIndex</b> is greater than
+         *             <b> csq.length()</b>.
+         * @throws     NumberFormatException  if the subsequence does not
+         *             contain a parsable <b>double</b>.
+         */
+        static gdouble parseDouble(const CharSequence &csq, gint beginIndex, gint endIndex);
+
         /**
          * Returns a <b>Double</b> object holding the
          * <b>double</b> value represented by the argument string
@@ -522,7 +546,7 @@ namespace core {
          * @param d   the value to be tested.
          */
         static CORE_FAST gbool isInfinite(gdouble d) {
-            return (d < MIN_VALUE) || (d > MAX_VALUE);
+            return (d < -MAX_VALUE) || (d > MAX_VALUE);
         }
 
         /**
@@ -537,7 +561,7 @@ namespace core {
          * @param d the <b>double</b> value to be tested
          */
         static CORE_FAST gbool isFinite(gdouble d) {
-            return (d >= MIN_VALUE) && (d <= MAX_VALUE);
+            return (d >= -MAX_VALUE) && (d <= MAX_VALUE);
         }
 
         /**
@@ -730,6 +754,23 @@ namespace core {
          */
         static String toString(gdouble d);
 
+        /**
+         * Write the string representation of the <b>gdouble</b> argument (the
+         * characters of String returned by <b>Double.toString(gdouble)</b>) in the given
+         * array, from the given offset. No String is created: the characters are written
+         * directly in the array (24 characters at most, like <b>-2.2250738585072014E-308</b>).
+         *
+         * @param d
+         *         The <b>gdouble</b> to be converted.
+         * @param dst
+         *         The destination array
+         * @param offset
+         *         The index of first written character
+         * @return the number of written characters
+         * @throws IndexException if the characters exceed the array
+         */
+        static gint toChars(gdouble d, native::CharArray &dst, gint offset);
+
         /**
          * Returns a hexadecimal string representation of the
          * <b>double</b> argument. All characters mentioned below
@@ -7,378 +7,38 @@
 #include <core/Math.h>
 #include <core/AssertionError.h>
 #include <core/private/Unsafe.h>
+#include <core/private/DoubleToDecimal.h>
+#include <core/private/DecimalToDouble.h>
+#include <core/private/StringCoding.h>
+#include <core/util/Preconditions.h>
+#include <core/native/CharArray.h>
+#include <core/IndexException.h>
 
 namespace core {
 
     using namespace native;
+    using namespace util;
 
     gfloat Float::parseFloat(const String &str) {
-        if (str.isEmpty())
-            NumberFormatException("Invalid number format for input \"\".").throws(__trace("core.Float"));
-        gint const len = str.length();
-        gint sign = +1;
-        gint base = 10;
-        gint next = 0;
-        gfloat retVal = 0;
-        gchar ch = str.charAt(0);
-        switch (ch) {
-            case '-':
-                sign = -1;
-            case '+':
-                next += 1;
-                if (next == len)
-                    NumberFormatException("Invalid number format for input \" " + str + "\".")
-                            .throws(__trace("core.Float"));
-                ch = str.charAt(next);
-            default:
-                break;
-        }
-        switch (ch) {
-            case '0':
-                next += 1;
-                if (next == len)
-                    // +0 or -0
-                    return 0.0F * (gfloat) sign;
-                ch = str.charAt(next);
-                if (ch == 'x' || ch == 'X') {
-                    // hex format
-                    next += 1;
-                    base = 16;
-                    if (next == len)
-                        goto throwIllegalFormat;
-                } else if (ch == 'b' || ch == 'B') {
-                    // binary format 0b...
-                    next += 1;
-                    if (next == len)
-                        goto throwIllegalFormat;
-                    // check if is integer
-                    if (str.indexOf('.', next) >= 0)
-                        goto throwIllegalFormat;
-                    base = 2;
-                } else {
-                    // check if is integer
-                    if (str.indexOf('.', next) < 0)
-                        base = 8;
-                }
-                break;
-            case 'i':
-            case 'I':
-                // inf or infinity
-                if (len - next == 3) {
-                    gchar const ch2 = str.charAt(next + 1);
-                    gchar const ch3 = str.charAt(next + 2);
-                    if ((ch2 == 'n' || ch2 == 'N') && (ch3 == 'f' || ch3 == 'F'))
-                        return (gfloat) (sign * Math::INF);
-                } else if (len - next == 8) {
-                    gchar const ch2 = str.charAt(next + 1);
-                    gchar const ch3 = str.charAt(next + 2);
-                    gchar const ch4 = str.charAt(next + 3);
-                    gchar const ch5 = str.charAt(next + 4);
-                    gchar const ch6 = str.charAt(next + 5);
-                    gchar const ch7 = str.charAt(next + 6);
-                    if ((ch2 == 'n' || ch2 == 'N') && (ch3 == 'f' || ch3 == 'F') && (ch4 == 'i' || ch4 == 'I') &&
-                        (ch5 == 'f' || ch5 == 'F') && (ch6 == 'i' || ch6 == 'I') && (ch7 == 'y' || ch7 == 'Y'))
-                        return (gfloat) (sign * Math::INF);
-                }
-                goto throwIllegalFormat;
-            case 'n':
-            case 'N':
-                // NaN
-                if (len - next == 3) {
-                    gchar const ch2 = str.charAt(next + 1);
-                    gchar const ch3 = str.charAt(next + 2);
-                    if ((ch2 == 'a' || ch2 == 'A') && (ch3 == 'n' || ch3 == 'N'))
-                        return (gfloat) (sign * Math::INF);
-                }
-                goto throwIllegalFormat;
-            default:
-                break;
-        }
-        switch (base) {
-            case 2:
-            case 8:
-                // integral formats
-                while (next < len) {
-                    ch = str.charAt(next);
-                    if (ch < '0' || ch > '9')
-                        goto throwIllegalFormat;
-                    gchar const digit = ch - '0';
-                    retVal = retVal * (gfloat) base + (gfloat) digit;
-                    next += 1;
-                }
-                return (gfloat) sign * retVal;
-            case 10:
-                // decimal format
-                while (next < len) {
-                    ch = str.charAt(next);
-                    gchar digit = -1;
-                    if (ch >= '0' && ch <= '9')
-                        digit = ch - '0';
-                    else if (ch == 'e' || ch == 'E' || ch == '.') {
-                        next += 1;
-                        gint decimal = 0;
-                        gint exponent = 0;
-                        gint sign2 = +1;
-                        gint count = 0;
-                        if (ch == '.') {
-                            // decimal part
-                            gint maxCount = 9;
-                            while (next < len) {
-                                ch = str.charAt(next);
-                                if (ch == 'e' || ch == 'E')
-                                    break;
-                                if (ch >= '0' && ch <= '9')
-                                    digit = ch - '0';
-                                else
-                                    goto throwIllegalFormat;
-                                if (maxCount > 0) {
-                                    if (count < maxCount) {
-                                        decimal = decimal * 10 + digit;
-                                        count += 1;
-                                    } else if (count == maxCount) {
-                                        gint tmp = decimal * 10 + digit;
-                                        if (tmp > 0) {
-                                            // overflow
-                                            maxCount += 1;
-                                            decimal = tmp;
-                                            count += 1;
-                                        } else if (digit >= 5 && (tmp = decimal + 1) > decimal) {
-                                            decimal = tmp;
-                                            maxCount = 0;
-                                        }
-                                    }
-                                }
-                                next += 1;
-                            }
-                        }
-                        if (ch == 'e' || ch == 'E') {
-                            // exponent part
-                            next += 1;
-                            if (next == len)
-                                goto throwIllegalFormat;
-                            ch = str.charAt(next);
-                            switch (ch) {
-                                case '-':
-                                    sign2 = -1;
-                                case '+':
-                                    next += 1;
-                                    if (next == len)
-                                        goto throwIllegalFormat;
-                                default:
-                                    break;
-                            }
-                            while (next < len) {
-                                ch = str.charAt(next);
-                                if (ch >= '0' && ch <= '9')
-                                    digit = ch - '0';
-                                else
-                                    goto throwIllegalFormat;
-                                if (exponent <= 999999)
-                                    exponent = exponent * 10 + digit;
-                                next += 1;
-                            }
-                        }
-                        return (gfloat) (sign * (retVal + Math::pow(decimal, -count)) *
-                                         Math::pow(10, sign2 * exponent));
-                    } else
-                        goto throwIllegalFormat;
-                    retVal = retVal * 10 + (gfloat) digit;
-                    next += 1;
-                }
-                return (gfloat) sign * retVal;
-            case 16: {
-                gint bit32 = 0;
-                gint shift = PRECISION - 1;
-                gbool rounded = false;
-                gbool sticky = false;
-                // after 'p'
-                gint decimalBitsLen = 0; // after '.'
-                gint integerBitsLen = 0; // before '.'
-                // hex format
-                while (next < len) {
-                    ch = str.charAt(next);
-                    gchar digit = -1;
-                    if (ch >= '0' && ch <= '9')
-                        digit = ch - '0';
-                    else if (ch >= 'a' && ch <= 'f')
-                        digit = ch - 'a';
-                    else if (ch >= 'A' && ch <= 'F')
-                        digit = ch - 'A';
-                    else if (ch == 'p' || ch == 'P' || ch == '.')
-                        break;
-                    else
-                        goto throwIllegalFormat;
-                    if (shift == 23) {
-                        switch (digit) {
-                            case 1:
-                                bit32 |= (gint) digit << 23;
-                                shift -= 4;
-                                integerBitsLen = 0;
-                                break;
-                            case 2:
-                            case 3:
-                                bit32 |= (gint) digit << 22;
-                                shift -= 5;
-                                integerBitsLen = 1;
-                                break;
-                            case 4:
-                            case 5:
-                            case 6:
-                            case 7:
-                                bit32 |= (gint) digit << 21;
-                                shift -= 6;
-                                integerBitsLen = 2;
-                                break;
-                            default:
-                                bit32 |= (gint) digit << 20;
-                                shift -= 7;
-                                integerBitsLen = 3;
-                                break;
-                        }
-                    } else if (shift >= 0) {
-                        bit32 |= (gint) digit << shift;
-                        shift -= 4;
-                    } else if (shift >= -4) {
-                        switch (shift) {
-                            case -1:
-                                bit32 |= ((gint) digit & 0xE) >> 1;
-                                rounded = (digit & 0x1) != 0;
-                                break;
-                            case -2:
-                                bit32 |= ((gint) digit & 0xC) >> 2;
-                                rounded = (digit & 0x2) != 0;
-                                sticky = (digit & 0x1) != 0;
-                                break;
-                            case -3:
-                                bit32 |= ((gint) digit & 0x8) >> 3;
-                                rounded = (digit & 0x4) != 0;
-                                sticky = (digit & 0x3) != 0;
-                                break;
-                            case -4:
-                                rounded = (digit & 0x8) != 0;
-                                sticky = (digit & 0x7) != 0;
-                                break;
-                        }
-                        shift -= 4;
-                    } else if (!sticky)
-                        sticky |= digit != 0;
-                    decimalBitsLen += 1;
-                    next += 1;
-                }
-                {
-                    gint digit = 0;
-                    next += 1;
-                    gint exponent = 0;
-                    gint sign2 = +1;
-                    if (ch == '.') {
-                        // decimal part
-                        while (next < len) {
-                            ch = str.charAt(next);
-                            if (ch == 'p' || ch == 'P')
-                                break;
-                            if (ch >= '0' && ch <= '9')
-                                digit = ch - '0';
-                            else if (ch >= 'a' && ch <= 'z')
-                                digit = ch - 'a';
-                            else if (ch >= 'A' && ch <= 'Z')
-                                digit = ch - 'A';
-                            else
-                                goto throwIllegalFormat;
-                            if (shift >= 0) {
-                                bit32 |= (gint) digit << shift;
-                                shift -= 4;
-                            } else if (shift >= -4) {
-                                switch (shift) {
-                                    case -1:
-                                        bit32 |= ((gint) digit & 0xE) >> 1;
-                                        rounded = (digit & 0x1) != 0;
-                                        break;
-                                    case -2:
-                                        bit32 |= ((gint) digit & 0xC) >> 2;
-                                        rounded = (digit & 0x2) != 0;
-                                        sticky = (digit & 0x1) != 0;
-                                        break;
-                                    case -3:
-                                        bit32 |= ((gint) digit & 0x8) >> 3;
-                                        rounded = (digit & 0x4) != 0;
-                                        sticky = (digit & 0x3) != 0;
-                                        break;
-                                    case -4:
-                                        rounded = (digit & 0x8) != 0;
-                                        sticky = (digit & 0x7) != 0;
-                                        break;
-                                }
-                                shift -= 4;
-                            } else if (!sticky)
-                                sticky |= digit != 0;
-                            decimalBitsLen += 1;
-                            next += 1;
-                        }
-                    }
-                    if (ch == 'p' || ch == 'P') {
-                        // exponent part
-                        next += 1;
-                        if (next == len)
-                            goto throwIllegalFormat;
-                        ch = str.charAt(next);
-                        switch (ch) {
-                            case '-':
-                                sign2 = -1;
-                            case '+':
-                                next += 1;
-                                if (next == len)
-                                    goto throwIllegalFormat;
-                            default:
-                                break;
-                        }
-                        while (next < len) {
-                            ch = str.charAt(next);
-                            if (ch >= '0' && ch <= '9')
-                                digit = ch - '0';
-                            else
-                                goto throwIllegalFormat;
-                            if (exponent <= 999999)
-                                exponent = exponent * 10 + digit;
-                            next += 1;
-                        }
-                    }
-                    if (bit32 == 0) {
-                        retVal = 0.0F * (gfloat) sign;
-                        return retVal;
-                    } else {
-                        gint eBit32 = sign2 * exponent + integerBitsLen + (decimalBitsLen - 1) * 4;
-                        if (eBit32 > MAX_EXPONENT) {
-                            // overflow
-                            retVal = (gfloat) (sign * Math::INF);
-                            return retVal;
-                        } else if (sign2 * exponent < 0 && (sign2 * exponent) > MIN_EXPONENT) {
-                            // normal
-                            eBit32 += EXPONENT_BIAS;
-                            eBit32 <<= 23;
-                            eBit32 &= EXPONENT_BIT_MASK;
-                        } else if (eBit32 < (MIN_EXPONENT - 23)) {
-                            sticky |= rounded;
-                            rounded = false;
-                            gint const var = 24 - (eBit32 - (MIN_EXPONENT - 23) + 1);
-                            rounded = (bit32 & (1LL << (var - 1))) != 0;
-                            if (var > 1)
-                                sticky = sticky || (bit32 & ~((~0) << (var - 1))) != 0;
-                            bit32 = bit32 >> var;
-                            eBit32 = (gint) (MIN_EXPONENT - 1 + EXPONENT_BIAS) << 23;
-                        }
-                        if (((bit32 & 1) != 0 && rounded && sticky) || (((bit32 & 1) == 0) && rounded))
-                            bit32 += 1;
-                        if (sign < 0)
-                            bit32 |= SIGN_BIT_MASK;
-                        bit32 |= eBit32;
-                        retVal = fromIntBits(bit32);
-                        return retVal;
-                    }
-                }
-            }
+        String::Span const span = str.span();
+        gfloat value = 0;
+        if (!(span.isLatin1() ? DecimalToDouble::parseFloat((glong) span.latin1(), StringCoding::LATIN1, span.length(), value)
+                              : DecimalToDouble::parseFloat((glong) span.utf16(), StringCoding::UTF16, span.length(), value)))
+            NumberFormatException("Invalid number format for input \"" + str + "\".").throws(__trace("core.Float"));
+        return value;
+    }
+
+    gfloat Float::parseFloat(const CharSequence &csq, gint beginIndex, gint endIndex) {
+        try {
+            Preconditions::checkIndexFromRange(beginIndex, endIndex, csq.length());
+        } catch (const Exception &ex) {
+            ex.throws(__trace("core.Float"));
         }
-        throwIllegalFormat:
-        NumberFormatException("Invalid number format for input \" " + str + "\".").throws(__trace("core.Float"));
+        gfloat value = 0;
+        if (!DecimalToDouble::parseFloat(csq, beginIndex, endIndex, value))
+            NumberFormatException("Invalid number format for input \"" + csq.toString().subString(beginIndex, endIndex)
+                                  + "\".").throws(__trace("core.Float"));
+        return value;
     }
 
     Float Float::valueOf(const String &str) {
@@ -398,30 +58,6 @@ namespace core {
     }
 
     namespace {
-        CORE_FAST gint b2dPrecision[] = {
-                0, 0, 0, 0,
-                1, 1, 1,
-                2, 2, 2,
-                3, 3, 3, 3,
-                4, 4, 4,
-                5, 5, 5,
-                6, 6, 6, 6,
-                7,
-        };
-
-        CORE_FAST gint powerOfTeen[] = {
-                1,
-                10,
-                100,
-                1000,
-                10000,
-                100000,
-                1000000,
-                10000000,
-                100000000,
-                1000000000,
-        };
-
         CORE_FAST gchar DIGITS[] = {
                 '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
                 'A', 'B', 'C', 'D', 'E', 'F'
@@ -429,158 +65,22 @@ namespace core {
     }
 
     String Float::toString(gfloat d) {
-        if (isNaN(d))
-            return "NaN";
-        if (isInfinite(d))
-            return d < 0 ? "infinity" : "-infinity";
-        gint bit32 = toIntBits(d);
-        if (bit32 == 0)
-            // bit32 = 0 00000000 00000000000000000000000.
-            return "0.0";
-        if (bit32 == SIGN_BIT_MASK)
-            // bit32 = 1 00000000 00000000000000000000000.
-            return "-0.0";
-        // find the binary precision
-        gint const binaryPrecision = (SIGNIFICAND_WIDTH - Integer::trailingZeros(bit32 & SIGNIFICAND_BIT_MASK));
-        // conversion of binary precision to decimal precision
-        gint decimalPrecision = b2dPrecision[binaryPrecision];
-        if (powerOfTeen[decimalPrecision] < (1 << binaryPrecision))
-            decimalPrecision += 1;
-        gchar digits[sizeof(d) << 3] = {};
-        gint next = 0;
-        if ((bit32 & SIGN_BIT_MASK) != 0) {
-            // negative
-            digits[next++] = '-';
-            bit32 &= ~SIGN_BIT_MASK;
-        }
-        // we leave one character used for rounding
-        gint const placeholder = next;
-        digits[next++] = '0';
-        gfloat uVal = fromIntBits(bit32);
-        gint exponent = 0;
-        gfloat divider = 10; // used to update power of Teen
-        gint updater = 1; // used to update exponent
-        gint digit = {}; // last digit
-        if (uVal < 1) {
-            updater = -1;
-            divider = 0.1;
-        }
-        gfloat const tmp = uVal;
-        while (uVal >= 10 || uVal < 1) {
-            uVal /= divider;
-            exponent += updater;
-        }
-        if (tmp > 1.e+7 || tmp < 1.e-3) {
-            // scientific format (x.y x10^z)
-            digit = (gint) uVal;
-            digits[next++] = DIGITS[digit];
-            digits[next++] = '.';
-            decimalPrecision -= decimalPrecision > 7 ? 2 : 1;
-            do {
-                uVal = (uVal - (gfloat) digit) * 10;
-                digit = (gint) uVal;
-                digits[next++] = DIGITS[digit];
-                decimalPrecision -= 1;
-            } while (decimalPrecision > 0);
-            // round result and remove all trailing zeros
-            uVal = (uVal - (gfloat) digit) * 10;
-            digit = (gint) uVal;
-            if (digit >= 5) {
-                // round value and remove all trailing zeros
-                gbool finished = false;
-                while (!finished && next > 0) {
-                    next -= 1;
-                    if (digits[next] != '.') {
-                        digit = digits[next] - 48;
-                        digits[next] = DIGITS[(digit + 1) % 10];
-                        finished = digit != 9;
-                    }
-                }
-            } else if (digits[next - 1] == '0') {
-                // remove all trailing zeros
-                next -= 1;
-                while (digits[next] == '0')
-                    next -= 1;
-                if (digits[next] == '.')
-                    next -= 1;
-            } else {
-                // no problems found
-                next -= 1;
-            }
-            next += 1;
-            digits[next++] = 'E';
-            digits[next++] = exponent < 0 ? '-' : '+';
-            exponent = Math::abs(exponent);
-            if (exponent >= 1000)
-                digits[next++] = DIGITS[exponent / 1000];
-            if (exponent >= 100)
-                digits[next++] = DIGITS[exponent % 1000 / 100];
-            if (exponent >= 10)
-                digits[next++] = DIGITS[exponent % 100 / 10];
-            digits[next++] = DIGITS[exponent % 10];
-            digits[next] = 0;
-        } else {
-            // decimal format
-            if (tmp < 1) {
-                digits[next++] = '0';
-                digits[next++] = '.';
-                digit = 0;
-                uVal = tmp;
-            } else {
-                digit = (gint) uVal;
-                digits[next++] = DIGITS[digit];
-                decimalPrecision -= 1;
-                while (exponent > 0) {
-                    uVal = (uVal - (gfloat) digit) * 10;
-                    digit = (gint) uVal;
-                    digits[next++] = DIGITS[digit];
-                    exponent -= 1;
-                    decimalPrecision -= 1;
-                }
-                digits[next++] = '.';
-            }
-            do {
-                uVal = (uVal - (gfloat) digit) * 10;
-                digit = (gint) uVal;
-                digits[next++] = DIGITS[digit];
-                decimalPrecision -= 1;
-            } while (decimalPrecision > 0);
-            // round result and remove all trailing zeros
-            uVal = (uVal - (gfloat) digit) * 10;
-            digit = (gint) uVal;
-            if (digit >= 5) {
-                // round value and remove all trailing zeros
-                gbool finished = false;
-                while (!finished && next > 0) {
-                    next -= 1;
-                    if (digits[next] != '.') {
-                        digit = digits[next] - 48;
-                        digits[next] = DIGITS[(digit + 1) % 10];
-                        finished = digit != 9;
-                    }
-                }
-            } else if (digits[next - 1] == '0') {
-                // remove all trailing zeros
-                next -= 1;
-                while (digits[next] == '0')
-                    next -= 1;
-                if (digits[next] == '.')
-                    next -= 1;
-            } else {
-                // no problems found
-                next -= 1;
-            }
-        }
-        gint begin = 0;
-        if (digits[placeholder] == DIGITS[0]) {
-            // the diskSpace that has be leaved in begin has not used
-            if (placeholder > 0) {
-                digits[placeholder] = digits[placeholder - 1];
-                begin = placeholder;
-            } else
-                begin = 1;
+        char chars[DoubleToDecimal::MAX_FLOAT_CHARS];
+        gint const count = DoubleToDecimal::toChars(d, (glong) chars);
+        return String(chars + 0, 0, count);
+    }
+
+    gint Float::toChars(gfloat d, CharArray &dst, gint offset) {
+        gbyte chars[DoubleToDecimal::MAX_FLOAT_CHARS];
+        gint const count = DoubleToDecimal::toChars(d, (glong) chars);
+        try {
+            Preconditions::checkIndexFromSize(offset, count, dst.length());
+            // the storage of array is contiguous
+            StringCoding::copy((glong) chars, StringCoding::LATIN1, 0, (glong) &dst[offset], StringCoding::UTF16, 0, count);
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.Float"));
         }
-        return String(digits + 0, begin, digits[next + 1] != '.' ? next + 1 : next);
+        return count;
     }
 
     String Float::toHexString(gfloat d) {
@@ -6,6 +6,7 @@
 #define CORE23_FLOAT_H
 
 #include <core/Comparable.h>
+#include <core/CharSequence.h>
 
 namespace core {
 
@@ -192,6 +193,29 @@ namespace core {
          */
         static gfloat parseFloat(const String &str);
 
+        /**
+         * Parses the <b style="color: orange;"> CharSequence</b> argument as a <b>float</b>,
+         * beginning at the specified <b> beginIndex</b> and extending to <b> endIndex - 1</b>
+         * (with the format accepted by <b>parseFloat(String)</b>). The chars of String
+         * and StringView are read in place: no substring is created.
+         *
+         * <p>The method does not take steps to guard against the
+         * <b> CharSequence</b> being mutated while parsing.
+         *
+         * @param      csq   the <b> CharSequence</b> containing the <b>float</b>
+         *                  representation to be parsed
+         * @param      beginIndex   the beginning index, inclusive.
+         * @param      endIndex     the ending index, exclusive.
+         * @return     the <b>float</b> represented by the subsequence.
+         * @throws     IndexException  if <b> beginIndex</b> is
+         *             negative, or if <b> beginIndex</b> is greater than
+         *             <b> endIndex</b> or if <b> endIndex</b> is greater than
+         *             <b> csq.length()</b>.
+         * @throws     NumberFormatException  if the subsequence does not
+         *             contain a parsable <b>float</b>.
+         */
+        static gfloat parseFloat(const CharSequence &csq, gint beginIndex, gint endIndex);
+
         /**
          * Returns a <b>Float</b> object holding the <b>float</b> value represented by
          * the argument string <b>str</b>.
@@ -318,7 +342,7 @@ namespace core {
          *          The value to be tested.
          */
         static CORE_FAST gbool isInfinite(gfloat f) {
-            return (f < MIN_VALUE) || (f > MAX_VALUE);
+            return (f < -MAX_VALUE) || (f > MAX_VALUE);
         }
 
         /**
@@ -333,7 +357,7 @@ namespace core {
          *        The value to be tested.
          */
         static CORE_FAST gbool isFinite(gfloat f) {
-            return (f >= MIN_VALUE) && (f <= MAX_VALUE);
+            return (f >= -MAX_VALUE) && (f <= MAX_VALUE);
         }
 
         /**
@@ -495,6 +519,23 @@ namespace core {
          */
         static String toString(gfloat f);
 
+        /**
+         * Write the string representation of the <b>gfloat</b> argument (the
+         * characters of String returned by <b>Float.toString(gfloat)</b>) in the given
+         * array, from the given offset. No String is created: the characters are written
+         * directly in the array (15 characters at most).
+         *
+         * @param f
+         *         The <b>gfloat</b> to be converted.
+         * @param dst
+         *         The destination array
+         * @param offset
+         *         The index of first written character
+         * @return the number of written characters
+         * @throws IndexException if the characters exceed the array
+         */
+        static gint toChars(gfloat f, native::CharArray &dst, gint offset);
+
         /**
          * Returns a hexadecimal string representation of the
          * <b>float</b> argument. All characters mentioned below are
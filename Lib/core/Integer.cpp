@@ -6,53 +6,43 @@
 #include <core/NumberFormatException.h>
 #include <core/private/Unsafe.h>
 #include <core/util/Preconditions.h>
+#include <core/private/IntegerToChars.h>
+#include <core/private/CharsToInteger.h>
+#include <core/private/StringCoding.h>
+#include <core/native/CharArray.h>
+#include <core/native/IntArray.h>
+#include <core/util/OptionalInt.h>
+#include <core/private/Null.h>
+#include <core/IndexException.h>
 
 namespace core {
 
     using namespace native;
     using namespace util;
 
+    namespace {
+
+        /**
+         * Return the message of NumberFormatException thrown for the given input.
+         */
+        String formatError(gint status, const String &input) {
+            return status == CharsToInteger::OUT_OF_RANGE
+                   ? "Value out of range, for input \"" + input + "\"."
+                   : "Illegal number format, for input \"" + input + "\".";
+        }
+    }
+
     gint Integer::parseInt(const String &str, gint base) {
         if (base < 2 || base > 36)
             IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Integer"));
-        gint const length = str.length();
-        if (length == 0)
-            NumberFormatException("Illegal number format, for input \"\".")
-                    .throws(__trace("core.Integer"));
-        gint i = 0;
-        gint signum = 1;
-        gchar ch = str.charAt(i);
-        if (ch < '0') {
-            if (ch == '-') {
-                signum = -1;
-                i += 1;
-            } else if (ch == '+') {
-                i += 1;
-            }
-            if (length == 1)
-                NumberFormatException("Illegal number format, for input \"" + str + "\".")
-                        .throws(__trace("core.Integer"));
-        }
-        glong a = 0; // absolute parsed value
-        while (i < length) {
-            ch = str.charAt(i);
-            gint digit = -1;
-            if ('0' <= ch && ch <= '9')
-                digit = ch - 48;
-            else if ('a' <= ch && ch <= 'z')
-                digit = ch - 97 + 10;
-            else if ('A' <= ch && ch <= 'Z')
-                digit = ch - 65 + 10;
-            if (digit == -1)
-                NumberFormatException("Illegal number format, for input \"" + str + "\".")
-                        .throws(__trace("core.Integer"));
-            a = a * base + digit;
-            i += 1;
-            if (a > MAX_VALUE || a < MIN_VALUE)
-                NumberFormatException("Value out of range, for input \"" + str + "\".")
-                        .throws(__trace("core.Integer"));
-        }
-        return (gint) (signum == -1 ? -a : a);
+        String::Span const span = str.span();
+        gint result = 0;
+        gint const status = span.isLatin1()
+                            ? CharsToInteger::parseInt((glong) span.latin1(), StringCoding::LATIN1, span.length(), base, result)
+                            : CharsToInteger::parseInt((glong) span.utf16(), StringCoding::UTF16, span.length(), base, result);
+        if (status != CharsToInteger::SUCCESS)
+            NumberFormatException(formatError(status, str)).throws(__trace("core.Integer"));
+        return result;
     }
 
     gint Integer::parseInt(const String &str) {
@@ -66,44 +56,23 @@ namespace core {
     gint Integer::parseUnsignedInt(const String &str, gint base) {
         if (base < 2 || base > 36)
             IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Integer"));
-        gint length = str.length();
-        if (length == 0)
-            NumberFormatException("Illegal number format, for input \"\".").throws(__trace("core.Integer"));
-        gint i = 0;
-        gchar ch = str.charAt(i);
-        if (ch < '0') {
-            if (ch == '-')
+        String::Span const span = str.span();
+        gint result = 0;
+        gint const status = span.isLatin1()
+                            ? CharsToInteger::parseUnsignedInt((glong) span.latin1(), StringCoding::LATIN1, span.length(), base, result)
+                            : CharsToInteger::parseUnsignedInt((glong) span.utf16(), StringCoding::UTF16, span.length(), base, result);
+        if (status != CharsToInteger::SUCCESS) {
+            if (span.length() > 0 && str.charAt(0) == '-')
                 NumberFormatException("Illegal leading minus sign, for unsigned input \"" + str + "\".")
                         .throws(__trace("core.Integer"));
+            NumberFormatException(formatError(status, str)).throws(__trace("core.Integer"));
         }
-        if (length < 6 || base == 10 && length < 10) {
-            // MAX_VALUE in base 36 has 6 digits
-            // MAX_VALUE in base 10 has 10 digits
-            gint a;
-            try {
-                a = parseInt(str, base);
-            } catch (const NumberFormatException &nfe) {
-                nfe.throws(__trace("core.Integer"));
-            }
-            return a;
-        } else {
-            glong a;
-            try {
-                a = Long::parseLong(str, base);
-            } catch (const NumberFormatException &nfe) {
-                nfe.throws(__trace("core.Integer"));
-            }
-            if ((a & 0xffffff000000LL) != 0LL)
-                NumberFormatException("Value out of range, for input \"" + str + "\".").throws(
-                        __trace("core.Integer"));
-            return (gint) a;
-        }
+        return result;
     }
 
     gint Integer::parseUnsignedInt(const String &str) {
         try {
-            gint i = parseUnsignedInt(str, 10);
-            return valueOf(i);
+            return parseUnsignedInt(str, 10);
         } catch (const NumberFormatException &nfe) {
             nfe.throws(__trace("core.Integer"));
         }
@@ -197,49 +166,64 @@ namespace core {
     }
 
     String Integer::toString(gint i, gint base) {
-        if (base < 2 || base > 36)
-            base = 10;
-        gchar digits[32 + 1]; // 32 chars max + 1 sign gchar
-        glong a = Math::abs((glong) i);
-        gint j = 32;
-        do {
-            gint r = (gint) (a % base);
-            a = a / base;
-            digits[j--] = (gchar) ((r < 10) ? (48 + r) : (97 + r));
-        } while (a > 0);
-        if (i < 0)
-            digits[j--] = u'-';
-        return String(digits, j + 1, 32 + 1);
+        char digits[IntegerToChars::MAX_CHARS];
+        gint const count = IntegerToChars::toChars(i, base, (glong) digits);
+        return String(digits + 0, 0, count);
     }
 
     String Integer::toUnsignedString(gint i, gint base) {
-        try {
-            if (i < 0)
-                return Long::toString(toUnsignedLong(i), base);
-            return toString(i, base);
-        } catch (const NumberFormatException &nfe) {
-            nfe.throws(__trace("core.Integer"));
-        }
+        char digits[IntegerToChars::MAX_CHARS];
+        gint const count = IntegerToChars::toUnsignedChars(toUnsignedLong(i), base, (glong) digits);
+        return String(digits + 0, 0, count);
     }
 
     String Integer::toUnsignedString(gint i) {
-        try {
-            return toUnsignedString(i, 10);
-        } catch (const NumberFormatException &nfe) {
-            nfe.throws(__trace("core.Integer"));
-        }
+        return toUnsignedString(i, 10);
     }
 
     String Integer::toHexString(gint i) {
-        return toString(i, 16);
+        return toUnsignedString(i, 16);
     }
 
     String Integer::toOctalString(gint i) {
-        return toString(i, 8);
+        return toUnsignedString(i, 8);
     }
 
     String Integer::toBinaryString(gint i) {
-        return toString(i, 2);
+        return toUnsignedString(i, 2);
+    }
+
+    gint Integer::toChars(gint i, CharArray &dst, gint offset) {
+        try {
+            return toChars(i, 10, dst, offset);
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.Integer"));
+        }
+    }
+
+    gint Integer::toChars(gint i, gint base, CharArray &dst, gint offset) {
+        gbyte digits[IntegerToChars::MAX_CHARS];
+        gint const count = IntegerToChars::toChars(i, base, (glong) digits);
+        try {
+            Preconditions::checkIndexFromSize(offset, count, dst.length());
+            // the storage of array is contiguous
+            StringCoding::copy((glong) digits, StringCoding::LATIN1, 0, (glong) &dst[offset], StringCoding::UTF16, 0, count);
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.Integer"));
+        }
+        return count;
+    }
+
+    gint Integer::toUnsignedChars(gint i, gint base, CharArray &dst, gint offset) {
+        gbyte digits[IntegerToChars::MAX_CHARS];
+        gint const count = IntegerToChars::toUnsignedChars(toUnsignedLong(i), base, (glong) digits);
+        try {
+            Preconditions::checkIndexFromSize(offset, count, dst.length());
+            StringCoding::copy((glong) digits, StringCoding::LATIN1, 0, (glong) &dst[offset], StringCoding::UTF16, 0, count);
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.Integer"));
+        }
+        return count;
     }
 
     gint Integer::leadingZeros(gint i) {
@@ -318,68 +302,83 @@ namespace core {
 
 
     gint Integer::parseInt(const CharSequence &s, gint beginIndex, gint endIndex, gint base) {
-        try{
+        try {
             Preconditions::checkIndexFromRange(beginIndex, endIndex, s.length());
         } catch (const Exception &ex) {
             ex.throws(__trace("core.Integer"));
         }
         if (base < 2 || base > 36)
             IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Integer"));
-        gbool negative = false;
-        gint i = beginIndex;
-        gint limit = -Integer::MAX_VALUE;
-
-        if (i < endIndex) {
-            gchar const firstChar = s.charAt(i);
-            if (firstChar < '0') { // Possible leading "+" or "-"
-                if (firstChar == '-') {
-                    negative = true;
-                    limit = Integer::MIN_VALUE;
-                } else if (firstChar != '+') {
-                    NumberFormatException("Error at index "_S
-                                          + String::valueOf(i - beginIndex) + " in: \""
-                                          + s.subSequence(beginIndex, endIndex).toString() + "\"")
-                            .throws(__trace("core.Integer"));
-                }
-                i++;
-                if (i == endIndex) { // Cannot have lone "+" or "-"
-                    NumberFormatException("Error at index "_S
-                                          + String::valueOf(i - beginIndex) + " in: \""
-                                          + s.subSequence(beginIndex, endIndex).toString() + "\"")
-                            .throws(__trace("core.Integer"));
-                }
-            }
-            gint const multmin = limit / base;
-            gint result = 0;
-            while (i < endIndex) {
-                // Accumulating negatively avoids surprises near MAX_VALUE
-                gchar const ch = s.charAt(i);
-                gint digit = '0' <= ch && ch <= '9' ? ch - '0' :
-                        'a' <= ch && ch <= 'z' ? ch - 'a':
-                        'A' <= ch && ch <= 'Z' ? ch - 'A': -1;
-                if(digit >= base)
-                    digit = -1;
-                if (digit < 0 || result < multmin) {
-                    NumberFormatException("Error at index "_S
-                                          + String::valueOf(i - beginIndex) + " in: \""
-                                          + s.subSequence(beginIndex, endIndex).toString() + "\"")
-                                          .throws(__trace("core.Integer"));
-                }
-                result *= base;
-                if (result < limit + digit) {
-                    NumberFormatException("Error at index "_S
-                                          + String::valueOf(i - beginIndex) + " in: \""
-                                          + s.subSequence(beginIndex, endIndex).toString() + "\"")
-                            .throws(__trace("core.Integer"));
-                }
-                i++;
-                result -= digit;
-            }
-            return negative ? result : -result;
-        } else {
-            NumberFormatException("For input string: \"" + s.toString() + "\"" +
-                                  (base == 10 ? "" : " under radix " + String::valueOf(base)))
-                                  .throws(__trace("core.Integer"));
+        gint result = 0;
+        gint const status = CharsToInteger::parseInt(s, beginIndex, endIndex, base, result);
+        if (status != CharsToInteger::SUCCESS)
+            NumberFormatException(formatError(status, s.subSequence(beginIndex, endIndex).toString()))
+                    .throws(__trace("core.Integer"));
+        return result;
+    }
+
+    gint Integer::parseUnsignedInt(const CharSequence &s, gint beginIndex, gint endIndex, gint base) {
+        try {
+            Preconditions::checkIndexFromRange(beginIndex, endIndex, s.length());
+        } catch (const Exception &ex) {
+            ex.throws(__trace("core.Integer"));
+        }
+        if (base < 2 || base > 36)
+            IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Integer"));
+        gint result = 0;
+        gint const status = CharsToInteger::parseUnsignedInt(s, beginIndex, endIndex, base, result);
+        if (status != CharsToInteger::SUCCESS)
+            NumberFormatException(formatError(status, s.subSequence(beginIndex, endIndex).toString()))
+                    .throws(__trace("core.Integer"));
+        return result;
+    }
+
+    OptionalInt Integer::tryParse(const CharSequence &s) {
+        gint result = 0;
+        if (CharsToInteger::parseInt(s, 0, s.length(), 10, result) != CharsToInteger::SUCCESS)
+            return {};
+        return OptionalInt(result);
+    }
+
+    OptionalInt Integer::tryParse(const CharSequence &s, gint base) {
+        if (base < 2 || base > 36)
+            IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Integer"));
+        gint result = 0;
+        if (CharsToInteger::parseInt(s, 0, s.length(), base, result) != CharsToInteger::SUCCESS)
+            return {};
+        return OptionalInt(result);
+    }
+
+    OptionalInt Integer::tryParse(const CharSequence &s, gint beginIndex, gint endIndex, gint base) {
+        try {
+            Preconditions::checkIndexFromRange(beginIndex, endIndex, s.length());
+        } catch (const Exception &ex) {
+            ex.throws(__trace("core.Integer"));
         }
+        if (base < 2 || base > 36)
+            IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Integer"));
+        gint result = 0;
+        if (CharsToInteger::parseInt(s, beginIndex, endIndex, base, result) != CharsToInteger::SUCCESS)
+            return {};
+        return OptionalInt(result);
+    }
+
+    gint Integer::parseInts(const CharSequence &s, gchar delimiter, IntArray &dst) {
+        gint const capacity = dst.length();
+        gint count = 0;
+        gint index = 0;
+        gint const status = CharsToInteger::parseInts(s, delimiter, capacity == 0 ? (gint *) null : &dst[0], capacity,
+                                                      count, index);
+        if (status != CharsToInteger::SUCCESS) {
+            gint end = index;
+            while (end < s.length() && s.charAt(end) != delimiter)
+                end += 1;
+            NumberFormatException(formatError(status, s.subSequence(index, end).toString()))
+                    .throws(__trace("core.Integer"));
+        }
+        if (index < s.length())
+            IndexException("Too many values (more than " + String::valueOf(capacity) + ") in sequence.")
+                    .throws(__trace("core.Integer"));
+        return count;
     }
 } // core
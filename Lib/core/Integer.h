@@ -212,6 +212,101 @@ namespace core {
          */
         static gint parseUnsignedInt(const String &str);
 
+        /**
+         * Parses the <b style="color: orange;"> CharSequence</b> argument as an unsigned <b> int</b> in
+         * the specified <b> base</b>, beginning at the specified <b> beginIndex</b>
+         * and extending to <b> endIndex - 1</b>.
+         *
+         * @param      s   the <b> CharSequence</b> containing the unsigned <b> int</b>
+         *                  representation to be parsed
+         * @param      beginIndex   the beginning index, inclusive.
+         * @param      endIndex     the ending index, exclusive.
+         * @param      base   the base to be used while parsing <b> s</b>.
+         * @return     the unsigned <b> int</b> represented by the subsequence in
+         *             the specified base.
+         * @throws     IndexException  if the range [beginIndex, endIndex) is out of
+         *             bounds of <b> s</b>.
+         * @throws     NumberFormatException  if the <b> CharSequence</b> does not
+         *             contain a parsable unsigned <b> int</b> in the specified
+         *             <b> base</b>.
+         */
+        static gint parseUnsignedInt(const CharSequence &s, gint beginIndex, gint endIndex, gint base);
+
+        /**
+         * Parses the <b style="color: orange;"> CharSequence</b> argument as a signed decimal
+         * <b> int</b>, as <b style="color: orange;"> parseInt(String)</b>, but without
+         * exception: the result is empty if the sequence does not contain a parsable
+         * <b> int</b>.
+         *
+         * <p>Use this method when invalid inputs are expected (a user input, a field of
+         * a file, ...): no exception is created for them.
+         *
+         * @param s
+         *        The sequence containing the <b> int</b> representation to be parsed
+         * @return the parsed value, or an empty optional
+         */
+        static util::OptionalInt tryParse(const CharSequence &s);
+
+        /**
+         * Parses the <b style="color: orange;"> CharSequence</b> argument as a signed <b> int</b>
+         * in the specified base, as <b style="color: orange;"> parseInt(String, gint)</b>,
+         * but without exception: the result is empty if the sequence does not contain a
+         * parsable <b> int</b>.
+         *
+         * @param s
+         *        The sequence containing the <b> int</b> representation to be parsed
+         * @param base
+         *        The base to be used while parsing <b> s</b>
+         * @return the parsed value, or an empty optional
+         * @throws IllegalArgumentException if the base is either smaller than 2 or
+         *         larger than 36
+         */
+        static util::OptionalInt tryParse(const CharSequence &s, gint base);
+
+        /**
+         * Parses the <b style="color: orange;"> CharSequence</b> argument as a signed <b> int</b>
+         * in the specified base, beginning at the specified <b> beginIndex</b> and extending
+         * to <b> endIndex - 1</b>, but without exception: the result is empty if the
+         * subsequence does not contain a parsable <b> int</b>.
+         *
+         * @param s
+         *        The sequence containing the <b> int</b> representation to be parsed
+         * @param beginIndex
+         *        The beginning index, inclusive.
+         * @param endIndex
+         *        The ending index, exclusive.
+         * @param base
+         *        The base to be used while parsing <b> s</b>
+         * @return the parsed value, or an empty optional
+         * @throws IndexException if the range [beginIndex, endIndex) is out of bounds
+         *         of <b> s</b>
+         * @throws IllegalArgumentException if the base is either smaller than 2 or
+         *         larger than 36
+         */
+        static util::OptionalInt tryParse(const CharSequence &s, gint beginIndex, gint endIndex, gint base);
+
+        /**
+         * Parses the signed decimal <b> int</b> values of the given sequence separated by
+         * the given delimiter (like "12,-7,42" with delimiter ','), and stores them in the
+         * given array, from index 0. The empty sequence contains no value.
+         *
+         * <p>The chars of String and StringView are read directly from their storage, and
+         * no String is created for the values.
+         *
+         * @param s
+         *        The sequence containing the delimited values
+         * @param delimiter
+         *        The char separating the values
+         * @param dst
+         *        The array receiving the values
+         * @return the number of parsed values
+         * @throws NumberFormatException if one of values is not a parsable <b> int</b>
+         *         (the values that precede it are stored)
+         * @throws IndexException if the sequence contains more values than
+         *         <b> dst.length()</b>
+         */
+        static gint parseInts(const CharSequence &s, gchar delimiter, native::IntArray &dst);
+
         /**
          * Returns a Integer object holding the value extracted from the specified
          * String when parsed with the base given by the second argument. The
@@ -522,6 +617,60 @@ namespace core {
          */
         static String toBinaryString(gint i);
 
+        /**
+         * Write the decimal representation of the <b>int</b> argument (the characters
+         * of String returned by <b>Integer.toString(gint)</b>) in the given array, from
+         * the given offset. No String is created: the characters are written directly
+         * in the array.
+         *
+         * @param i
+         *         The <b>int</b> to be converted.
+         * @param dst
+         *         The destination array
+         * @param offset
+         *         The index of first written character
+         * @return the number of written characters
+         * @throws IndexException if the characters exceed the array
+         */
+        static gint toChars(gint i, native::CharArray &dst, gint offset);
+
+        /**
+         * Write the representation of the <b>int</b> argument in the given base (the
+         * characters of String returned by <b>Integer.toString(gint, gint)</b>) in the
+         * given array, from the given offset. The digits of the bases 2, 8 and 16 are
+         * computed with shifts and masks.
+         *
+         * @param i
+         *         The <b>int</b> to be converted.
+         * @param base
+         *         The base to use in the representation
+         * @param dst
+         *         The destination array
+         * @param offset
+         *         The index of first written character
+         * @return the number of written characters
+         * @throws IndexException if the characters exceed the array
+         */
+        static gint toChars(gint i, gint base, native::CharArray &dst, gint offset);
+
+        /**
+         * Write the unsigned representation of the <b>int</b> argument in the given base
+         * (the characters of String returned by <b>Integer.toUnsignedString(gint, gint)</b>)
+         * in the given array, from the given offset.
+         *
+         * @param i
+         *         The <b>int</b> to be converted.
+         * @param base
+         *         The base to use in the representation
+         * @param dst
+         *         The destination array
+         * @param offset
+         *         The index of first written character
+         * @return the number of written characters
+         * @throws IndexException if the characters exceed the array
+         */
+        static gint toUnsignedChars(gint i, gint base, native::CharArray &dst, gint offset);
+
         /**
          * Return the hash code of this Integer's value
          */
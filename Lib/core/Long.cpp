@@ -5,51 +5,44 @@
 #include "Long.h"
 #include <core/NumberFormatException.h>
 #include <core/private/Unsafe.h>
+#include <core/private/IntegerToChars.h>
+#include <core/private/CharsToInteger.h>
+#include <core/private/StringCoding.h>
+#include <core/util/Preconditions.h>
+#include <core/native/CharArray.h>
+#include <core/native/LongArray.h>
+#include <core/util/OptionalLong.h>
+#include <core/private/Null.h>
+#include <core/IndexException.h>
 
 namespace core {
 
     using namespace native;
+    using namespace util;
+
+    namespace {
+
+        /**
+         * Return the message of NumberFormatException thrown for the given input.
+         */
+        String formatError(gint status, const String &input) {
+            return status == CharsToInteger::OUT_OF_RANGE
+                   ? "Value out of range, for input \"" + input + "\"."
+                   : "Illegal number format, for input \"" + input + "\".";
+        }
+    }
 
     glong Long::parseLong(const String &str, gint base) {
         if (base < 2 || base > 36)
             IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Long"));
-        glong const length = str.length();
-        if (length == 0)
-            NumberFormatException("Illegal number format, for input \"\".").throws(__trace("core.Long"));
-        gint i = 0;
-        gint signum = 1;
-        gchar ch = str.charAt(i);
-        if (ch < '0') {
-            if (ch == '-') {
-                signum = -1;
-                i += 1;
-            } else if (ch == '+') {
-                i += 1;
-            }
-            if (length == 1)
-                NumberFormatException("Illegal number format, for input \"" + str + "\".").throws(__trace("core.Long"));
-        }
-        glong a = 0; // absolute parsed value
-        while (i < length) {
-            ch = str.charAt(i);
-            glong digit = -1;
-            if ('0' <= ch && ch <= '9')
-                digit = ch - 48;
-            else if ('a' <= ch && ch <= 'z')
-                digit = ch - 97 + 10;
-            else if ('A' <= ch && ch <= 'Z')
-                digit = ch - 65 + 10;
-            if (digit == -1)
-                NumberFormatException("Illegal number format, for input \"" + str + "\".").throws(__trace("core.Long"));
-            a = a * base + digit;
-            i += 1;
-            if (((a < 0) && (a > MIN_VALUE) && (signum == -1)) || ((signum == 1) && (a < 0))) {
-                // signum = -1, max = MIN_VALUE
-                // signum = +1, max = MAX_VALUE
-                NumberFormatException("Value out of range, for input \"" + str + "\".").throws(__trace("core.Long"));
-            }
-        }
-        return (glong) (signum == -1 && a != MIN_VALUE ? -a : a);
+        String::Span const span = str.span();
+        glong result = 0;
+        gint const status = span.isLatin1()
+                            ? CharsToInteger::parseLong((glong) span.latin1(), StringCoding::LATIN1, span.length(), base, result)
+                            : CharsToInteger::parseLong((glong) span.utf16(), StringCoding::UTF16, span.length(), base, result);
+        if (status != CharsToInteger::SUCCESS)
+            NumberFormatException(formatError(status, str)).throws(__trace("core.Long"));
+        return result;
     }
 
     glong Long::parseLong(const String &str) {
@@ -63,132 +56,109 @@ namespace core {
     glong Long::parseUnsignedLong(const String &str, gint base) {
         if (base < 2 || base > 36)
             IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Long"));
-        glong const length = str.length();
-        if (length == 0)
-            NumberFormatException("Illegal number format, for input \"\".").throws(__trace("core.Long"));
-        gint i = 0;
-        gchar ch = str.charAt(i);
-        if (ch < '0') {
-            if (ch == '-')
-                NumberFormatException("Illegal leading minus sign, "
-                                      "for unsigned input \"" + str + "\".").throws(__trace("core.Long"));
-            else if (ch == '+') {
-                i += 1;
-            }
-            if (length == 1)
-                NumberFormatException("Illegal number format, for input \"" + str + "\".").throws(__trace("core.Long"));
-        }
-        if (length < 13 || base == 10 && length < 19) {
-            // MAX_VALUE in base 36 has 13 digits
-            // MAX_VALUE in base 10 has 19 digits
-            glong a = 0;
-            try {
-                a = parseLong(str, base);
-            } catch (const NumberFormatException &nfe) {
-                nfe.throws(__trace("core.Long"));
-            }
-            return a;
-        } else {
-            glong a = 0; // high part
-            // check the high part
-            while (i < length) {
-                ch = str.charAt(i);
-                glong digit = -1;
-                if ('0' <= ch && ch <= '9')
-                    digit = ch - 48;
-                else if ('a' <= ch && ch <= 'z')
-                    digit = ch - 97 + 10;
-                else if ('A' <= ch && ch <= 'Z')
-                    digit = ch - 65 + 10;
-                if (digit == -1)
-                    NumberFormatException("Illegal number format, for input \"" + str + "\".").throws(
-                            __trace("core.Long"));
-                glong const t = a * base + digit;
-                if (t < 0)
-                    // overflow
-                    break;
-                a = t;
-                i += 1;
-            }
-            glong b = 0; // low part
-            // check the low part
-            {
-                ch = str.charAt(i);
-                glong digit = -1;
-                if ('0' <= ch && ch <= '9')
-                    digit = ch - 48;
-                else if ('a' <= ch && ch <= 'z')
-                    digit = ch - 97 + 10;
-                else if ('A' <= ch && ch <= 'Z')
-                    digit = ch - 65 + 10;
-                if (digit == -1)
-                    NumberFormatException("Illegal number format, for input \"" + str + "\".").throws(
-                            __trace("core.Long"));
-                b = digit;
-                i += 1;
-            }
-            glong const res = a * base + b;
-            gint const guard = base * (gint) (a >> 57);
-            if (guard >= 128 || res >= 0 && guard >= 92) {
-                /*
-                 * For purposes of exposition, the programmatic statements
-                 * below should be taken to be multi-precision, i.e., not
-                 * subject to overflow.
-                 *
-                 * A) Condition guard >= 128:
-                 * If guard >= 128 then a*base >= 2^7 * 2^57 = 2^64 hence always overflow.
-                 *
-                 * B) Condition guard < 92:
-                 * Define left7 = a >> 57.
-                 * Given a = (left7 * 2^57) + (a & (2^57 - 1)) then
-                 * result <= (base*left7)*2^57 + base*(2^57 - 1) + b.
-                 * Thus, if base*left7 < 92, base <= 36, and b < 36,
-                 * then result < 92*2^57 + 36*(2^57 - 1) + 36 = 2^64 hence never overflow.
-                 *
-                 * C) Condition 92 <= guard < 128:
-                 * a*base + b >= base*left7*2^57 + b so that a*base + b >= 92*2^57 + 0 > 2^63
-                 *
-                 * D) Condition guard < 128:
-                 * base*a <= (base*left7) * 2^57 + base*(2^57 - 1) so
-                 * base*a + b <= (base*left7) * 2^57 + base*(2^57 - 1) + 36 thus
-                 * base*a + b < 128 * 2^57 + 36*2^57 - base + 36 whence
-                 * base*a + b < 2^64 + 2^6*2^57 = 2^64 + 2^63
-                 *
-                 * E) Conditions C, D, and result >= 0:
-                 * C and D combined imply the mathematical result 2^63 < a*base + b < 2^64 + 2^63. The lower
-                 * bound is therefore negative as a signed glong, but the upper bound is too small to overflow again after the
-                 * signed glong overflows to positive above 2^64 - 1. Hence, result >= 0 implies overflow given C and D.
-                 */
-                NumberFormatException("Value out of range, for input \"" + str + "\".").throws(__trace("core.Long"));
-            }
-            // check if all other characters are valid
-            while (i < length) {
-                ch = str.charAt(i);
-                glong digit = -1;
-                if ('0' <= ch && ch <= '9')
-                    digit = ch - 48;
-                else if ('a' <= ch && ch <= 'z')
-                    digit = ch - 97 + 10;
-                else if ('A' <= ch && ch <= 'Z')
-                    digit = ch - 65 + 10;
-                if (digit == -1)
-                    NumberFormatException("Illegal number format, for input \"" + str + "\".").throws(
-                            __trace("core.Long"));
-                i += 1;
-            }
-            return res;
+        String::Span const span = str.span();
+        glong result = 0;
+        gint const status = span.isLatin1()
+                            ? CharsToInteger::parseUnsignedLong((glong) span.latin1(), StringCoding::LATIN1, span.length(), base, result)
+                            : CharsToInteger::parseUnsignedLong((glong) span.utf16(), StringCoding::UTF16, span.length(), base, result);
+        if (status != CharsToInteger::SUCCESS) {
+            if (span.length() > 0 && str.charAt(0) == '-')
+                NumberFormatException("Illegal leading minus sign, for unsigned input \"" + str + "\".")
+                        .throws(__trace("core.Long"));
+            NumberFormatException(formatError(status, str)).throws(__trace("core.Long"));
         }
+        return result;
     }
 
     glong Long::parseUnsignedLong(const String &str) {
         try {
-            glong const i = parseUnsignedLong(str, 10);
-            return i;
+            return parseUnsignedLong(str, 10);
         } catch (const NumberFormatException &nfe) {
             nfe.throws(__trace("core.Long"));
         }
     }
 
+    glong Long::parseLong(const CharSequence &s, gint beginIndex, gint endIndex, gint base) {
+        try {
+            Preconditions::checkIndexFromRange(beginIndex, endIndex, s.length());
+        } catch (const Exception &ex) {
+            ex.throws(__trace("core.Long"));
+        }
+        if (base < 2 || base > 36)
+            IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Long"));
+        glong result = 0;
+        gint const status = CharsToInteger::parseLong(s, beginIndex, endIndex, base, result);
+        if (status != CharsToInteger::SUCCESS)
+            NumberFormatException(formatError(status, s.subSequence(beginIndex, endIndex).toString()))
+                    .throws(__trace("core.Long"));
+        return result;
+    }
+
+    glong Long::parseUnsignedLong(const CharSequence &s, gint beginIndex, gint endIndex, gint base) {
+        try {
+            Preconditions::checkIndexFromRange(beginIndex, endIndex, s.length());
+        } catch (const Exception &ex) {
+            ex.throws(__trace("core.Long"));
+        }
+        if (base < 2 || base > 36)
+            IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Long"));
+        glong result = 0;
+        gint const status = CharsToInteger::parseUnsignedLong(s, beginIndex, endIndex, base, result);
+        if (status != CharsToInteger::SUCCESS)
+            NumberFormatException(formatError(status, s.subSequence(beginIndex, endIndex).toString()))
+                    .throws(__trace("core.Long"));
+        return result;
+    }
+
+    OptionalLong Long::tryParse(const CharSequence &s) {
+        glong result = 0;
+        if (CharsToInteger::parseLong(s, 0, s.length(), 10, result) != CharsToInteger::SUCCESS)
+            return {};
+        return OptionalLong(result);
+    }
+
+    OptionalLong Long::tryParse(const CharSequence &s, gint base) {
+        if (base < 2 || base > 36)
+            IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Long"));
+        glong result = 0;
+        if (CharsToInteger::parseLong(s, 0, s.length(), base, result) != CharsToInteger::SUCCESS)
+            return {};
+        return OptionalLong(result);
+    }
+
+    OptionalLong Long::tryParse(const CharSequence &s, gint beginIndex, gint endIndex, gint base) {
+        try {
+            Preconditions::checkIndexFromRange(beginIndex, endIndex, s.length());
+        } catch (const Exception &ex) {
+            ex.throws(__trace("core.Long"));
+        }
+        if (base < 2 || base > 36)
+            IllegalArgumentException("Unsupported conversion base.").throws(__trace("core.Long"));
+        glong result = 0;
+        if (CharsToInteger::parseLong(s, beginIndex, endIndex, base, result) != CharsToInteger::SUCCESS)
+            return {};
+        return OptionalLong(result);
+    }
+
+    gint Long::parseLongs(const CharSequence &s, gchar delimiter, LongArray &dst) {
+        gint const capacity = dst.length();
+        gint count = 0;
+        gint index = 0;
+        gint const status = CharsToInteger::parseLongs(s, delimiter, capacity == 0 ? (glong *) null : &dst[0],
+                                                       capacity, count, index);
+        if (status != CharsToInteger::SUCCESS) {
+            gint end = index;
+            while (end < s.length() && s.charAt(end) != delimiter)
+                end += 1;
+            NumberFormatException(formatError(status, s.subSequence(index, end).toString()))
+                    .throws(__trace("core.Long"));
+        }
+        if (index < s.length())
+            IndexException("Too many values (more than " + String::valueOf(capacity) + ") in sequence.")
+                    .throws(__trace("core.Long"));
+        return count;
+    }
+
     Long Long::valueOf(const String &str, gint base) {
         try {
             glong const i = parseLong(str, base);
@@ -276,35 +246,15 @@ namespace core {
     }
 
     String Long::toString(glong i, gint base) {
-        if (base < 2 || base > 36)
-            base = 10;
-        gchar digits[64 + 1] = {0}; // 64 chars max + 1 sign char
-        glong a = Math::abs(i);
-        gint j = 64;
-        do {
-            gint const q = (gint) (a % base);
-            glong const r = a / base;
-            a = r;
-            digits[j--] = q + (q < 10 ? 48 : 87);
-        } while (a > 0);
-        if (i < 0)
-            digits[j--] = u'-';
-        return String(digits, j + 1, 65);
+        char digits[IntegerToChars::MAX_CHARS];
+        gint const count = IntegerToChars::toChars(i, base, (glong) digits);
+        return String(digits + 0, 0, count);
     }
 
     String Long::toUnsignedString(glong i, gint base) {
-        if (i >= 0)
-            return toString(i, base);
-        gchar digits[64 + 1] = {};
-        gint j = 64;
-        gint r;
-        while (i < 0) {
-            r = (gint) ((i & 0xffffffffffffffff) % base); // auto convert to unsigned!
-            digits[j--] = (gchar) ((r < 10) ? (48 + r) : (87 + r));
-            i = i / base;
-        }
-        digits[j--] = '-';
-        return String(digits, j + 1, 64 + 1);
+        char digits[IntegerToChars::MAX_CHARS];
+        gint const count = IntegerToChars::toUnsignedChars(i, base, (glong) digits);
+        return String(digits + 0, 0, count);
     }
 
     String Long::toUnsignedString(glong i) {
@@ -312,15 +262,48 @@ namespace core {
     }
 
     String Long::toHexString(glong i) {
-        return toString(i, 16);
+        return toUnsignedString(i, 16);
     }
 
     String Long::toOctalString(glong i) {
-        return toString(i, 8);
+        return toUnsignedString(i, 8);
     }
 
     String Long::toBinaryString(glong i) {
-        return toString(i, 2);
+        return toUnsignedString(i, 2);
+    }
+
+    gint Long::toChars(glong l, CharArray &dst, gint offset) {
+        try {
+            return toChars(l, 10, dst, offset);
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.Long"));
+        }
+    }
+
+    gint Long::toChars(glong l, gint base, CharArray &dst, gint offset) {
+        gbyte digits[IntegerToChars::MAX_CHARS];
+        gint const count = IntegerToChars::toChars(l, base, (glong) digits);
+        try {
+            Preconditions::checkIndexFromSize(offset, count, dst.length());
+            // the storage of array is contiguous
+            StringCoding::copy((glong) digits, StringCoding::LATIN1, 0, (glong) &dst[offset], StringCoding::UTF16, 0, count);
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.Long"));
+        }
+        return count;
+    }
+
+    gint Long::toUnsignedChars(glong l, gint base, CharArray &dst, gint offset) {
+        gbyte digits[IntegerToChars::MAX_CHARS];
+        gint const count = IntegerToChars::toUnsignedChars(l, base, (glong) digits);
+        try {
+            Preconditions::checkIndexFromSize(offset, count, dst.length());
+            StringCoding::copy((glong) digits, StringCoding::LATIN1, 0, (glong) &dst[offset], StringCoding::UTF16, 0, count);
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.Long"));
+        }
+        return count;
     }
 
     Object &Long::clone() const {
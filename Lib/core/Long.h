@@ -6,6 +6,7 @@
 #define CORE23_LONG_H
 
 #include <core/Comparable.h>
+#include <core/CharSequence.h>
 #include "Math.h"
 
 namespace core {
@@ -163,6 +164,124 @@ namespace core {
          */
         static glong parseUnsignedLong(const String &str);
 
+        /**
+         * Parses the <b style="color: orange;"> CharSequence</b> argument as a signed <b> long</b> in the
+         * specified <b> base</b>, beginning at the specified <b> beginIndex</b>
+         * and extending to <b> endIndex - 1</b>.
+         *
+         * <p>The method does not take steps to guard against the
+         * <b> CharSequence</b> being mutated while parsing.
+         *
+         * @param      s   the <b> CharSequence</b> containing the <b> long</b>
+         *                  representation to be parsed
+         * @param      beginIndex   the beginning index, inclusive.
+         * @param      endIndex     the ending index, exclusive.
+         * @param      base   the base to be used while parsing <b> s</b>.
+         * @return     the signed <b> long</b> represented by the subsequence in
+         *             the specified base.
+         * @throws     IndexException  if the range [beginIndex, endIndex) is out of
+         *             bounds of <b> s</b>.
+         * @throws     NumberFormatException  if the <b> CharSequence</b> does not
+         *             contain a parsable <b> long</b> in the specified
+         *             <b> base</b>.
+         */
+        static glong parseLong(const CharSequence &s, gint beginIndex, gint endIndex, gint base);
+
+        /**
+         * Parses the <b style="color: orange;"> CharSequence</b> argument as an unsigned <b> long</b> in
+         * the specified <b> base</b>, beginning at the specified <b> beginIndex</b>
+         * and extending to <b> endIndex - 1</b>.
+         *
+         * @param      s   the <b> CharSequence</b> containing the unsigned <b> long</b>
+         *                  representation to be parsed
+         * @param      beginIndex   the beginning index, inclusive.
+         * @param      endIndex     the ending index, exclusive.
+         * @param      base   the base to be used while parsing <b> s</b>.
+         * @return     the unsigned <b> long</b> represented by the subsequence in
+         *             the specified base.
+         * @throws     IndexException  if the range [beginIndex, endIndex) is out of
+         *             bounds of <b> s</b>.
+         * @throws     NumberFormatException  if the <b> CharSequence</b> does not
+         *             contain a parsable unsigned <b> long</b> in the specified
+         *             <b> base</b>.
+         */
+        static glong parseUnsignedLong(const CharSequence &s, gint beginIndex, gint endIndex, gint base);
+
+        /**
+         * Parses the <b style="color: orange;"> CharSequence</b> argument as a signed decimal
+         * <b> long</b>, as <b style="color: orange;"> parseLong(String)</b>, but without
+         * exception: the result is empty if the sequence does not contain a parsable
+         * <b> long</b>.
+         *
+         * <p>Use this method when invalid inputs are expected (a user input, a field of
+         * a file, ...): no exception is created for them.
+         *
+         * @param s
+         *        The sequence containing the <b> long</b> representation to be parsed
+         * @return the parsed value, or an empty optional
+         */
+        static util::OptionalLong tryParse(const CharSequence &s);
+
+        /**
+         * Parses the <b style="color: orange;"> CharSequence</b> argument as a signed <b> long</b>
+         * in the specified base, as <b style="color: orange;"> parseLong(String, gint)</b>,
+         * but without exception: the result is empty if the sequence does not contain a
+         * parsable <b> long</b>.
+         *
+         * @param s
+         *        The sequence containing the <b> long</b> representation to be parsed
+         * @param base
+         *        The base to be used while parsing <b> s</b>
+         * @return the parsed value, or an empty optional
+         * @throws IllegalArgumentException if the base is either smaller than 2 or
+         *         larger than 36
+         */
+        static util::OptionalLong tryParse(const CharSequence &s, gint base);
+
+        /**
+         * Parses the <b style="color: orange;"> CharSequence</b> argument as a signed <b> long</b>
+         * in the specified base, beginning at the specified <b> beginIndex</b> and extending
+         * to <b> endIndex - 1</b>, but without exception: the result is empty if the
+         * subsequence does not contain a parsable <b> long</b>.
+         *
+         * @param s
+         *        The sequence containing the <b> long</b> representation to be parsed
+         * @param beginIndex
+         *        The beginning index, inclusive.
+         * @param endIndex
+         *        The ending index, exclusive.
+         * @param base
+         *        The base to be used while parsing <b> s</b>
+         * @return the parsed value, or an empty optional
+         * @throws IndexException if the range [beginIndex, endIndex) is out of bounds
+         *         of <b> s</b>
+         * @throws IllegalArgumentException if the base is either smaller than 2 or
+         *         larger than 36
+         */
+        static util::OptionalLong tryParse(const CharSequence &s, gint beginIndex, gint endIndex, gint base);
+
+        /**
+         * Parses the signed decimal <b> long</b> values of the given sequence separated by
+         * the given delimiter (like "12,-7,42" with delimiter ','), and stores them in the
+         * given array, from index 0. The empty sequence contains no value.
+         *
+         * <p>The chars of String and StringView are read directly from their storage, and
+         * no String is created for the values.
+         *
+         * @param s
+         *        The sequence containing the delimited values
+         * @param delimiter
+         *        The char separating the values
+         * @param dst
+         *        The array receiving the values
+         * @return the number of parsed values
+         * @throws NumberFormatException if one of values is not a parsable <b> long</b>
+         *         (the values that precede it are stored)
+         * @throws IndexException if the sequence contains more values than
+         *         <b> dst.length()</b>
+         */
+        static gint parseLongs(const CharSequence &s, gchar delimiter, native::LongArray &dst);
+
         /**
          * Returns a Long object holding the value extracted from the specified
          * String when parsed with the base given by the second argument. The
@@ -470,6 +589,60 @@ namespace core {
          */
         static String toBinaryString(glong l);
 
+        /**
+         * Write the decimal representation of the <b>long</b> argument (the characters
+         * of String returned by <b>Long.toString(glong)</b>) in the given array, from
+         * the given offset. No String is created: the characters are written directly
+         * in the array.
+         *
+         * @param l
+         *         The <b>long</b> to be converted.
+         * @param dst
+         *         The destination array
+         * @param offset
+         *         The index of first written character
+         * @return the number of written characters
+         * @throws IndexException if the characters exceed the array
+         */
+        static gint toChars(glong l, native::CharArray &dst, gint offset);
+
+        /**
+         * Write the representation of the <b>long</b> argument in the given base (the
+         * characters of String returned by <b>Long.toString(glong, gint)</b>) in the
+         * given array, from the given offset. The digits of the bases 2, 8 and 16 are
+         * computed with shifts and masks.
+         *
+         * @param l
+         *         The <b>long</b> to be converted.
+         * @param base
+         *         The base to use in the representation
+         * @param dst
+         *         The destination array
+         * @param offset
+         *         The index of first written character
+         * @return the number of written characters
+         * @throws IndexException if the characters exceed the array
+         */
+        static gint toChars(glong l, gint base, native::CharArray &dst, gint offset);
+
+        /**
+         * Write the unsigned representation of the <b>long</b> argument in the given base
+         * (the characters of String returned by <b>Long.toUnsignedString(glong, gint)</b>)
+         * in the given array, from the given offset.
+         *
+         * @param l
+         *         The <b>long</b> to be converted.
+         * @param base
+         *         The base to use in the representation
+         * @param dst
+         *         The destination array
+         * @param offset
+         *         The index of first written character
+         * @return the number of written characters
+         * @throws IndexException if the characters exceed the array
+         */
+        static gint toUnsignedChars(glong l, gint base, native::CharArray &dst, gint offset);
+
         /**
          * Return the hash code of this Long's value
          */
@@ -4,6 +4,8 @@
 
 #include "String.h"
 #include <core/private/Unsafe.h>
+#include <core/private/StringCoding.h>
+#include <core/private/StringTable.h>
 #include <core/private/Null.h>
 #include <core/util/Preconditions.h>
 #include <core/IndexException.h>
@@ -13,6 +15,10 @@
 #include <core/Float.h>
 #include <core/Double.h>
 
+#if defined(CORE_COMPILER_MSVC) && !defined(CORE_COMPILER_GNU)
+#include <intrin.h>
+#endif
+
 namespace core {
 
     using namespace util;
@@ -25,23 +31,13 @@ namespace core {
         CORE_ALIAS(PCBYTE2, typename Class<const gchar>::Ptr);
         CORE_ALIAS(PCBYTE4, typename Class<const gint>::Ptr);
 
-        CORE_FAST glong alignToHeapWordSize(glong bytes) {
-            return bytes >= 0 ? (bytes + Unsafe::ADDRESS_SIZE - 1) & ~(Unsafe::ADDRESS_SIZE - 1) : -1;
-        }
+        CORE_FAST gbyte LATIN1 = StringCoding::LATIN1;
+        CORE_FAST gbyte UTF16 = StringCoding::UTF16;
 
         void putChar(PBYTE dst, glong idx, gchar ch) {
-            if(dst == null || idx < 0)
+            if (dst == null || idx < 0)
                 return;
-            glong const index = idx * 2LL;
-            gbyte const hb = Character::highByte(ch);
-            gbyte const lb = Character::lowByte(ch);
-            if (Unsafe::BIG_ENDIAN) {
-                dst[index] = hb;
-                dst[index + 1LL] = lb;
-            } else {
-                dst[index] = lb;
-                dst[index + 1LL] = hb;
-            }
+            StringCoding::putChar((glong) dst, UTF16, idx, ch);
         }
 
         void putChar(PBYTE dst, glong idx, gint cp) {
@@ -59,108 +55,262 @@ namespace core {
             }
         }
 
-        gchar nextChar(PCBYTE src, glong idx) {
+        gchar nextChar(PCBYTE src, gbyte coder, glong idx) {
             if ((src == null) || idx < 0)
                 return Character::MIN_VALUE;
-            glong const index = idx * 2LL;
-            if (Unsafe::BIG_ENDIAN)
-                return Character::joinBytes(src[index], src[index + 1]);
-            else
-                return Character::joinBytes(src[index + 1], src[index]);
+            return StringCoding::getChar((glong) src, coder, idx);
         }
 
-        PBYTE generate(gint count) {
-            if (count <= 0) return null;
-            glong const sizeInBytes = (count + 1LL) << 1;
-            const glong heapSize = alignToHeapWordSize(sizeInBytes);
-            PBYTE address = (PBYTE) Unsafe::allocateMemory(sizeInBytes);
-            if (address != null)
-                for (glong i = sizeInBytes - 2; i < heapSize; ++i)
-                    address[i] = 0;
-            return address;
+        /**
+         * The size (in bytes) of the header of shared heap blocks. This header contains the
+         * reference count of block, followed by the size (in bytes) of its storage.
+         */
+        CORE_FAST glong HEADER_SIZE = 16;
+
+        /**
+         * Return new shared heap block, with the storage of count characters (and the null
+         * terminator). The new block has one reference.
+         */
+        glong generate(gint count, gbyte coder) {
+            glong const sizeInBytes = (count + 1LL) << coder;
+            glong const block = Unsafe::allocateMemory(HEADER_SIZE + sizeInBytes);
+            ((glong *) block)[0] = 1;
+            ((glong *) block)[1] = sizeInBytes;
+            PBYTE address = (PBYTE) (block + HEADER_SIZE);
+            // the last char is the null character
+            for (glong i = sizeInBytes - (1LL << coder); i < sizeInBytes; ++i)
+                address[i] = 0;
+            return block;
         }
 
-        gint decodeUTF8_UTF16(PCBYTE in, PBYTE out, glong limit) {
-            glong i = 0;
-            glong j = 0;
-            for (i = 0; i < limit;) {
-                gbyte const b1 = in[i];
-                if (b1 >= 0) {
-                    putChar(out, j, b1);
-                    i += 1;
-                    j += 1;
-                } else if (b1 >> 5 == -2) {
-                    if ((b1 & 0x1e) == 0) {
-                        putChar(out, j, '?');
-                    } else {
-                        gbyte const b2 = in[i + 1];
-                        if ((b2 & 0xc0) != 0x80) {
-                            putChar(out, j, '?');
-                        } else {
-                            gchar const ch = (gchar) ((b1 << 6) ^ b2) ^ (((gbyte) 0xC0 << 6) ^ ((gbyte) 0x80 << 0));
-                            putChar(out, j, ch);
-                        }
-                    }
-                    i += 2;
-                    j += 1;
-                } else if (b1 >> 4 == -2) {
-                    gbyte const b2 = in[i + 1];
-                    gbyte const b3 = in[i + 2];
-                    if ((b1 == (gbyte) 0xe0 && (b2 & 0xe0) == 0x80) || (b2 & 0xc0) != 0x80 || (b3 & 0xc0) != 0x80) {
-                        putChar(out, j, '?');
-                    } else {
-                        gchar const ch = (gchar) (b1 << 12) ^ (b2 << 6) ^
-                                         (b3 ^ (((gbyte) 0xE0 << 12) ^ ((gbyte) 0x80 << 6) ^ ((gbyte) 0x80 << 0)));
-                        if (Character::isSurrogate(ch)) {
-                            putChar(out, j, '?');
-                        } else {
-                            putChar(out, j, ch);
-                        }
-                    }
-                    i += 3;
-                    j += 1;
-                } else if (b1 >> 3 == -2) {
-                    gbyte const b2 = in[i + 1];
-                    gbyte const b3 = in[i + 2];
-                    gbyte const b4 = in[i + 3];
-                    gint const ch = (b1 << 18 ^ (b2 << 12) ^ (b3 << 6) ^ (b4 ^ (
-                            ((gbyte) 0xF0 << 18) ^ ((gbyte) 0x80 << 12) ^ ((gbyte) 0x80 << 6) ^ ((gbyte) 0x80 << 0))));
-                    if ((b2 & 0xc0) != 0x80 || (b3 & 0xc0) != 0x80 || (b4 & 0xc0) != 0x80 || ch <= 0xFFFF) {
-                        putChar(out, j, '?');
-                    } else {
-                        putChar(out, j, ch);
-                    }
-                    i += 4;
-                    j += 2;
-                } else {
-                    putChar(out, j, '?');
-                    i += 1;
-                    j += 1;
-                }
-            }
-            return (gint) Math::min(j, (glong) Integer::MAX_VALUE);
+        /**
+         * Add one reference to the given shared block.
+         */
+        void retain(glong block) {
+            glong volatile &refs = ((glong volatile *) block)[0];
+#if defined(CORE_COMPILER_GNU)
+            __atomic_fetch_add(&refs, 1, __ATOMIC_RELAXED);
+#elif defined(CORE_COMPILER_MSVC)
+            _InterlockedExchangeAdd64((__int64 volatile *) &refs, 1);
+#else
+            refs += 1;
+#endif
+        }
+
+        /**
+         * Remove one reference to the given shared block, and free this block
+         * if it was the last reference.
+         */
+        void unretain(glong block) {
+            glong volatile &refs = ((glong volatile *) block)[0];
+            // the unique reference is held by the caller, no other thread can access to this block
+            // (the load acquires the release of the other references, before the block is freed)
+#if defined(CORE_COMPILER_GNU)
+            gbool const isLast = __atomic_load_n(&refs, __ATOMIC_ACQUIRE) == 1 ||
+                                 __atomic_fetch_sub(&refs, 1, __ATOMIC_ACQ_REL) == 1;
+#elif defined(CORE_COMPILER_MSVC)
+            gbool const isLast = _InterlockedCompareExchange64((__int64 volatile *) &refs, 1, 1) == 1 ||
+                                 _InterlockedExchangeAdd64((__int64 volatile *) &refs, -1) == 1;
+#else
+            gbool const isLast = refs == 1 || (refs -= 1) == 0;
+#endif
+            if (isLast)
+                Unsafe::freeMemory(block);
+        }
+
+        gint toLowerAscii(gchar ch) {
+            return ch >= 'A' && ch <= 'Z' ? ch | 0x20 : ch;
+        }
+
+        /**
+         * Return the value of given hexadecimal digit, or -1 if it is not a hexadecimal digit.
+         */
+        gint hexDigit(gchar ch) {
+            if (ch >= '0' && ch <= '9')
+                return ch - '0';
+            if (ch >= 'a' && ch <= 'f')
+                return ch - 'a' + 10;
+            if (ch >= 'A' && ch <= 'F')
+                return ch - 'A' + 10;
+            return -1;
         }
 
         gint charCount(gint ch) {
             return Character::isSupplementary(ch) && Character::isValidCodePoint(ch) ? 2 : 1;
         }
 
-        void arraycopy(PCBYTE src, gint offset1, PBYTE dst, gint offset2, gint count) {
-            if ((src == null) || (dst == null) || count == 0 || offset1 < 0 || offset2 < 0) {
+        void arraycopy(PCBYTE src, gbyte srcCoder, gint offset1, PBYTE dst, gbyte dstCoder, gint offset2, gint count) {
+            if ((src == null) || (dst == null) || count <= 0 || offset1 < 0 || offset2 < 0) {
                 return;
             }
-            glong const maxCount = count * 2LL;
-            glong const maxOffset1 = offset1 * 2LL;
-            glong const maxOffset2 = offset2 * 2LL;
-            if (count > 0)
-                for (glong i = maxCount - 1; i >= 0; i -= 1) {
-                    dst[i + maxOffset2] = src[i + maxOffset1];
-                }
-            else
-                for (glong i = maxCount + 1; i <= 0; i += 1) {
-                    dst[-i + maxOffset2] = src[-i + maxOffset1];
-                }
+            StringCoding::copy((glong) src, srcCoder, offset1, (glong) dst, dstCoder, offset2, count);
+        }
+    }
+
+    void String::assign(glong address, gbyte srcCoder, gint count) {
+        if (count <= 0)
+            return;
+        // the UTF16 chars are compressed if all chars are latin1 chars
+        gbyte const newCoder = srcCoder == UTF16 && StringCoding::indexOfNonLatin1(address, count) < 0 ? LATIN1
+                                                                                                        : srcCoder;
+        value = allocate(count, newCoder);
+        len = count;
+        coder = newCoder;
+        StringCoding::copy(address, srcCoder, 0, (glong) value, coder, 0, count);
+    }
+
+    void String::decodeUtf8(glong address, glong count) {
+        if (count <= 0)
+            return;
+        gbool latin1 = true;
+        glong const length = StringCoding::decodedUtf8Length(address, count, latin1);
+        if (length > Integer::MAX_VALUE)
+            MemoryError("Required length exceeds implementation limit").throws(__trace("core.String"));
+        // the chars are decoded directly with the most compact coder
+        gbyte const newCoder = latin1 ? LATIN1 : UTF16;
+        value = allocate((gint) length, newCoder);
+        len = (gint) length;
+        coder = newCoder;
+        StringCoding::decodeUtf8(address, count, (glong) value, newCoder);
+    }
+
+    void String::compact() {
+        if (len <= 0) {
+            // the empty strings are always LATIN1 (the strings with different coders are different)
+            coder = LATIN1;
+            return;
+        }
+        if (coder != UTF16 || StringCoding::indexOfNonLatin1((glong) value, len) >= 0)
+            return;
+        if (value == (STORAGE) buffer) {
+            // compression in place
+            StringCoding::compress((glong) value, (glong) value, len);
+            value[len] = 0;
+            coder = LATIN1;
+        } else {
+            String str;
+            str.value = str.allocate(len, LATIN1);
+            str.len = len;
+            str.coder = LATIN1;
+            StringCoding::compress((glong) value, (glong) str.value, len);
+            exchange(str);
+        }
+    }
+
+    String::STORAGE String::allocate(gint count, gbyte coder) {
+        if (count <= 0)
+            return null;
+        if (((count + 1LL) << coder) > INLINE_SIZE) {
+            glong const block = generate(count, coder);
+            buffer[0] = block;
+            kind = SHARED;
+            return (STORAGE) (block + HEADER_SIZE);
+        }
+        glong const sizeInBytes = (count + 1LL) << coder;
+        PBYTE address = (PBYTE) buffer;
+        // the last char is the null character
+        for (glong i = sizeInBytes - (1LL << coder); i < sizeInBytes; ++i)
+            address[i] = 0;
+        return address;
+    }
+
+    void String::release() {
+        if (kind == SHARED)
+            unretain(buffer[0]);
+        value = null;
+        kind = OWNED;
+    }
+
+    void String::share(const String &str, gint offset, gint count) {
+        if (str.kind == SHARED) {
+            retain(str.buffer[0]);
+            buffer[0] = str.buffer[0];
         }
+        value = str.value + ((glong) offset << str.coder);
+        kind = str.kind;
+        len = count;
+        coder = str.coder;
+    }
+
+    String String::slice(gint startIndex, gint endIndex) const {
+        gint const count = endIndex - startIndex;
+        if (count == len)
+            return *this;
+        String str;
+        // the static storages are never released, their views never pin a large storage
+        gbool const isStatic = kind == INTERNED || kind == STATIC;
+        // the sub-strings of UTF16 string may be compressible, the LATIN1 coder must be used in this case
+        if (count > 0 && (isStatic || (kind == SHARED && ((count + 1LL) << coder) > INLINE_SIZE &&
+                                       ((glong) count << coder) * VIEW_RATIO >= ((glong *) buffer[0])[1])) &&
+            (coder == LATIN1 || StringCoding::indexOfNonLatin1((glong) value + ((glong) startIndex << coder), count) >= 0)) {
+            str.share(*this, startIndex, count);
+            // a part of interned storage is not an interned string
+            if (isStatic)
+                str.kind = STATIC;
+        } else
+            str.assign((glong) value + ((glong) startIndex << coder), coder, count);
+        return str;
+    }
+
+    String String::literal(glong address, gint bytesPerChar, gint count) {
+        String str;
+        if (count <= 0)
+            return str;
+        gbool isCompact = false;
+        if (bytesPerChar == 1) {
+            // the ASCII literals are already stored with LATIN1 coder
+            PCBYTE const chars = (PCBYTE) address;
+            gint i = 0;
+            while (i < count && chars[i] >= 0)
+                i += 1;
+            isCompact = i == count;
+        } else if (bytesPerChar == 2) {
+            // the UTF16 literals can be used only if they contain at least one non LATIN1 char
+            isCompact = StringCoding::indexOfNonLatin1(address, count) >= 0;
+            if (!isCompact && ((count + 1LL) << LATIN1) <= INLINE_SIZE) {
+                // the short literal is compressed in inline storage
+                str.assign(address, UTF16, count);
+                return str;
+            }
+        }
+        if (isCompact) {
+            str.value = (STORAGE) address;
+            str.kind = STATIC;
+            str.len = count;
+            str.coder = bytesPerChar == 1 ? LATIN1 : UTF16;
+            return str;
+        }
+        glong storage = StringTable::literal(address);
+        if (storage == 0) {
+            // first use of this literal: it's converted once, and interned
+            str.wrap(address, bytesPerChar, count);
+            str = str.intern();
+            StringTable::putLiteral(address, (glong) str.value);
+            return str;
+        }
+        str.value = (STORAGE) storage;
+        str.kind = INTERNED;
+        str.len = StringTable::lengthOf(storage);
+        str.coder = StringTable::coderOf(storage);
+        return str;
+    }
+
+    void String::exchange(String &str) CORE_NOTHROW {
+        gbool const isInline = value == (STORAGE) buffer;
+        gbool const isInline2 = str.value == (STORAGE) str.buffer;
+        for (gint i = 0; i < (INLINE_SIZE >> 3); ++i)
+            Unsafe::swapValues(buffer[i], str.buffer[i]);
+        Unsafe::swapValues(value, str.value);
+        Unsafe::swapValues(len, str.len);
+        Unsafe::swapValues(hashcode, str.hashcode);
+        Unsafe::swapValues(isHashed, str.isHashed);
+        Unsafe::swapValues(coder, str.coder);
+        Unsafe::swapValues(kind, str.kind);
+        // the inline storages has been exchanged, the pointers must follow them
+        if (isInline2)
+            value = (STORAGE) buffer;
+        if (isInline)
+            str.value = (STORAGE) str.buffer;
     }
 
     void String::wrap(glong addr, gint bpc, glong count) {
@@ -168,100 +318,80 @@ namespace core {
         len = 0;
         hashcode = 0;
         isHashed = false;
+        coder = LATIN1;
         if (addr == 0)
             IllegalArgumentException("Null pointer").throws(__trace("core.String"));
         // assert ((bpc == 1) || (bpc == 2) || (bpc == 4))
         if (count == 0) return;
-        gint length = 0;
         if (count < 0) {
+            // search the null character
             count = 0;
             switch (bpc) {
-                case 1: {
-                    PCBYTE b = (PCBYTE) addr;
-                    while (b[count] != 0)
+                case 1:
+                    while (((PCBYTE) addr)[count] != 0)
                         count += 1;
-                    length = decodeUTF8_UTF16(b, null, count);
-                    value = generate(length);
-                    len = length;
-                    decodeUTF8_UTF16(b, value, count);
                     break;
-                }
-                case 2: {
-                    PCBYTE2 b = (PCBYTE2) addr;
-                    while (b[count] != 0)
+                case 2:
+                    while (((PCBYTE2) addr)[count] != 0)
                         count += 1;
-                    length = (gint) Math::min((glong) Integer::MAX_VALUE, count);
-                    value = generate(length);
-                    len = length;
-                    for (gint i = 0; i < length; ++i) {
-                        putChar(value, i, b[i]);
-                    }
                     break;
-                }
-                case 4: {
-                    PCBYTE4 b = (PCBYTE4) addr;
-                    gint count2 = 0;
-                    while (b[count] != 0) {
-                        count2 += charCount(b[count]);
+                case 4:
+                    while (((PCBYTE4) addr)[count] != 0)
                         count += 1;
-                        if (count2 < 0) {
-                            count2 = Integer::MAX_VALUE;
-                            break;
-                        }
-                    }
-                    length = Math::min(Integer::MAX_VALUE, count2);
-                    value = generate(length);
-                    len = length;
-                    gint j = 0;
-                    for (gint i = 0; i < count; ++i) {
-                        putChar(value, j, b[i]);
-                        j += charCount(b[i]);
-                    }
                     break;
-                }
                 default:
                     return;
             }
-        } else {
-            switch (bpc) {
-                case 1: {
-                    PCBYTE b = (PCBYTE) addr;
-                    length = decodeUTF8_UTF16(b, null, count);
-                    value = generate(length);
-                    len = length;
-                    decodeUTF8_UTF16(b, value, count);
-                    break;
-                }
-                case 2: {
-                    PCBYTE2 b = (PCBYTE2) addr;
-                    length = (gint) Long::min(Integer::MAX_VALUE, count);
-                    value = generate(length);
-                    len = length;
-                    for (gint i = 0; i < length; ++i) {
-                        putChar(value, i, b[i]);
+            if (count == 0)
+                return;
+        }
+        gint length = 0;
+        switch (bpc) {
+            case 1:
+                decodeUtf8(addr, count);
+                break;
+            case 2: {
+                length = (gint) Long::min(Integer::MAX_VALUE, count);
+                assign(addr, UTF16, length);
+                break;
+            }
+            case 4: {
+                PCBYTE4 b = (PCBYTE4) addr;
+                gint count2 = 0;
+                gbool isLatin1 = true;
+                count = (gint) Long::min(Integer::MAX_VALUE, count);
+                for (gint i = 0; i < count; ++i) {
+                    count2 += charCount(b[i]);
+                    if (count2 < 0) {
+                        count2 = Integer::MAX_VALUE;
+                        count = i;
+                        break;
                     }
-                    break;
+                    if (!StringCoding::canEncode(b[i]) && Character::isValidCodePoint(b[i]))
+                        isLatin1 = false;
                 }
-                case 4: {
-                    PCBYTE4 b = (PCBYTE4) addr;
-                    gint count2 = 0;
-                    count = (gint) Long::min(Integer::MAX_VALUE, count);
-                    for (gint i = 0; i < count; ++i) {
-                        count2 += charCount(b[i]);
-                    }
-                    length = (gint) Long::min(Integer::MAX_VALUE, count2);
-                    value = generate(length);
+                length = count2;
+                if (isLatin1) {
+                    // the invalid code points are replaced by '?'
+                    value = allocate(length, LATIN1);
                     len = length;
-                    gint j = 0;
                     for (gint i = 0; i < count; ++i) {
-                        putChar(value, j, b[i]);
-                        j += charCount(b[i]);
+                        value[i] = StringCoding::canEncode(b[i]) ? (gbyte) b[i] : (gbyte) '?';
                     }
                     break;
                 }
-                default:
-                    return;
+                value = allocate(length, UTF16);
+                len = length;
+                coder = UTF16;
+                gint j = 0;
+                for (gint i = 0; i < count; ++i) {
+                    putChar(value, j, b[i]);
+                    j += charCount(b[i]);
+                }
+                break;
             }
+            default:
+                return;
         }
     }
 
@@ -270,6 +400,7 @@ namespace core {
         len = 0;
         hashcode = 0;
         isHashed = false;
+        coder = LATIN1;
         if (addr == 0)
             IllegalArgumentException("Null pointer").throws(__trace("core.String"));
         if (limit < 0)
@@ -277,79 +408,70 @@ namespace core {
         if (offset < 0)
             IllegalArgumentException("Negative offset").throws(__trace("core.String"));
         // assert ((bpc == 1) && (bpc == 2) && (bpc == 4))
-        if (count == 0)
+        if (count == 0 || limit == 0)
             return;
-        gint length = 0;
         if (count < 0) {
-            count = Math::min(Integer::MAX_VALUE, limit);
-        } else {
-            count = Math::min(count, (glong) limit);
-        }
-        addr += offset * (glong) bpc;
-        switch (bpc) {
-            case 1: {
-                PCBYTE b = (PCBYTE) addr;
-                length = decodeUTF8_UTF16(b, null, count - offset);
-                value = generate(length);
-                len = length;
-                decodeUTF8_UTF16(b, value, count);
-                break;
-            }
-            case 2: {
-                PCBYTE2 b = (PCBYTE2) addr;
-                length = (gint) (count - offset);
-                value = generate(length);
-                len = length;
-                for (gint i = 0; i < length; ++i) {
-                    gchar const ch = b[i];
-                    putChar(value, i, ch);
-                }
-                break;
-            }
-            case 4: {
-                PCBYTE4 b = (PCBYTE4) addr;
-                gint count2 = 0;
-                count = (gint) Long::min(Integer::MAX_VALUE, count - offset);
-                for (gint i = 0; i < count; ++i) {
-                    count2 += charCount(b[i]);
-                }
-                length = (gint) Long::min(Integer::MAX_VALUE, count2);
-                value = generate(length);
-                len = length;
-                gint j = 0;
-                for (gint i = 0; i < count; ++i) {
-                    putChar(value, j, b[i]);
-                    j += charCount(b[i]);
-                }
-                break;
+            // search the null character, in the given range
+            addr += offset * (glong) bpc;
+            count = 0;
+            switch (bpc) {
+                case 1:
+                    while (count < limit && ((PCBYTE) addr)[count] != 0)
+                        count += 1;
+                    break;
+                case 2:
+                    while (count < limit && ((PCBYTE2) addr)[count] != 0)
+                        count += 1;
+                    break;
+                case 4:
+                    while (count < limit && ((PCBYTE4) addr)[count] != 0)
+                        count += 1;
+                    break;
+                default:
+                    return;
             }
-            default:
-                return;
+        } else {
+            if (offset > count)
+                offset = (gint) count;
+            count = Math::min(count - offset, (glong) limit);
+            addr += offset * (glong) bpc;
         }
+        if (count > 0)
+            wrap(addr, bpc, count);
     }
 
-    String::String(const String &original) : value(generate(original.len)), len(original.len),
-                                             isHashed(original.isHashed), hashcode(original.hashcode) {
-        arraycopy(original.value, 0, value, 0, len);
+    String::String(const String &original) : len(original.len), hashcode(original.hashcode),
+                                             isHashed(original.isHashed), coder(original.coder) {
+        if (original.kind != OWNED) {
+            // the interned and heap storages are shared
+            share(original, 0, len);
+            return;
+        }
+        value = allocate(len, coder);
+        arraycopy(original.value, coder, 0, value, coder, 0, len);
     }
 
     String::String(String &&original) CORE_NOTHROW {
-        Unsafe::swapValues(value, original.value);
-        Unsafe::swapValues(len, original.len);
-        Unsafe::swapValues(hashcode, original.hashcode);
-        Unsafe::swapValues(isHashed, original.isHashed);
+        exchange(original);
     }
 
     String &String::operator=(const String &str) {
         if (this != &str) {
-            PBYTE newValue = {};
-            if (len != str.len) {
-                newValue = generate(str.len);
-                len = 0;
-                Unsafe::freeMemory((glong) value);
-            } else
-                newValue = value;
-            arraycopy(str.value, 0, value = newValue, 0, len = str.len);
+            if (str.kind != OWNED) {
+                // the interned and heap storages are shared
+                String tmp;
+                tmp.share(str, 0, str.len);
+                exchange(tmp);
+            } else {
+                if (len != str.len || coder != str.coder || kind != OWNED) {
+                    len = 0;
+                    release();
+                    value = allocate(str.len, str.coder);
+                }
+                arraycopy(str.value, str.coder, 0, value, str.coder, 0, str.len);
+            }
+            coder = str.coder;
+            len = str.len;
             hashcode = str.hashcode;
             isHashed = str.isHashed;
         }
@@ -358,10 +480,7 @@ namespace core {
 
     String &String::operator=(String &&str) CORE_NOTHROW {
         if (this != &str) {
-            Unsafe::swapValues(value, str.value);
-            Unsafe::swapValues(len, str.len);
-            Unsafe::swapValues(hashcode, str.hashcode);
-            Unsafe::swapValues(isHashed, str.isHashed);
+            exchange(str);
         }
         return *this;
     }
@@ -369,16 +488,16 @@ namespace core {
     gchar String::charAt(gint index) const {
         try {
             Preconditions::checkIndex(index, len);
-            return nextChar(value, index);
+            return StringCoding::getChar((glong) value, coder, index);
         } catch (const IndexException &ie) { ie.throws(__trace("core.String")); }
     }
 
     gint String::codePointAt(gint index) const {
         try {
             Preconditions::checkIndex(index, len);
-            gchar const ch = nextChar(value, index);
-            if (Character::isSurrogate(ch)) return ch;
-            gchar const ch2 = nextChar(value, index + 1);
+            gchar const ch = StringCoding::getChar((glong) value, coder, index);
+            if (coder == LATIN1 || !Character::isHighSurrogate(ch) || index + 1 >= len) return ch;
+            gchar const ch2 = StringCoding::getChar((glong) value, coder, index + 1);
             return Character::isSurrogatePair(ch, ch2) ? Character::joinSurrogates(ch, ch2) : ch;
         } catch (const IndexException &ie) { ie.throws(__trace("core.String")); }
     }
@@ -388,58 +507,65 @@ namespace core {
     }
 
     gbool String::equals(const String &str) const {
-        return (this == &str) || (len == str.len) && (compareTo(str) == 0);
+        if (this == &str)
+            return true;
+        // the strings with different coders are always different
+        if (len != str.len || coder != str.coder)
+            return false;
+        if (value == str.value)
+            return true;
+        // the pool contains one storage per sequence of chars
+        if (kind == INTERNED && str.kind == INTERNED)
+            return false;
+        return StringCoding::mismatch((glong) value, coder, (glong) str.value, coder, len) < 0;
     }
 
     gbool String::equalsIgnoreCase(const String &str) const {
-        return (this == &str) || (len == str.len) && (compareToIgnoreCase(str) == 0);
+        return (this == &str) || ((len == str.len) && (compareToIgnoreCase(str) == 0));
     }
 
     gint String::compareTo(const String &other) const {
-        if (this == &other) return 0;
+        if (this == &other || (value == other.value && len == other.len && coder == other.coder)) return 0;
         gint const length = Math::min(len, other.len);
-        for (gint i = 0; i < length; ++i) {
-            gchar const ch1 = nextChar(value, i);
-            gchar const ch2 = nextChar(other.value, i);
-            if (ch1 != ch2) return ch1 - ch2;
-        }
+        gint const i = StringCoding::mismatch((glong) value, coder, (glong) other.value, other.coder, length);
+        if (i >= 0)
+            return nextChar(value, coder, i) - nextChar(other.value, other.coder, i);
         return len == other.len ? 0 :
-               length == len ? -nextChar(other.value, length) :
-               nextChar(value, length);
+               length == len ? -nextChar(other.value, other.coder, length) :
+               nextChar(value, coder, length);
     }
 
     gint String::compareToIgnoreCase(const String &other) const {
-        if (this == &other) return 0;
+        if (this == &other || (value == other.value && len == other.len && coder == other.coder)) return 0;
         gint const length = Math::min(len, other.len);
-        for (gint i = 0; i < length; ++i) {
-            gchar ch1 = nextChar(value, i);
-            gchar ch2 = nextChar(other.value, i);
-            if (ch1 != ch2) {
-                ch1 = Character::toLowerCase(ch1);
-                ch2 = Character::toLowerCase(ch2);
-                if (ch1 != ch2) return ch1 - ch2;
-            }
+        gint i = 0;
+        while (i < length) {
+            // the ASCII letters are compared in blocks, the other chars with the Unicode tables
+            gint const j = StringCoding::mismatchIgnoreCase((glong) value + ((glong) i << coder), coder,
+                                                            (glong) other.value + ((glong) i << other.coder),
+                                                            other.coder, length - i);
+            if (j < 0)
+                break;
+            i += j;
+            gchar ch1 = nextChar(value, coder, i);
+            gchar ch2 = nextChar(other.value, other.coder, i);
+            if (ch1 <= 0x7F && ch2 <= 0x7F)
+                // these ASCII chars differ even ignoring case
+                return toLowerAscii(ch1) - toLowerAscii(ch2);
+            ch1 = Character::toLowerCase(ch1);
+            ch2 = Character::toLowerCase(ch2);
+            if (ch1 != ch2) return ch1 - ch2;
+            i += 1;
         }
         return len == other.len ? 0 :
-               length == len ? -nextChar(other.value, length) :
-               nextChar(value, length);
+               length == len ? -nextChar(other.value, other.coder, length) :
+               nextChar(value, coder, length);
     }
 
     gbool String::startsWith(const String &str, gint offset) const {
-        if (offset >= 0 && str.len > 0 && str.len <= len) {
-            gbool isFound = true;
-            for (gint i = offset; i < len; ++i) {
-                for (gint j = 0; j < str.len; ++j) {
-                    gchar const ch1 = nextChar(value, i + j);
-                    gchar const ch2 = nextChar(str.value, j);
-                    if (ch1 != ch2) {
-                        isFound = false;
-                        break;
-                    }
-                }
-                if (isFound)
-                    return true;
-            }
+        if (offset >= 0 && str.len > 0 && offset <= len - str.len) {
+            glong const address = (glong) value + ((glong) offset << coder);
+            return StringCoding::mismatch(address, coder, (glong) str.value, str.coder, str.len) < 0;
         }
         return false;
     }
@@ -453,15 +579,33 @@ namespace core {
     }
 
     gint String::hash() const {
-        if (!isHashed) {
-            gint &hash = (gint &) hashcode;
-            hash = 0;
-            for (gint i = 0; i < len; ++i) {
-                gchar const ch = nextChar(value, i);
-                hash += ch * 31 ^ (len - (i + 1));
-            }
+        gint h = hashcode;
+        if (h == 0 && !isHashed) {
+            h = StringCoding::hash((glong) value, coder, len);
+            // zero is never cached in hashcode, it is recorded by isHashed instead
+            if (h == 0)
+                (gbool &) isHashed = true;
+            else
+                (gint &) hashcode = h;
         }
-        return hashcode;
+        return h;
+    }
+
+    glong String::hash64(glong seed) const {
+        return StringCoding::hash64((glong) value, coder, len, seed);
+    }
+
+    String String::intern() const {
+        if (kind == INTERNED || len <= 0)
+            return *this;
+        String str;
+        str.value = (STORAGE) StringTable::intern((glong) value, coder, len);
+        str.kind = INTERNED;
+        str.len = len;
+        str.coder = coder;
+        str.hashcode = hashcode;
+        str.isHashed = isHashed;
+        return str;
     }
 
     gint String::indexOf(gint ch) const {
@@ -470,11 +614,7 @@ namespace core {
 
     gint String::indexOf(gint ch, gint startIndex) const {
         if (startIndex >= 0)
-            for (gint i = startIndex; i < len; ++i) {
-                gchar const ch2 = nextChar(value, i);
-                if (ch2 == ch)
-                    return i;
-            }
+            return StringCoding::indexOf((glong) value, coder, len, ch, startIndex);
         return -1;
     }
 
@@ -483,15 +623,7 @@ namespace core {
     }
 
     gint String::lastIndexOf(gint ch, gint startIndex) const {
-        if (startIndex >= len)
-            startIndex = len - 1;
-        if (startIndex >= 0)
-            for (gint i = startIndex; i >= 0; --i) {
-                gchar const ch2 = nextChar(value, i);
-                if (ch2 == ch)
-                    return i;
-            }
-        return -1;
+        return StringCoding::lastIndexOf((glong) value, coder, len, ch, startIndex);
     }
 
     gint String::indexOf(const String &str) const {
@@ -501,21 +633,7 @@ namespace core {
     gint String::indexOf(const String &str, gint startIndex) const {
         if (startIndex < 0 || startIndex + str.len > len || str.isEmpty())
             return -1;
-        for (gint i = startIndex; i < len; ++i) {
-            gbool isFound = true;
-            for (gint j = 0; j < str.len; ++j) {
-                gchar const ch1 = nextChar(value, i + j);
-                gchar const ch2 = nextChar(str.value, j);
-                if (ch1 != ch2) {
-                    isFound = false;
-                    break;
-                }
-            }
-            if (isFound) {
-                return i;
-            }
-        }
-        return -1;
+        return StringCoding::indexOf((glong) value, coder, len, (glong) str.value, str.coder, str.len, startIndex);
     }
 
     gint String::lastIndexOf(const String &str) const {
@@ -527,21 +645,13 @@ namespace core {
             startIndex = len - 1;
         if (startIndex < 0 || startIndex + 1 < str.len || str.isEmpty())
             return -1;
-        for (gint i = startIndex; i >= 0; --i) {
-            gbool isFound = true;
-            for (gint j = 0; j < str.len; ++j) {
-                gchar const ch1 = nextChar(value, i - j);
-                gchar const ch2 = nextChar(str.value, str.len - 1 - j);
-                if (ch1 != ch2) {
-                    isFound = false;
-                    break;
-                }
-            }
-            if (isFound) {
-                return i + 1 - str.len;
-            }
-        }
-        return -1;
+        // the startIndex is the index of last char of the occurrence
+        return StringCoding::lastIndexOf((glong) value, coder, len, (glong) str.value, str.coder, str.len,
+                                         startIndex + 1 - str.len);
+    }
+
+    gbool String::contains(const String &str) const {
+        return str.isEmpty() || indexOf(str, 0) >= 0;
     }
 
     String String::subString(gint startIndex) const {
@@ -557,11 +667,7 @@ namespace core {
             Preconditions::checkIndexFromRange(startIndex, endIndex, len);
             if (endIndex > len)
                 endIndex = len;
-            String str;
-            str.len = endIndex - startIndex;
-            str.value = generate(str.len);
-            arraycopy(value, startIndex, str.value, 0, str.len);
-            return str;
+            return slice(startIndex, endIndex);
         } catch (const IndexException &ie) {
             ie.throws(__trace("core.String"));
         }
@@ -572,113 +678,147 @@ namespace core {
         str2.len = len + str.len;
         if (str2.len < 0)
             MemoryError("Overflow: String length out of range").throws(__trace("core.String"));
-        str2.value = generate(str2.len);
-        arraycopy(value, 0, str2.value, 0, len);
-        arraycopy(str.value, 0, str2.value, len, str.len);
+        // a UTF16 string contains at least one non latin1 char
+        str2.coder = coder == LATIN1 ? str.coder : coder;
+        str2.value = str2.allocate(str2.len, str2.coder);
+        arraycopy(value, coder, 0, str2.value, str2.coder, 0, len);
+        arraycopy(str.value, str.coder, 0, str2.value, str2.coder, len, str.len);
         return str2;
     }
 
     String String::replace(gchar oldChar, gchar newChar) const {
+        gint const first = oldChar == newChar ? -1 : indexOf(oldChar);
+        if (first < 0)
+            return *this;
         String str;
-        str.value = generate(len);
-        for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
-            putChar(str.value, i, (ch == oldChar) ? newChar : ch);
+        str.len = len;
+        str.coder = coder == LATIN1 && StringCoding::canEncode(newChar) ? LATIN1 : UTF16;
+        str.value = str.allocate(len, str.coder);
+        // the chars before the first occurrence are unchanged
+        arraycopy(value, coder, 0, str.value, str.coder, 0, first);
+        for (gint i = first; i < len; ++i) {
+            gchar const ch = nextChar(value, coder, i);
+            StringCoding::putChar((glong) str.value, str.coder, i, (ch == oldChar) ? newChar : ch);
         }
+        // the replaced char may be the only non latin1 char
+        str.compact();
         return str;
     }
 
     String String::replace(const String &str, const String &replacement) const {
-        gint cnt = count(str);
-        if (cnt == 0 || isEmpty() || str.len == 0)
+        if (isEmpty() || str.len == 0)
+            return *this;
+        gint cnt = 0;
+        for (gint i = indexOf(str, 0); i >= 0; i = indexOf(str, i + str.len))
+            cnt += 1;
+        if (cnt == 0)
             return *this;
         String str2;
         str2.len = len + (replacement.len - str.len) * cnt;
-        if (str2.len < 0)
+        if (str2.len < 0 || (replacement.len - str.len) * (glong) cnt > Integer::MAX_VALUE)
             MemoryError("Overflow: String length out of range").throws(__trace("core.String"));
-        str2.value = generate(str2.len);
+        str2.coder = coder == LATIN1 ? replacement.coder : coder;
+        str2.value = str2.allocate(str2.len, str2.coder);
         gint k = 0;
-        for (gint i = 0; i < len; ++i) {
-            gbool isFound = false;
-            if (cnt > 0) {
-                isFound = true;
-                for (gint j = 0; j < str.len; ++j) {
-                    gchar const ch1 = nextChar(value, i + j);
-                    gchar const ch2 = nextChar(str.value, j);
-                    if (ch1 != ch2) {
-                        isFound = false;
-                        break;
-                    }
-                }
-            }
-            if (isFound) {
-                cnt -= 1;
-                arraycopy(replacement.value, 0, str2.value, k, replacement.len);
-                k += replacement.len;
-                i += str.len - 1;
-            } else {
-                gchar const ch = nextChar(value, i);
-                putChar(str2.value, k, ch);
-                k += 1;
-            }
+        gint j = 0;
+        for (gint i = indexOf(str, 0); i >= 0; i = indexOf(str, j)) {
+            arraycopy(value, coder, j, str2.value, str2.coder, k, i - j);
+            k += i - j;
+            arraycopy(replacement.value, replacement.coder, 0, str2.value, str2.coder, k, replacement.len);
+            k += replacement.len;
+            j = i + str.len;
         }
+        arraycopy(value, coder, j, str2.value, str2.coder, k, len - j);
+        // the replaced strings may contain all non latin1 chars
+        str2.compact();
         return str2;
     }
 
-    String String::toLowerCase() const {
-        String str;
-        str.len = len;
-        str.value = generate(len);
-        for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
-            if (Character::isHighSurrogate(ch)) {
-                gchar const ch2 = nextChar(value, i + 1);
+    String String::convertCase(gbool upper) const {
+        // the ASCII chars unchanged by the conversion are skipped in blocks
+        gint i = StringCoding::indexOfCaseChange((glong) value, coder, len, upper);
+        while (i >= 0) {
+            gint ch = nextChar(value, coder, i);
+            if (ch <= 0x7F)
+                // ASCII letter
+                break;
+            gint count = 1;
+            if (Character::isHighSurrogate((gchar) ch)) {
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 if (Character::isLowSurrogate(ch2)) {
-                    gint const codePoint = Character::joinSurrogates(ch, ch2);
-                    gint const lowerCase = Character::toLowerCase(codePoint);
-                    putChar(str.value, i, lowerCase);
-                    if (Character::isSupplementary(lowerCase))
-                        i += 1;
+                    ch = Character::joinSurrogates((gchar) ch, ch2);
+                    count = 2;
                 }
-            } else {
-                gchar const lowerCase = Character::toLowerCase(ch);
-                putChar(str.value, i, lowerCase);
             }
+            if ((upper ? Character::toUpperCase(ch) : Character::toLowerCase(ch)) != ch)
+                break;
+            i += count;
+            gint const j = StringCoding::indexOfCaseChange((glong) value + ((glong) i << coder), coder, len - i, upper);
+            i = j < 0 ? -1 : i + j;
         }
-        return str;
-    }
-
-    String String::toUpperCase() const {
+        if (i < 0)
+            // no char is changed
+            return *this;
         String str;
         str.len = len;
-        str.value = generate(str.len);
-        for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
+        if (coder == LATIN1 && StringCoding::indexOfNonAscii((glong) value + i, LATIN1, len - i) < 0) {
+            // only ASCII chars are changed, the result is stored with LATIN1 coder
+            str.coder = LATIN1;
+            str.value = str.allocate(len, LATIN1);
+            arraycopy(value, coder, 0, str.value, LATIN1, 0, i);
+            StringCoding::convertCase((glong) value + i, LATIN1, (glong) str.value + i, LATIN1, len - i, upper);
+            return str;
+        }
+        str.coder = UTF16;
+        str.value = str.allocate(len, UTF16);
+        arraycopy(value, coder, 0, str.value, UTF16, 0, i);
+        while (i < len) {
+            gchar const ch = nextChar(value, coder, i);
+            if (ch <= 0x7F) {
+                // the ASCII chars are converted in blocks
+                gint count = StringCoding::indexOfNonAscii((glong) value + ((glong) i << coder), coder, len - i);
+                if (count < 0)
+                    count = len - i;
+                StringCoding::convertCase((glong) value + ((glong) i << coder), coder,
+                                          (glong) str.value + ((glong) i << UTF16), UTF16, count, upper);
+                i += count;
+                continue;
+            }
+            // the other chars are converted with the Unicode tables
             if (Character::isHighSurrogate(ch)) {
-                gchar const ch2 = nextChar(value, i + 1);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 if (Character::isLowSurrogate(ch2)) {
                     gint const codePoint = Character::joinSurrogates(ch, ch2);
-                    gint const upperCase = Character::toUpperCase(codePoint);
-                    putChar(str.value, i, upperCase);
-                    if (Character::isSupplementary(upperCase))
-                        i += 1;
+                    gint const newCase = upper ? Character::toUpperCase(codePoint) : Character::toLowerCase(codePoint);
+                    putChar(str.value, i, newCase);
+                    i += Character::isSupplementary(newCase) ? 2 : 1;
+                    continue;
                 }
-            } else {
-                gchar const upperCase = Character::toUpperCase(ch);
-                putChar(str.value, i, upperCase);
             }
+            putChar(str.value, i, upper ? Character::toUpperCase(ch) : Character::toLowerCase(ch));
+            i += 1;
         }
+        str.compact();
         return str;
     }
 
+    String String::toLowerCase() const {
+        return convertCase(false);
+    }
+
+    String String::toUpperCase() const {
+        return convertCase(true);
+    }
+
     String String::toTitleCase() const {
         String str;
         str.len = len;
-        str.value = generate(len);
+        str.coder = UTF16;
+        str.value = str.allocate(str.len, UTF16);
         for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
+            gchar const ch = nextChar(value, coder, i);
             if (Character::isHighSurrogate(ch)) {
-                gchar const ch2 = nextChar(value, i + 1);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 if (Character::isLowSurrogate(ch2)) {
                     gint const codePoint = Character::joinSurrogates(ch, ch2);
                     gint const titleCase = Character::toTitleCase(codePoint);
@@ -691,17 +831,19 @@ namespace core {
                 putChar(str.value, i, titleCase);
             }
         }
+        str.compact();
         return str;
     }
 
     String String::toReverseCase() const {
         String str;
         str.len = len;
-        str.value = generate(len);
+        str.coder = UTF16;
+        str.value = str.allocate(str.len, UTF16);
         for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
+            gchar const ch = nextChar(value, coder, i);
             if (Character::isHighSurrogate(ch)) {
-                gchar const ch2 = nextChar(value, i + 1);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 if (Character::isLowSurrogate(ch2)) {
                     gint const codePoint = Character::joinSurrogates(ch, ch2);
                     gint reversedCase = 0;
@@ -730,62 +872,51 @@ namespace core {
                 putChar(str.value, i, reversedCase);
             }
         }
+        str.compact();
         return str;
     }
 
     String String::strip() const {
         gint startIndex = 0;
         for (startIndex = 0; startIndex < len; ++startIndex) {
-            gchar const ch = nextChar(value, startIndex);
+            gchar const ch = nextChar(value, coder, startIndex);
             if (!Character::isSpace(ch))
                 break;
         }
         gint endIndex = 0;
         for (endIndex = len; endIndex > startIndex; --endIndex) {
-            gchar const ch = nextChar(value, endIndex - 1);
+            gchar const ch = nextChar(value, coder, endIndex - 1);
             if (!Character::isSpace(ch))
                 break;
         }
-        String str;
-        str.len = endIndex - startIndex;
-        str.value = generate(str.len);
-        arraycopy(value, startIndex, str.value, 0, str.len);
-        return str;
+        return slice(startIndex, endIndex);
     }
 
     String String::stripLeading() const {
         gint startIndex = 0;
         for (startIndex = 0; startIndex < len; ++startIndex) {
-            gchar const ch = nextChar(value, startIndex);
+            gchar const ch = nextChar(value, coder, startIndex);
             if (!Character::isSpace(ch))
                 break;
         }
         gint const endIndex = len;
-        String str;
-        str.len = endIndex - startIndex;
-        str.value = generate(str.len);
-        arraycopy(value, startIndex, str.value, 0, str.len);
-        return str;
+        return slice(startIndex, endIndex);
     }
 
     String String::stripTrailing() const {
         gint const startIndex = 0;
         gint endIndex = 0;
         for (endIndex = len; endIndex > startIndex; --endIndex) {
-            gchar const ch = nextChar(value, endIndex - 1);
+            gchar const ch = nextChar(value, coder, endIndex - 1);
             if (!Character::isSpace(ch))
                 break;
         }
-        String str;
-        str.len = endIndex - startIndex;
-        str.value = generate(str.len);
-        arraycopy(value, startIndex, str.value, 0, str.len);
-        return str;
+        return slice(startIndex, endIndex);
     }
 
     gbool String::isBlank() const {
         for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
+            gchar const ch = nextChar(value, coder, i);
             if (!Character::isSpace(ch))
                 return false;
         }
@@ -795,12 +926,15 @@ namespace core {
     String String::translateEscape() const {
         String str;
         str.len = len;
-        str.value = generate(len);
+        str.coder = UTF16;
+        str.value = str.allocate(str.len, UTF16);
         gint j = 0;
         for (gint i = 0; i < len; ++i) {
-            gchar ch = nextChar(value, i);
+            gchar ch = nextChar(value, coder, i);
             if (ch == '\\') {
-                ch = nextChar(value, i += 1);
+                if (i + 1 == len)
+                    IllegalArgumentException("Invalid escape at end of input").throws(__trace("core.String"));
+                ch = nextChar(value, coder, i += 1);
                 switch (ch) {
                     case 'a':
                         putChar(str.value, j++, '\a');
@@ -843,111 +977,71 @@ namespace core {
                     case '5':
                     case '6':
                     case '7': {
-                        // octal escape
-                        gint const lim = Integer::min(i + (ch <= '3' ? 2 : 1), len);
+                        // octal escape (the next octal digits are part of escape)
+                        gint const lim = Integer::min(i + (ch <= '3' ? 2 : 1), len - 1);
                         gint octalCode = ch - '0';
                         while (i < lim) {
-                            i += 1;
-                            ch = nextChar(value, i);
+                            ch = nextChar(value, coder, i + 1);
                             if (ch < '0' || ch > '7')
                                 break;
                             octalCode = octalCode * 8 + (ch - '0');
+                            i += 1;
                         }
-                        putChar(value, j++, octalCode);
-                        break;
-                    }
-                    case 'u': {
-                        // unicode 16 escape.
-                        gint const lim = i + 4;
-                        gint escape = 0;
-                        if (lim >= len) {
-                            IllegalArgumentException(
-                                    "Invalid unicode escape on input \"\\" + subString(i) + "\"").throws(
-                                    __trace("core.String"));
-                        }
-                        while (++i < lim) {
-                            ch = nextChar(value, i);
-                            if (ch >= '0' && ch <= '9')
-                                escape = escape * 16 + (ch - '0');
-                            else if (ch >= 'a' && ch <= 'z')
-                                escape = escape * 16 + (ch - 'a' + 10);
-                            else if (ch >= 'A' && ch <= 'Z')
-                                escape = escape * 16 + (ch - 'A' + 10);
-                            else
-                                break;
-                        }
-                        if (i < lim || escape > 0xFFFF)
-                            IllegalArgumentException(
-                                    "Invalid unicode escape on input \"\\u" + Integer::toHexString(escape) +
-                                    "\"").throws(__trace("core.String"));
-                        putChar(value, j++, escape);
+                        putChar(str.value, j++, octalCode);
                         break;
                     }
+                    case 'u':
                     case 'U': {
-                        // unicode 32 escape.
-                        gint const lim = i + 8;
-                        gint escape = 0;
-                        if (lim >= len) {
-                            IllegalArgumentException(
-                                    "Invalid unicode escape on input \"\\" + subString(i) + "\"").throws(
-                                    __trace("core.String"));
-                        }
-                        while (++i < lim) {
-                            ch = nextChar(value, i);
-                            if (ch >= '0' && ch <= '9')
-                                escape = escape * 16 + (ch - '0');
-                            else if (ch >= 'a' && ch <= 'z')
-                                escape = escape * 16 + (ch - 'a' + 10);
-                            else if (ch >= 'A' && ch <= 'Z')
-                                escape = escape * 16 + (ch - 'A' + 10);
-                            else
+                        // unicode escape: \uXXXX (4 hex digits) or \UXXXXXXXX (8 hex digits)
+                        gint const lim = i + (ch == 'u' ? 5 : 9);
+                        gint const maxValue = ch == 'u' ? Character::MAX_VALUE : Character::MAX_CODEPOINT;
+                        glong escape = 0;
+                        gint k = i + 1;
+                        for (; k < lim && k < len; ++k) {
+                            gint const digit = hexDigit(nextChar(value, coder, k));
+                            if (digit < 0)
                                 break;
+                            escape = escape * 16 + digit;
                         }
-                        if (i < lim || escape > 0x10FFFF || escape < 0)
-                            IllegalArgumentException(
-                                    "Invalid unicode escape on input \"\\U" + Integer::toHexString(escape) +
-                                    "\"").throws(__trace("core.String"));
-                        putChar(value, j++, escape);
-                        j += 1;
+                        if (k < lim || escape > maxValue)
+                            IllegalArgumentException("Invalid unicode escape on input \"\\" + subString(i, k) + "\"")
+                                    .throws(__trace("core.String"));
+                        putChar(str.value, j, (gint) escape);
+                        j += charCount((gint) escape);
+                        i = lim - 1;
                         break;
                     }
                     case 'x':
                     case 'X': {
-                        // hex escape
+                        // hex escape: \xX to \xXXXXXXXX (1 to 8 hex digits)
+                        gint const lim = Integer::min(i + 9, len);
                         glong escape = 0;
-                        if (i + 2 >= len)
-                            IllegalArgumentException("Invalid hex escape on input \"\\x" + subString(i) + "\"").throws(
-                                    __trace("core.String"));
-                        gint const startIndex = i;
-                        while (++i < len && escape <= 0x10FFFF) {
-                            ch = nextChar(value, i);
-                            if (ch >= '0' && ch <= '9')
-                                escape = escape * 16 + (ch - '0');
-                            else if (ch >= 'a' && ch <= 'z')
-                                escape = escape * 16 + (ch - 'a' + 10);
-                            else if (ch >= 'A' && ch <= 'Z')
-                                escape = escape * 16 + (ch - 'A' + 10);
-                            else
+                        gint k = i + 1;
+                        for (; k < lim; ++k) {
+                            gint const digit = hexDigit(nextChar(value, coder, k));
+                            if (digit < 0)
                                 break;
-                            i += 1;
+                            escape = escape * 16 + digit;
                         }
-                        if (i - startIndex < 2 || i - startIndex > 8 || escape > 0x10FFFF)
-                            IllegalArgumentException(
-                                    "Invalid hex escape on input \"\\x" + subString(startIndex, i) + "\"")
+                        if (k == i + 1 || escape > Character::MAX_CODEPOINT)
+                            IllegalArgumentException("Invalid hex escape on input \"\\" + subString(i, k) + "\"")
                                     .throws(__trace("core.String"));
-                        putChar(value, j++, (gint) escape);
-                        if (escape > Character::MAX_VALUE)
-                            j += 1;
+                        putChar(str.value, j, (gint) escape);
+                        j += charCount((gint) escape);
+                        i = k - 1;
                         break;
                     }
                     default:
                         IllegalArgumentException("Invalid escape character \\" + String::valueOf(ch))
                                 .throws(__trace("core.String"));
                 }
+            } else {
+                putChar(str.value, j++, ch);
             }
         }
         str.len = j;
         putChar(str.value, j, 0);
+        str.compact();
         return str;
     }
 
@@ -964,35 +1058,33 @@ namespace core {
             MemoryError("Overflow: String length required exceed limit").throws(__trace("core.String"));
         String str;
         str.len = count * len;
-        str.value = generate(str.len);
+        str.coder = coder;
+        str.value = str.allocate(str.len, coder);
         for (gint i = 0; i < count; ++i)
-            arraycopy(value, 0, str.value, i * len, len);
+            arraycopy(value, coder, 0, str.value, coder, i * len, len);
         return str;
     }
 
     gbool String::isASCII() const {
+        if (coder != LATIN1)
+            return false;
         for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
-            if (ch >= 0x80)
+            if (value[i] < 0)
                 return false;
         }
         return true;
     }
 
     gbool String::isLatin1() const {
-        for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
-            if (ch >= 0x100)
-                return false;
-        }
-        return true;
+        // the string is stored with UTF16 coder only if it contains non latin1 chars
+        return coder == LATIN1;
     }
 
     gbool String::isLowerCase() const {
         for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
+            gchar const ch = nextChar(value, coder, i);
             if (Character::isHighSurrogate(ch)) {
-                gchar const ch2 = nextChar(value, i + 1);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 if (Character::isLowSurrogate(ch2)) {
                     gint const cp = Character::joinSurrogates(ch, ch2);
                     if (Character::isLetter(cp) && !Character::isLowerCase(cp))
@@ -1009,9 +1101,9 @@ namespace core {
 
     gbool String::isUpperCase() const {
         for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
+            gchar const ch = nextChar(value, coder, i);
             if (Character::isHighSurrogate(ch)) {
-                gchar const ch2 = nextChar(value, i + 1);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 if (Character::isLowSurrogate(ch2)) {
                     gint const cp = Character::joinSurrogates(ch, ch2);
                     if (Character::isLetter(cp) && !Character::isUpperCase(cp))
@@ -1028,9 +1120,9 @@ namespace core {
 
     gbool String::isTitleCase() const {
         for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
+            gchar const ch = nextChar(value, coder, i);
             if (Character::isHighSurrogate(ch)) {
-                gchar const ch2 = nextChar(value, i + 1);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 if (Character::isLowSurrogate(ch2)) {
                     gint const cp = Character::joinSurrogates(ch, ch2);
                     if (Character::isLetter(cp) && !Character::isTitleCase(cp))
@@ -1048,20 +1140,11 @@ namespace core {
     gint String::count(const String &str) const {
         if (str.len > len || str.isEmpty())
             return 0;
+        if (str.len == 1)
+            return StringCoding::count((glong) value, coder, len, nextChar(str.value, str.coder, 0));
         gint cnt = 0;
-        for (gint i = 0; i < len; ++i) {
-            gbool isFound = true;
-            for (gint j = 0; j < str.len; ++j) {
-                gchar const ch1 = nextChar(value, i + j);
-                gchar const ch2 = nextChar(str.value, j);
-                if (ch1 != ch2) {
-                    isFound = false;
-                    break;
-                }
-            }
-            if (isFound) {
-                cnt += 1;
-            }
+        for (gint i = indexOf(str, 0); i >= 0; i = indexOf(str, i + 1)) {
+            cnt += 1;
         }
         return cnt;
     }
@@ -1077,12 +1160,13 @@ namespace core {
     String String::toPascalCase() const {
         String str;
         str.len = len;
-        str.value = generate(str.len);
+        str.coder = UTF16;
+        str.value = str.allocate(str.len, UTF16);
         gbool start = true;
         for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
+            gchar const ch = nextChar(value, coder, i);
             if (Character::isHighSurrogate(ch)) {
-                gchar const ch2 = nextChar(value, i + 1);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 if (Character::isLowSurrogate(ch2)) {
                     gint const codePoint = Character::joinSurrogates(ch, ch2);
                     gint pascalCase = 0;
@@ -1113,19 +1197,21 @@ namespace core {
                 putChar(str.value, i, pascalCase);
             }
         }
+        str.compact();
         return str;
     }
 
     String String::toCamelCase() const {
         String str;
         str.len = len;
-        str.value = generate(str.len);
+        str.coder = UTF16;
+        str.value = str.allocate(str.len, UTF16);
         gbool start = false;
         gbool start0 = true;
         for (gint i = 0; i < len; ++i) {
-            gchar const ch = nextChar(value, i);
+            gchar const ch = nextChar(value, coder, i);
             if (Character::isHighSurrogate(ch)) {
-                gchar const ch2 = nextChar(value, i + 1);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 if (Character::isLowSurrogate(ch2)) {
                     gint const codePoint = Character::joinSurrogates(ch, ch2);
                     gint camelCase = 0;
@@ -1158,6 +1244,7 @@ namespace core {
                 putChar(str.value, i, camelCase);
             }
         }
+        str.compact();
         return str;
     }
 
@@ -1168,11 +1255,12 @@ namespace core {
     void String::chars(gint srcBegin, gint srcEnd, CharArray &dst, gint dstBegin) const {
         try {
             Preconditions::checkIndexFromRange(srcBegin, srcEnd, len);
+            if (srcBegin == srcEnd)
+                return;
             Preconditions::checkIndex(dstBegin, dst.length());
             Preconditions::checkIndexFromSize(dstBegin, srcEnd - srcBegin, dst.length());
-            for (gint i = srcBegin; i < srcEnd; ++i) {
-                dst[i - srcBegin + dstBegin] = nextChar(value, i);
-            }
+            // the storage of array is contiguous
+            StringCoding::copy((glong) value, coder, srcBegin, (glong) &dst[dstBegin], UTF16, 0, srcEnd - srcBegin);
         } catch (const IndexException &ie) {
             ie.throws(__trace("core.String"));
         }
@@ -1184,28 +1272,37 @@ namespace core {
         return array;
     }
 
+    String::Span String::span(gint startIndex, gint endIndex) const {
+        try {
+            Preconditions::checkIndexFromRange(startIndex, endIndex, len);
+            return Span((glong) value + ((glong) startIndex << coder), endIndex - startIndex, coder);
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.String"));
+        }
+    }
+
     void String::codePoints(gint srcBegin, gint srcEnd, IntArray &dst, gint dstBegin) const {
         try {
             Preconditions::checkIndexFromRange(srcBegin, srcEnd, len);
             Preconditions::checkIndex(dstBegin, dst.length());
             gint count = 0;
             for (gint i = srcBegin; i < srcEnd;) {
-                gchar const ch1 = nextChar(value, i);
-                gchar const ch2 = nextChar(value, i + 1);
+                gchar const ch1 = nextChar(value, coder, i);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 i += Character::isSurrogatePair(ch1, ch2) ? 2 : 1;
                 count += 1;
             }
             Preconditions::checkIndexFromSize(dstBegin, count, dst.length());
             gint j = 0;
-            for (gint i = srcBegin; i < srcEnd; ++i) {
-                gchar const ch1 = nextChar(value, i);
-                gchar const ch2 = nextChar(value, i + 1);
+            for (gint i = srcBegin; i < srcEnd;) {
+                gchar const ch1 = nextChar(value, coder, i);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 if (Character::isSurrogatePair(ch1, ch2)) {
-                    dst[dstBegin - srcBegin + j] = Character::joinSurrogates(ch1, ch2);
+                    dst[dstBegin + j] = Character::joinSurrogates(ch1, ch2);
                     i += 2;
                     j += 1;
                 } else {
-                    dst[dstBegin - srcBegin + j] = ch1;
+                    dst[dstBegin + j] = ch1;
                     i += 1;
                     j += 1;
                 }
@@ -1220,16 +1317,16 @@ namespace core {
         try {
             gint count = 0;
             for (gint i = 0; i < len;) {
-                gchar const ch1 = nextChar(value, i);
-                gchar const ch2 = nextChar(value, i + 1);
+                gchar const ch1 = nextChar(value, coder, i);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 i += Character::isSurrogatePair(ch1, ch2) ? 2 : 1;
                 count += 1;
             }
             array = IntArray(count);
             gint j = 0;
-            for (gint i = 0; i < len; ++i) {
-                gchar const ch1 = nextChar(value, i);
-                gchar const ch2 = nextChar(value, i + 1);
+            for (gint i = 0; i < len;) {
+                gchar const ch1 = nextChar(value, coder, i);
+                gchar const ch2 = nextChar(value, coder, i + 1);
                 if (Character::isSurrogatePair(ch1, ch2)) {
                     array[j++] = Character::joinSurrogates(ch1, ch2);
                     i += 2;
@@ -1249,9 +1346,14 @@ namespace core {
             Preconditions::checkIndexFromRange(srcBegin, srcEnd, len);
             Preconditions::checkIndex(dstBegin, dst.length());
             Preconditions::checkIndexFromSize(dstBegin, srcEnd - srcBegin, dst.length());
-            for (gint i = srcBegin; i < srcEnd; ++i) {
-                dst[i - srcBegin + dstBegin] = (gbyte) (nextChar(value, i) & 0xFF);
-            }
+            if (coder == LATIN1)
+                for (gint i = srcBegin; i < srcEnd; ++i) {
+                    dst[i - srcBegin + dstBegin] = value[i];
+                }
+            else
+                for (gint i = srcBegin; i < srcEnd; ++i) {
+                    dst[i - srcBegin + dstBegin] = (gbyte) (nextChar(value, UTF16, i) & 0xFF);
+                }
         } catch (const IndexException &ie) {
             ie.throws(__trace("core.String"));
         }
@@ -1263,16 +1365,44 @@ namespace core {
         ByteArray array(0);
         try {
             array = ByteArray(len << 1);
-            for (gint i = 0; i < len; i += 1) {
-                array[2 * i + 0] = value[2 * i + 0];
-                array[2 * i + 1] = value[2 * i + 1];
-            }
+            if (coder == LATIN1)
+                // the chars are inflated in native byte order
+                for (gint i = 0; i < len; i += 1) {
+                    array[2 * i + (Unsafe::BIG_ENDIAN ? 1 : 0)] = value[i];
+                    array[2 * i + (Unsafe::BIG_ENDIAN ? 0 : 1)] = 0;
+                }
+            else
+                for (gint i = 0; i < len; i += 1) {
+                    array[2 * i + 0] = value[2 * i + 0];
+                    array[2 * i + 1] = value[2 * i + 1];
+                }
         } catch (const IndexException &ie) {
             ie.throws(__trace("core.String"));
         }
         return array;
     }
 
+    String String::fromUtf8(const gbyte *bytes, glong count) {
+        if (count < 0)
+            IllegalArgumentException("Negative count").throws(__trace("core.String"));
+        if (bytes == null && count > 0)
+            IllegalArgumentException("Null pointer").throws(__trace("core.String"));
+        String str;
+        str.decodeUtf8((glong) bytes, count);
+        return str;
+    }
+
+    gint String::toUtf8(ByteArray &dst) const {
+        glong const length = StringCoding::encodedUtf8Length((glong) value, coder, len);
+        if (length > Integer::MAX_VALUE)
+            MemoryError("Required length exceeds implementation limit").throws(__trace("core.String"));
+        if (dst.length() < length)
+            dst = ByteArray((gint) length);
+        if (length > 0)
+            StringCoding::encodeUtf8((glong) value, coder, len, (glong) &dst[0]);
+        return (gint) length;
+    }
+
     String String::valueOf(const Object &o) {
         return o.toString();
     }
@@ -1328,10 +1458,17 @@ namespace core {
     String::String(const CharArray &chars, gint offset, gint count) {
         try {
             Preconditions::checkIndexFromSize(offset, count, chars.length());
-            value = generate(count);
+            coder = LATIN1;
+            for (gint i = 0; i < count; ++i) {
+                if (!StringCoding::canEncode(chars[i + offset])) {
+                    coder = UTF16;
+                    break;
+                }
+            }
+            value = allocate(count, coder);
             len = count;
             for (gint i = 0; i < count; ++i) {
-                putChar(value, i, chars[i + offset]);
+                StringCoding::putChar((glong) value, coder, i, chars[i + offset]);
             }
         } catch (const IndexException &ie) {
             ie.throws(__trace("core.String"));
@@ -1344,12 +1481,23 @@ namespace core {
         try {
             Preconditions::checkIndexFromSize(offset, count, codePoints.length());
             gint size = 0;
+            coder = LATIN1;
             for (gint i = 0; i < count; ++i) {
                 gint const ch = codePoints[i + offset];
                 size += Character::isValidCodePoint(ch) && Character::isSupplementary(ch) ? 2 : 1;
+                if (!StringCoding::canEncode(ch) && Character::isValidCodePoint(ch))
+                    coder = UTF16;
             }
-            value = generate(size);
+            value = allocate(size, coder);
             len = size;
+            if (coder == LATIN1) {
+                // the invalid code points are replaced by '?'
+                for (gint i = 0; i < count; ++i) {
+                    gint const ch = codePoints[i + offset];
+                    value[i] = StringCoding::canEncode(ch) ? (gbyte) ch : (gbyte) '?';
+                }
+                return;
+            }
             gint j = 0;
             for (gint i = 0; i < count; ++i) {
                 gint const ch = codePoints[i + offset];
@@ -1362,11 +1510,8 @@ namespace core {
     }
 
     String::~String() {
-        if (len > 0) {
-            len = 0;
-            Unsafe::freeMemory((glong) value);
-        }
-        value = null;
+        len = 0;
+        release();
         isHashed = false;
         hashcode = 0;
     }
@@ -7,8 +7,13 @@
 
 #include <core/Comparable.h>
 #include <core/CharSequence.h>
+#include <core/private/Formatter.h>
 
 namespace core {
+
+    class StringView;
+
+    class StringSplitter;
     
     /**
      * The <b> String</b>  class represents character strings. All
@@ -91,10 +96,122 @@ namespace core {
         gint hashcode = {};
 
         /**
-         * The cache for hash, tell if hashcode has been calculated
+         * The cache for hash, tell if the hash code has been calculated
+         * and found to be zero (in which case hashcode is zero too)
          */
         gbool isHashed = false;
 
+        /**
+         * The identifier of the encoding used to store the characters in value.
+         * The supported values are LATIN1 (one byte per char) and UTF16 (two
+         * bytes per char). A String is always stored with the LATIN1 coder when
+         * all its characters are in range [U+0000, U+00FF].
+         */
+        gbyte coder = {};
+
+        /**
+         * The kind of the storage referenced by value:
+         * <ul>
+         * <li><b style="color: orange;"> OWNED</b>: the storage is the inline storage of this
+         *     String (or null for the empty strings).
+         * <li><b style="color: orange;"> INTERNED</b>: the storage is owned by the intern table,
+         *     it is shared by all interned copies of this String and never released.
+         * <li><b style="color: orange;"> SHARED</b>: the storage is a part of reference-counted
+         *     heap block, shared by the copies of this String and by its sub-strings. The
+         *     address of this block is kept in the first slot of the inline storage (that
+         *     is unused in this case).
+         * <li><b style="color: orange;"> STATIC</b>: the storage is a static storage (string
+         *     literal, or part of interned storage), shared by the copies of this String and
+         *     never released.
+         * </ul>
+         */
+        gbyte kind = {};
+
+        static CORE_FAST gbyte OWNED = 0;
+        static CORE_FAST gbyte INTERNED = 1;
+        static CORE_FAST gbyte SHARED = 2;
+        static CORE_FAST gbyte STATIC = 3;
+
+        /**
+         * The minimum part (1/VIEW_RATIO) of the heap block that a sub-string must cover to share
+         * the storage of its parent. The smaller sub-strings are copied, such that a small
+         * sub-string never keeps alive a much larger storage.
+         */
+        static CORE_FAST gint VIEW_RATIO = 4;
+
+        /**
+         * The size (in bytes) of the inline storage. It can hold up to 15 LATIN1
+         * chars or 7 UTF16 chars (plus the null terminator).
+         */
+        static CORE_FAST gint INLINE_SIZE = 16;
+
+        /**
+         * The number of latin1 chars inflated at once by forEachChunk.
+         */
+        static CORE_FAST gint CHUNK_SIZE = 256;
+
+        /**
+         * The inline storage used by the short strings. When the characters of
+         * this String fit in this storage, value points to it and the copies and
+         * moves of this String never use the allocator.
+         */
+        glong buffer[INLINE_SIZE >> 3] = {};
+
+        /**
+         * Return the storage of count characters with the given coder, with
+         * the null terminator. The inline storage of this String is returned
+         * for the short strings, and a new shared heap block (referenced only by
+         * this String) is returned otherwise.
+         */
+        STORAGE allocate(gint count, gbyte coder);
+
+        /**
+         * Release the storage of this String. The shared heap block is freed when
+         * this String is its last reference.
+         */
+        void release();
+
+        /**
+         * Make this empty String reference the storage of the given String
+         * (from the given char, on count chars).
+         */
+        void share(const String &str, gint offset, gint count);
+
+        /**
+         * Return the sub-string of this String in range [startIndex, endIndex) (already checked).
+         * The sub-string shares the storage of this String if possible.
+         */
+        String slice(gint startIndex, gint endIndex) const;
+
+        /**
+         * Exchange the content of this String with the content of the given String.
+         */
+        void exchange(String &str) CORE_NOTHROW;
+
+        /**
+         * Initialize this empty String with the given characters. The characters
+         * are copied with the most compact coder.
+         */
+        void assign(glong address, gbyte srcCoder, gint count);
+
+        /**
+         * Initialize this empty String with the characters decoded from the given
+         * UTF-8 bytes.
+         */
+        void decodeUtf8(glong address, glong count);
+
+        /**
+         * Return this String converted to upper case (if upper is true) or to lower case
+         * (otherwise). This String is returned if no char is changed by the conversion.
+         */
+        String convertCase(gbool upper) const;
+
+        /**
+         * Store the characters of this String with the LATIN1 coder if possible.
+         * This method is called after the build of a String with the UTF16 coder.
+         */
+        void compact();
+
         /**
          * This method is called only by String constructor
          */
@@ -105,8 +222,28 @@ namespace core {
          */
         void wrap(glong address, gint bytesPerChar, glong nbChars, gint offset, gint limit);
 
+        /**
+         * Return the String of the given string literal (static storage of count chars, with
+         * the given number of bytes per char). The literals already stored with the most
+         * compact coder are referenced directly (without copy). The other literals are
+         * converted on their first use only, their interned storage is reused for
+         * the next uses.
+         */
+        static String literal(glong address, gint bytesPerChar, gint count);
+
         friend class StringBuffer;
 
+        friend class StringView;
+
+        friend class StringRope;
+
+        friend class native::Formatter;
+
+        friend String operator ""_S(const char[], size_t);
+        friend String operator ""_S(const char16_t[], size_t);
+        friend String operator ""_S(const char32_t[], size_t);
+        friend String operator ""_S(const wchar_t[], size_t);
+
     public:
 
         /**
@@ -517,9 +654,45 @@ namespace core {
          * </pre></blockquote>
          * using gint arithmetic, where s[i] is the <i>i</i>th character of the string, n is the length of
          * the string, and ^ indicates exponentiation. (The hash value of the empty string is zero.)
+         *
+         * <p>The hash code is computed once, and cached for the next calls.
          */
         gint hash() const override;
 
+        /**
+         * Returns a 64-bit hash code for this string, computed with the given seed.
+         * Unlike the method hash, the value returned by this method depends on the seed
+         * and it is not cached. The hash tables use this method with a per-process seed,
+         * such that the collisions of their keys cannot be predicted.
+         *
+         * <p>Two equal strings always have the same 64-bit hash code for the same seed.
+         *
+         * @param seed
+         *          The seed of hash function
+         */
+        glong hash64(glong seed) const;
+
+        /**
+         * Returns a canonical representation for the string object.
+         * <p>
+         * A pool of strings, initially empty, is maintained privately by the
+         * class String.
+         * <p>
+         * When the intern method is invoked, if the pool already contains a
+         * string equal to this String object as determined by
+         * the equals(Object) method, then the string from the pool is
+         * returned. Otherwise, this String object is added to the
+         * pool and a reference to this String object is returned.
+         * <p>
+         * All interned strings equal to each other share the same storage: their
+         * copies never allocate memory, and their comparison (with equals or compareTo)
+         * is done in constant time. The interned strings are never removed from the pool.
+         *
+         * @return  a string that has the same contents as this string, but is
+         *          guaranteed to be from a pool of unique strings.
+         */
+        String intern() const;
+
         /**
          * Returns the index within this string of the first occurrence of the specified character.
          * If a character with value ch occurs in the character sequence represented by this String
@@ -686,6 +859,40 @@ namespace core {
          */
         gint lastIndexOf(const String &str, gint startIndex) const;
 
+        /**
+         * Returns true if and only if this string contains the specified
+         * substring.
+         *
+         * @param str the substring to search for
+         */
+        gbool contains(const String &str) const;
+
+        /**
+         * Returns the iterator over the parts of this string separated by the given
+         * character, as views of this string (without allocation). A string with n
+         * occurrences of the character has n + 1 parts, including the empty parts.
+         * The search of the character uses the vector instructions when available.
+         *
+         * <p>This string must not be destroyed while the iterator (or its views) is used.
+         * The declaration of StringSplitter is in header <core/StringView.h>.
+         *
+         * @param ch
+         *          The delimiter (Unicode code point)
+         */
+        StringSplitter splitView(gint ch) const;
+
+        /**
+         * Returns the iterator over the parts of this string separated by the given
+         * delimiter, as views of this string (without allocation).
+         *
+         * @param delimiter
+         *          The delimiter
+         *
+         * @throws IllegalArgumentException if the delimiter is empty
+         * @see splitView(gint)
+         */
+        StringSplitter splitView(const String &delimiter) const;
+
         /**
          * Returns a string that is a substring of this string. The
          * substring begins with the character at the specified index and
@@ -718,6 +925,10 @@ namespace core {
          * "smiles"_S.substring(1, 5) returns "mile"
          * </pre></blockquote>
          *
+         * <p>
+         * The returned string shares the characters of this string (without copy) when it
+         * covers a large enough part of them. The short and small sub-strings are copied.
+         *
          * @param      startIndex   the beginning index, inclusive.
          * @param      endIndex     the ending index, exclusive.
          *
@@ -1025,8 +1236,9 @@ namespace core {
          *   </tbody>
          * </table>
          *
-         * @implNote
-         * This method does <em>not</em> translate Unicode escapes such as "\\u2022".
+         * <p>The unicode escapes "\\uXXXX" (four hexadecimal digits), "\\UXXXXXXXX"
+         * (eight hexadecimal digits) and the hexadecimal escapes "\\xX" to "\\xXXXXXXXX"
+         * (one to eight hexadecimal digits) are also translated.
          *
          * @throws IllegalArgumentException when an escape sequence is malformed.
          */
@@ -1131,6 +1343,132 @@ namespace core {
          */
         CharArray chars() const;
 
+        /**
+         * A <b> Span</b> is the read-only view of the code units of a String, as they are
+         * stored: one byte per char (for the strings stored with the LATIN1 coder), or one
+         * gchar per char (UTF-16 code units).
+         *
+         * <p>A span never copies, nor allocates. It is valid only while its String lives
+         * (and is not modified).
+         *
+         * <p>
+         * Example:
+         * <blockquote><pre>
+         * String::Span const span = str.span();
+         * if (span.isLatin1())
+         *     write(span.latin1(), span.length());
+         * else
+         *     write(span.utf16(), span.length());
+         * </pre></blockquote>
+         *
+         * @see String.span
+         * @see String.forEachChunk
+         */
+        class Span CORE_FINAL {
+        private:
+            glong address = {};
+            gint count = {};
+            gbyte coder = {};
+
+            CORE_FAST Span(glong address, gint count, gbyte coder) : address(address), count(count), coder(coder) {}
+
+            friend String;
+
+        public:
+            /**
+             * Construct new empty span.
+             */
+            CORE_FAST Span() = default;
+
+            /**
+             * Return the number of code units of this span.
+             */
+            CORE_FAST gint length() const { return count; }
+
+            /**
+             * Return true if this span has no code units.
+             */
+            CORE_FAST gbool isEmpty() const { return count == 0; }
+
+            /**
+             * Return true if the code units of this span are stored with one byte per char
+             * (the latin1 chars).
+             */
+            CORE_FAST gbool isLatin1() const { return coder == 0; }
+
+            /**
+             * Return the code units of this span (one byte per latin1 char), or null if this
+             * span is stored with UTF-16 code units.
+             */
+            const gbyte *latin1() const { return (const gbyte *) (coder == 0 ? address : 0); }
+
+            /**
+             * Return the UTF-16 code units of this span, or null if this span is stored with
+             * one byte per char (see latin1).
+             */
+            const gchar *utf16() const { return (const gchar *) (coder == 0 ? 0 : address); }
+
+            /**
+             * Return the char at the given index of this span (the index is not checked).
+             */
+            gchar operator[](gint index) const {
+                return coder == 0 ? (gchar) (((const gbyte *) address)[index] & 0xFF)
+                                  : ((const gchar *) address)[index];
+            }
+        };
+
+        /**
+         * Return the read-only view of the code units of this String (without copy).
+         */
+        Span span() const { return Span((glong) value, len, coder); }
+
+        /**
+         * Return the read-only view of the code units of this String in range
+         * [startIndex, endIndex) (without copy).
+         *
+         * @param startIndex
+         *          The index of first char
+         * @param endIndex
+         *          The index after the last char
+         * @throws IndexException if startIndex is negative, or greater than endIndex,
+         *          or endIndex is greater than the length of this String.
+         */
+        Span span(gint startIndex, gint endIndex) const;
+
+        /**
+         * Perform the given action on the characters of this String, given by contiguous
+         * ranges of UTF-16 code units: the action is called as <b> action(const gchar *chars,
+         * gint count)</b>. The strings stored with UTF-16 code units are given in one range
+         * (without copy), the latin1 strings are inflated on the stack by chunks of 256 chars.
+         * No memory is allocated.
+         *
+         * <p>
+         * Example:
+         * <blockquote><pre>
+         * str.forEachChunk([&](const gchar *chars, gint count) {
+         *     writer.write(chars, count);
+         * });
+         * </pre></blockquote>
+         *
+         * @param action
+         *          The action called on each range of characters
+         */
+        template<class Action>
+        void forEachChunk(Action &&action) const {
+            if (coder != 0) {
+                if (len > 0)
+                    action((const gchar *) value, len);
+                return;
+            }
+            gchar chars[CHUNK_SIZE];
+            for (gint i = 0; i < len; i += CHUNK_SIZE) {
+                gint const count = len - i < CHUNK_SIZE ? len - i : CHUNK_SIZE;
+                for (gint j = 0; j < count; ++j)
+                    chars[j] = (gchar) (value[i + j] & 0xFF);
+                action((const gchar *) chars, count);
+            }
+        }
+
         /**
          * Copies code points from this string into the destination gint
          * root.
@@ -1215,6 +1553,35 @@ namespace core {
          */
         ByteArray bytes() const;
 
+        /**
+         * Return the String decoded from the given UTF-8 bytes. The malformed sequences
+         * (the invalid bytes, the truncated sequences, the overlong sequences and the encoded
+         * surrogates) are decoded as '?'.
+         *
+         * <p>The bytes are validated and decoded with the vector instructions (when enabled):
+         * the blocks of ASCII bytes are copied at once, and the chars are decoded directly
+         * with the most compact coder.
+         *
+         * @param bytes
+         *          The UTF-8 bytes
+         * @param count
+         *          The number of bytes
+         * @throws IllegalArgumentException if count is negative, or bytes is null
+         *          while count is positive.
+         */
+        static String fromUtf8(const gbyte *bytes, glong count);
+
+        /**
+         * Encode this String in UTF-8 into the given array (from index 0), and return the number
+         * of written bytes. The given array is reused if it is large enough, otherwise it is
+         * replaced by a new array of the exact length. The lone surrogates are encoded as '?'.
+         *
+         * @param dst
+         *          The destination array
+         * @return the number of bytes of this String encoded in UTF-8
+         */
+        gint toUtf8(ByteArray &dst) const;
+
         /**
          * Return String representation of specified object.
          * @param obj the object
@@ -1291,6 +1658,64 @@ namespace core {
          */
         static String valueOf(const String &str);
 
+        /**
+         * Return the String formatted with the given format and arguments.
+         *
+         * <p>The format contains fixed text and format specifiers, with the syntax
+         * <b> %[argument_index$][flags][width][.precision]conversion</b> (see Formatter).
+         * The arguments may be booleans, characters, integers, floating-point values,
+         * string literals or objects (formatted with their method toString).
+         *
+         * <p>The arguments are never copied, and the characters are written directly
+         * to the storage of the result: the result is built with only one allocation
+         * (while it contains at most 256 characters).
+         *
+         * <p>
+         * Example:
+         * <blockquote><pre>
+         * String::format("%s: %5d items (%.2f%%)"_S, name, count, ratio * 100);
+         * String::format("0x%08X"_S, address);
+         * </pre></blockquote>
+         *
+         * @param format
+         *          The format string
+         * @param args
+         *          The arguments referenced by the format specifiers
+         * @throws IllegalArgumentException if the format is illegal, or incompatible with
+         *          the given arguments.
+         */
+        template<class... Args>
+        static String format(const String &format, Args &&...args) {
+            native::Formatter::Argument const argv[] = {native::Formatter::Argument(args)...,
+                                                         native::Formatter::Argument()};
+            return native::Formatter::format(format, argv, (gint) sizeof...(Args));
+        }
+
+        /**
+         * Write in the given array (from the given offset) the characters formatted with
+         * the given format and arguments (see String.format). No memory is allocated,
+         * except for the objects converted with toString.
+         *
+         * @param dst
+         *          The destination array
+         * @param offset
+         *          The index of the first written character
+         * @param format
+         *          The format string
+         * @param args
+         *          The arguments referenced by the format specifiers
+         * @return the number of written characters
+         * @throws IllegalArgumentException if the format is illegal, or incompatible with
+         *          the given arguments.
+         * @throws IndexException if the formatted characters exceed the array.
+         */
+        template<class... Args>
+        static gint formatTo(CharArray &dst, gint offset, const String &format, Args &&...args) {
+            native::Formatter::Argument const argv[] = {native::Formatter::Argument(args)...,
+                                                        native::Formatter::Argument()};
+            return native::Formatter::format(dst, offset, format, argv, (gint) sizeof...(Args));
+        }
+
         friend String operator+(const String &x, const String &y);
 
         String &operator+=(const String &str);
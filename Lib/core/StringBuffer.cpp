@@ -13,6 +13,9 @@
 #include <core/Integer.h>
 #include <core/Math.h>
 #include <core/private/Null.h>
+#include <core/private/StringCoding.h>
+#include <core/private/DoubleToDecimal.h>
+#include <core/private/IntegerToChars.h>
 
 namespace core {
 
@@ -23,106 +26,140 @@ namespace core {
     CORE_ALIAS(PCBYTE, typename Class<const gbyte>::Ptr);
     namespace {
 
-        CORE_FAST glong alignToHeapWordSize(glong bytes) {
-            return bytes >= 0 ? (bytes + Unsafe::ADDRESS_SIZE - 1) & ~(Unsafe::ADDRESS_SIZE - 1) : -1;
-        }
-
+        CORE_FAST gbyte LATIN1 = StringCoding::LATIN1;
+        CORE_FAST gbyte UTF16 = StringCoding::UTF16;
 
-        void putChar(PBYTE dst, glong idx, gchar ch) {
-            glong const index = idx * 2LL;
-            if (ch == 0) {
-                dst[index + 0L] = dst[index + 1L] = 0;
-                return;
-            }
-            gbyte const hb = Character::highByte(ch);
-            gbyte const lb = Character::lowByte(ch);
-            if (Unsafe::BIG_ENDIAN) {
-                dst[index] = hb;
-                dst[index + 1LL] = lb;
-            } else {
-                dst[index] = lb;
-                dst[index + 1LL] = hb;
-            }
+        void putChar(PBYTE dst, gbyte coder, glong idx, gchar ch) {
+            StringCoding::putChar((glong) dst, coder, idx, ch);
         }
 
-        void putChar(PBYTE dst, glong idx, gint cp) {
+        void putChar(PBYTE dst, gbyte coder, glong idx, gint cp) {
             if ((dst == null) || idx < 0)
                 return;
             if (cp < 0 || cp > Character::MAX_CODEPOINT) {
-                putChar(dst, idx, u'?');
+                putChar(dst, coder, idx, u'?');
             } else if (cp > Character::MAX_VALUE) {
+                // assert coder == UTF16
                 const gchar high = Character::highSurrogate(cp);
                 const gchar low = Character::lowSurrogate(cp);
-                putChar(dst, idx, high);
-                putChar(dst, idx + 1LL, low);
+                putChar(dst, coder, idx, high);
+                putChar(dst, coder, idx + 1LL, low);
             } else {
-                putChar(dst, idx, (gchar) cp);
+                putChar(dst, coder, idx, (gchar) cp);
             }
         }
 
-        gchar nextChar(PCBYTE src, glong idx) {
+        gchar nextChar(PCBYTE src, gbyte coder, glong idx) {
             if (src == null || idx < 0)
                 return Character::MIN_VALUE;
-            glong const index = idx * 2LL;
-            if (Unsafe::BIG_ENDIAN)
-                return Character::joinBytes(src[index], src[index + 1]);
-            else
-                return Character::joinBytes(src[index + 1], src[index]);
+            return StringCoding::getChar((glong) src, coder, idx);
         }
 
-        PBYTE generate(gint count) {
+        PBYTE generate(gint count, gbyte coder) {
             if (count <= 0) return null;
-            glong const sizeInBytes = (count + 1LL) << 1;
-            const glong heapSize = alignToHeapWordSize(sizeInBytes);
+            glong const sizeInBytes = (count + 1LL) << coder;
             PBYTE address = (PBYTE) Unsafe::allocateMemory(sizeInBytes);
             return address;
         }
 
+        /**
+         * Return the coder necessary to store the given character
+         */
+        gbyte coderOf(gint ch) {
+            return StringCoding::canEncode(ch) ? LATIN1 : UTF16;
+        }
+
+        /**
+         * Return the coder necessary to store the given chars
+         */
+        gbyte coderOf(const CharArray &chars, gint offset, gint length) {
+            for (gint i = 0; i < length; ++i) {
+                if (!StringCoding::canEncode(chars[i + offset]))
+                    return UTF16;
+            }
+            return LATIN1;
+        }
 
         gint charCount(gint ch) {
             return Character::isSupplementary(ch) && Character::isValidCodePoint(ch) ? 2 : 1;
         }
 
-        void arraycopy(PCBYTE src, gint offset1, PBYTE dst, gint offset2, gint count) {
-            if (src == null || dst == null || count == 0 || offset1 < 0 || offset2 < 0) {
+        void arraycopy(PCBYTE src, gbyte srcCoder, gint offset1, PBYTE dst, gbyte dstCoder, gint offset2, gint count) {
+            if (src == null || dst == null || count <= 0 || offset1 < 0 || offset2 < 0) {
                 return;
             }
-            glong const maxCount = count * 2LL;
-            glong const maxOffset1 = offset1 * 2LL;
-            glong const maxOffset2 = offset2 * 2LL;
-            if (count > 0)
-                for (glong i = maxCount - 1; i >= 0; i -= 1) {
-                    dst[i + maxOffset2] = src[i + maxOffset1];
-                }
-            else
-                for (glong i = maxCount + 1; i <= 0; i += 1) {
-                    dst[-i + maxOffset2] = src[-i + maxOffset1];
-                }
+            StringCoding::copy((glong) src, srcCoder, offset1, (glong) dst, dstCoder, offset2, count);
         }
     }
 
     StringBuffer::StringBuffer(gint capacity) {
         if (capacity < 0) IllegalArgumentException("Negative capacity").throws(__trace("core.StringBuffer"));
-        value = generate(cap = capacity);
+        value = allocate(cap = capacity, LATIN1);
         len = 0;
+        coder = LATIN1;
     }
 
     gint StringBuffer::newCapacity(gint minCapacity) const {
         gint const oldLength = cap;
-        gint const newLength = minCapacity << 1;
-        gint const growth = newLength - oldLength;
-        gint const length = ArraysSupport::newLength(oldLength, growth, oldLength + 2);
+        // the capacity grows geometrically, such that the appends are amortized in constant time
+        gint const length = ArraysSupport::newLength(oldLength, minCapacity - oldLength, oldLength + 2);
         if (length == Integer::MAX_VALUE)
             MemoryError("Required length exceeds implementation limit").throws(__trace("core.StringBuffer"));
         return length;
     }
 
     void StringBuffer::shift(gint offset, gint count) {
-        return arraycopy(value, offset, value, offset + count, len - count);
+        // when count is positive, the new chars are already counted in len (shift after resize),
+        // otherwise the removed chars are still counted in len (shift before resize).
+        gint const n = count > 0 ? len - count - offset : len - offset;
+        return arraycopy(value, coder, offset, value, coder, offset + count, n);
+    }
+
+    void StringBuffer::inflate(gbyte newCoder) {
+        if (newCoder <= coder)
+            return;
+        if (value != null) {
+            // the inline storage is inflated in place when it is large enough
+            PBYTE newValue = allocate(cap, UTF16);
+            StringCoding::inflate((glong) value, (glong) newValue, len);
+            release(value);
+            value = newValue;
+        }
+        coder = UTF16;
+    }
+
+    StringBuffer::STORAGE StringBuffer::allocate(gint capacity, gbyte coder) {
+        if (capacity <= 0)
+            return null;
+        if (((capacity + 1LL) << coder) > INLINE_SIZE)
+            return generate(capacity, coder);
+        return (STORAGE) buffer;
+    }
+
+    void StringBuffer::release(STORAGE storage) {
+        if (storage != null && storage != (STORAGE) buffer)
+            Unsafe::freeMemory((glong) storage);
+    }
+
+    void StringBuffer::exchange(StringBuffer &sb) CORE_NOTHROW {
+        gbool const isInline = value == (STORAGE) buffer;
+        gbool const isInline2 = sb.value == (STORAGE) sb.buffer;
+        for (gint i = 0; i < (INLINE_SIZE >> 3); ++i)
+            Unsafe::swapValues(buffer[i], sb.buffer[i]);
+        Unsafe::swapValues(cap, sb.cap);
+        Unsafe::swapValues(value, sb.value);
+        Unsafe::swapValues(len, sb.len);
+        Unsafe::swapValues(coder, sb.coder);
+        // the inline storages has been exchanged, the pointers must follow them
+        if (isInline2)
+            value = (STORAGE) buffer;
+        if (isInline)
+            sb.value = (STORAGE) sb.buffer;
     }
 
     StringBuffer::StringBuffer(const String &str) :
-            StringBuffer(Math::max(str.length() + DEFAULT_CAPACITY, Integer::MAX_VALUE)) { append(str); }
+            StringBuffer(str.length() < Integer::MAX_VALUE - DEFAULT_CAPACITY ? str.length() + DEFAULT_CAPACITY
+                                                                              : Integer::MAX_VALUE) { append(str); }
 
     StringBuffer::StringBuffer(const StringBuffer &sb) :
             StringBuffer(Math::max(sb.length(), DEFAULT_CAPACITY)) {
@@ -130,33 +167,30 @@ namespace core {
     }
 
     StringBuffer::StringBuffer(StringBuffer &&sb) CORE_NOTHROW {
-        Unsafe::swapValues(cap, sb.cap);
-        Unsafe::swapValues(value, sb.value);
-        Unsafe::swapValues(len, sb.len);
+        exchange(sb);
     }
 
     StringBuffer &StringBuffer::operator=(const StringBuffer &sb) {
         if (this != &sb) {
             gint const sbSize = sb.length();
+            inflate(sb.coder);
             if (cap >= sbSize) {
                 // setValue all trailing characters to null (U+0000)
                 for (gint i = sbSize, limit = len; i < limit; ++i) {
-                    putChar(value, i, 0);
+                    putChar(value, coder, i, (gchar) 0);
                 }
                 len = sbSize;
             } else {
                 resize(sbSize);
             }
-            arraycopy(sb.value, 0, value, 0, sbSize);
+            arraycopy(sb.value, sb.coder, 0, value, coder, 0, sbSize);
         }
         return *this;
     }
 
     StringBuffer &StringBuffer::operator=(StringBuffer &&sb) CORE_NOTHROW {
         if (this != &sb) {
-            Unsafe::swapValues(cap, sb.cap);
-            Unsafe::swapValues(value, sb.value);
-            Unsafe::swapValues(len, sb.len);
+            exchange(sb);
         }
         return *this;
     }
@@ -168,10 +202,10 @@ namespace core {
         else if (newLength > cap) {
             try {
                 gint const newCapacity = StringBuffer::newCapacity(newLength);
-                PBYTE newValue = generate(newCapacity);
-                arraycopy(value, 0, newValue, 0, len);
-                Unsafe::freeMemory((glong) value);
-                cap = newLength;
+                PBYTE newValue = allocate(newCapacity, coder);
+                arraycopy(value, coder, 0, newValue, coder, 0, len);
+                release(value);
+                cap = newCapacity;
                 value = newValue;
             } catch (const MemoryError &me) {
                 me.throws(__trace("core.StringBuffer"));
@@ -179,17 +213,21 @@ namespace core {
             }
         } else if (newLength < len) {
             for (int i = newLength, limit = len; i < limit; i += 1) {
-                putChar(value, i, 0);
+                putChar(value, coder, i, (gchar) 0);
             }
         }
+        // the spare capacity is not initialized
+        for (int i = len; i < newLength; i += 1) {
+            putChar(value, coder, i, (gchar) 0);
+        }
         len = newLength;
     }
 
     void StringBuffer::truncate() {
         if (len < cap) {
-            PBYTE newValue = generate(len);
-            arraycopy(value, 0, newValue, 0, len);
-            Unsafe::freeMemory((glong) value);
+            PBYTE newValue = allocate(len, coder);
+            arraycopy(value, coder, 0, newValue, coder, 0, len);
+            release(value);
             value = newValue;
             cap = len;
         }
@@ -198,15 +236,17 @@ namespace core {
     gchar StringBuffer::charAt(gint index) const {
         try {
             Preconditions::checkIndex(index, length());
-            return nextChar(value, index);
+            return nextChar(value, coder, index);
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
 
     gint StringBuffer::codePointAt(gint index) const {
         try {
             Preconditions::checkIndex(index, length());
-            gchar const ch1 = nextChar(value, index);
-            gchar const ch2 = nextChar(value, index + 1);
+            gchar const ch1 = nextChar(value, coder, index);
+            if (index + 1 == len)
+                return ch1;
+            gchar const ch2 = nextChar(value, coder, index + 1);
             return Character::isSurrogatePair(ch1, ch2) ? Character::joinSurrogates(ch1, ch2) : ch1;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -214,7 +254,8 @@ namespace core {
     void StringBuffer::set(gint index, gchar ch) {
         try {
             Preconditions::checkIndex(index, length());
-            putChar(value, index, ch);
+            inflate(coderOf(ch));
+            putChar(value, coder, index, ch);
         } catch (const Exception &ex) { ex.throws(__trace("core.StringBuffer")); }
     }
 
@@ -222,10 +263,10 @@ namespace core {
         if (&null == &obj) {
             gint const oldLen = len;
             resize(length() + 4);
-            putChar(value, oldLen + 0, 'n');
-            putChar(value, oldLen + 1, 'u');
-            putChar(value, oldLen + 2, 'l');
-            putChar(value, oldLen + 3, 'l');
+            putChar(value, coder, oldLen + 0, 'n');
+            putChar(value, coder, oldLen + 1, 'u');
+            putChar(value, coder, oldLen + 2, 'l');
+            putChar(value, coder, oldLen + 3, 'l');
             return *this;
         } else if (Class<String>::hasInstance(obj)) return append((const String &) obj);
         else if (Class<StringBuffer>::hasInstance(obj)) return append((const StringBuffer &) obj);
@@ -234,15 +275,18 @@ namespace core {
 
     StringBuffer &StringBuffer::append(const String &str) {
         gint const oldLen = len;
+        inflate(str.coder);
         resize(len + str.length());
-        arraycopy(str.value, 0, value, oldLen, str.length());
+        arraycopy(str.value, str.coder, 0, value, coder, oldLen, str.length());
         return *this;
     }
 
     StringBuffer &StringBuffer::append(const StringBuffer &sb) {
         gint const oldLen = len;
-        resize(len + sb.length());
-        arraycopy(sb.value, 0, value, oldLen, sb.length());
+        gint const sbLen = sb.length();
+        inflate(sb.coder);
+        resize(len + sbLen);
+        arraycopy(sb.value, sb.coder, 0, value, coder, oldLen, sbLen);
         return *this;
     }
 
@@ -250,107 +294,80 @@ namespace core {
         gint const oldLen = len;
         if (b) {
             resize(len + 4);
-            putChar(value, oldLen + 0, 't');
-            putChar(value, oldLen + 1, 'r');
-            putChar(value, oldLen + 2, 'u');
-            putChar(value, oldLen + 3, 'e');
+            putChar(value, coder, oldLen + 0, 't');
+            putChar(value, coder, oldLen + 1, 'r');
+            putChar(value, coder, oldLen + 2, 'u');
+            putChar(value, coder, oldLen + 3, 'e');
         } else {
             resize(len + 5);
-            putChar(value, oldLen + 0, 'f');
-            putChar(value, oldLen + 1, 'a');
-            putChar(value, oldLen + 2, 'l');
-            putChar(value, oldLen + 3, 's');
-            putChar(value, oldLen + 4, 'e');
+            putChar(value, coder, oldLen + 0, 'f');
+            putChar(value, coder, oldLen + 1, 'a');
+            putChar(value, coder, oldLen + 2, 'l');
+            putChar(value, coder, oldLen + 3, 's');
+            putChar(value, coder, oldLen + 4, 'e');
         }
         return *this;
     }
 
     StringBuffer &StringBuffer::append(gchar ch) {
         gint const oldLen = len;
+        inflate(coderOf(ch));
         resize(len + 1);
-        putChar(value, oldLen + 0, ch);
+        putChar(value, coder, oldLen + 0, ch);
         return *this;
     }
 
     StringBuffer &StringBuffer::appendCodePoint(gint codePoint) {
         gint const oldLen = len;
+        inflate(coderOf(codePoint));
         resize(len + charCount(codePoint));
-        putChar(value, oldLen + 0, codePoint);
+        putChar(value, coder, oldLen + 0, codePoint);
         return *this;
     }
 
     StringBuffer &StringBuffer::append(gint i) {
-        gint const oldLen = len;
-        // check number of chars necessary
-        gint offset = i < 0 ? 1 : 0;
-        gint a = Math::abs(i);
-        do {
-            offset++;
-            a /= 10;
-        } while (a > 0);
-        resize(len + offset);
-        a = Math::abs(i);
-        do {
-            offset -= 1;
-            putChar(value, oldLen + offset, (a % 10) + '0');
-            a /= 10;
-        } while (a > 0);
-        if (i < 0)
-            putChar(value, oldLen + 0, '-');
-        return *this;
+        return append((glong) i);
     }
 
     StringBuffer &StringBuffer::append(glong l) {
         gint const oldLen = len;
-        // check number of chars necessary
-        gint offset = l < 0 ? 1 : 0;
-        glong a = Math::abs(l);
-        do {
-            offset++;
-            a /= 10;
-        } while (a > 0);
-        resize(len + offset);
-        a = Math::abs(l);
-        do {
-            offset -= 1;
-            putChar(value, oldLen + offset, (gint) (a % 10) + '0');
-            a /= 10;
-        } while (a > 0);
-        if (l < 0)
-            putChar(value, oldLen + 0, '-');
+        gbyte chars[IntegerToChars::MAX_CHARS];
+        gint const count = IntegerToChars::toChars(l, 10, (glong) chars);
+        resize(len + count);
+        StringCoding::copy((glong) chars, LATIN1, 0, (glong) value, coder, oldLen, count);
         return *this;
     }
 
     StringBuffer &StringBuffer::appendUnsigned(gint i) {
-        return append(i > 0 ? i : Integer::toUnsignedLong(i));
+        return appendUnsigned(Integer::toUnsignedLong(i));
     }
 
-#define CORE_AS_UNSIGNED_LONG(a) ((a) & 0xFFFFFFFFFFFFFFFFLL)
-
     StringBuffer &StringBuffer::appendUnsigned(glong l) {
         gint const oldLen = len;
-        if (l > 0)
-            return append(l);
-        gint offset = 0;
-        glong a = l;
-        while (a != 0) {
-            offset++;
-            a = CORE_AS_UNSIGNED_LONG(a) / 10;
-        }
-        resize(len + offset);
-        a = Math::abs(l);
-        do {
-            offset -= 1;
-            putChar(value, oldLen + offset, (gint) (CORE_AS_UNSIGNED_LONG(a) % 10) + '0');
-            a = CORE_AS_UNSIGNED_LONG(a) / 10;
-        } while (a > 0);
-
+        gbyte chars[IntegerToChars::MAX_CHARS];
+        gint const count = IntegerToChars::toUnsignedChars(l, 10, (glong) chars);
+        resize(len + count);
+        StringCoding::copy((glong) chars, LATIN1, 0, (glong) value, coder, oldLen, count);
         return *this;
     }
 
-    StringBuffer &StringBuffer::append(gfloat f) { return append(String::valueOf(f)); }
+    StringBuffer &StringBuffer::append(gfloat f) {
+        gint const oldLen = len;
+        gbyte chars[DoubleToDecimal::MAX_FLOAT_CHARS];
+        gint const count = DoubleToDecimal::toChars(f, (glong) chars);
+        resize(len + count);
+        StringCoding::copy((glong) chars, StringCoding::LATIN1, 0, (glong) value, coder, oldLen, count);
+        return *this;
+    }
 
-    StringBuffer &StringBuffer::append(gdouble d) { return append(String::valueOf(d)); }
+    StringBuffer &StringBuffer::append(gdouble d) {
+        gint const oldLen = len;
+        gbyte chars[DoubleToDecimal::MAX_CHARS];
+        gint const count = DoubleToDecimal::toChars(d, (glong) chars);
+        resize(len + count);
+        StringCoding::copy((glong) chars, StringCoding::LATIN1, 0, (glong) value, coder, oldLen, count);
+        return *this;
+    }
 
     StringBuffer &StringBuffer::append(const CharArray &chars) { return append(chars, 0, chars.length()); }
 
@@ -358,8 +375,9 @@ namespace core {
         gint const oldLen = len;
         try {
             Preconditions::checkIndexFromRange(offset, offset + length, chars.length());
+            inflate(coderOf(chars, offset, length));
             resize(len + length);
-            for (gint i = 0; i < length; ++i) putChar(value, oldLen + i, chars[i + offset]);
+            for (gint i = 0; i < length; ++i) putChar(value, coder, oldLen + i, chars[i + offset]);
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -369,8 +387,9 @@ namespace core {
         try {
             Preconditions::checkIndexFromRange(startIndex, endIndex, str.length());
             gint const length = endIndex - startIndex;
+            inflate(str.coder);
             resize(len + length);
-            arraycopy(str.value, startIndex, value, oldLen, length);
+            arraycopy(str.value, str.coder, startIndex, value, coder, oldLen, length);
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -380,8 +399,9 @@ namespace core {
         try {
             Preconditions::checkIndexFromRange(startIndex, endIndex, sb.length());
             gint const length = endIndex - startIndex;
+            inflate(sb.coder);
             resize(len + length);
-            arraycopy(sb.value, 0, value, oldLen, length);
+            arraycopy(sb.value, sb.coder, startIndex, value, coder, oldLen, length);
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -393,10 +413,10 @@ namespace core {
             if (&null == &obj) {
                 resize(len + 4);
                 shift(offset, 4);
-                putChar(value, offset + 0, 'n');
-                putChar(value, offset + 1, 'u');
-                putChar(value, offset + 2, 'l');
-                putChar(value, offset + 3, 'l');
+                putChar(value, coder, offset + 0, 'n');
+                putChar(value, coder, offset + 1, 'u');
+                putChar(value, coder, offset + 2, 'l');
+                putChar(value, coder, offset + 3, 'l');
             } else if (Class<StringBuffer>::hasInstance(obj))
                 return insert(offset, (const StringBuffer &) obj);
             else if (Class<String>::hasInstance(obj))
@@ -411,9 +431,10 @@ namespace core {
         if (offset == len) return append(str);
         try {
             Preconditions::checkIndex(offset, len);
+            inflate(str.coder);
             resize(len + str.length());
             shift(offset, str.length());
-            arraycopy(str.value, 0, value, offset, str.length());
+            arraycopy(str.value, str.coder, 0, value, coder, offset, str.length());
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
         return *this;
     }
@@ -423,13 +444,17 @@ namespace core {
         try {
             Preconditions::checkIndex(offset, len);
             gint const oldLen = len;
-            resize(len + sb.length());
-            shift(offset, sb.length());
+            gint const sbLen = sb.length();
+            inflate(sb.coder);
+            resize(len + sbLen);
+            shift(offset, sbLen);
             if (this == &sb) {
-                arraycopy(sb.value, 0, value, offset, offset);
-                arraycopy(sb.value, offset + oldLen, value, offset << 1, oldLen - offset);
+                // the chars [0, offset) are still at their place and the chars [offset, oldLen)
+                // has been moved to [offset + oldLen, oldLen << 1)
+                arraycopy(value, coder, 0, value, coder, offset, offset);
+                arraycopy(value, coder, offset + oldLen, value, coder, offset << 1, oldLen - offset);
             } else {
-                arraycopy(sb.value, 0, value, offset, sb.length());
+                arraycopy(sb.value, sb.coder, 0, value, coder, offset, sbLen);
             }
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
@@ -442,18 +467,18 @@ namespace core {
             if (b) {
                 resize(len + 4);
                 shift(offset, 4);
-                putChar(value, offset + 0, 't');
-                putChar(value, offset + 1, 'r');
-                putChar(value, offset + 2, 'u');
-                putChar(value, offset + 3, 'e');
+                putChar(value, coder, offset + 0, 't');
+                putChar(value, coder, offset + 1, 'r');
+                putChar(value, coder, offset + 2, 'u');
+                putChar(value, coder, offset + 3, 'e');
             } else {
                 resize(len + 5);
                 shift(offset, 5);
-                putChar(value, offset + 0, 'f');
-                putChar(value, offset + 1, 'a');
-                putChar(value, offset + 2, 'l');
-                putChar(value, offset + 3, 's');
-                putChar(value, offset + 4, 'e');
+                putChar(value, coder, offset + 0, 'f');
+                putChar(value, coder, offset + 1, 'a');
+                putChar(value, coder, offset + 2, 'l');
+                putChar(value, coder, offset + 3, 's');
+                putChar(value, coder, offset + 4, 'e');
             }
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
@@ -463,9 +488,10 @@ namespace core {
         if (offset == len) return append(ch);
         try {
             Preconditions::checkIndex(offset, len);
+            inflate(coderOf(ch));
             resize(len + 1);
             shift(offset, 1);
-            putChar(value, offset + 0, ch);
+            putChar(value, coder, offset + 0, ch);
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -474,9 +500,10 @@ namespace core {
         if (offset == len) return appendCodePoint(codePoint);
         try {
             Preconditions::checkIndex(offset, len);
+            inflate(coderOf(codePoint));
             resize(len + charCount(codePoint));
             shift(offset, charCount(codePoint));
-            putChar(value, offset + 0, codePoint);
+            putChar(value, coder, offset + 0, codePoint);
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -484,25 +511,7 @@ namespace core {
     StringBuffer &StringBuffer::insert(gint offset, gint i) {
         if (offset == len) return append(i);
         try {
-            Preconditions::checkIndex(offset, len);
-            // check number of chars necessary
-            gint count = i < 0 ? 1 : 0;
-            gint a = Math::abs(i);
-            while (a > 0) {
-                count++;
-                a /= 10;
-            }
-            resize(len + count);
-            shift(offset, count);
-            a = Math::abs(i);
-            do {
-                count -= 1;
-                putChar(value, offset + count, (a % 10) + '0');
-                a /= 10;
-            } while (a > 0);
-            if (i < 0)
-                putChar(value, offset + 0, '-');
-            return *this;
+            return insert(offset, (glong) i);
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
 
@@ -510,23 +519,11 @@ namespace core {
         if (offset == len) return append(l);
         try {
             Preconditions::checkIndex(offset, len);
-            // check number of chars necessary
-            gint count = l < 0 ? 1 : 0;
-            glong a = Math::abs(l);
-            while (a > 0) {
-                count++;
-                a /= 10;
-            }
+            gbyte chars[IntegerToChars::MAX_CHARS];
+            gint const count = IntegerToChars::toChars(l, 10, (glong) chars);
             resize(len + count);
             shift(offset, count);
-            a = Math::abs(l);
-            do {
-                count -= 1;
-                putChar(value, offset + count, (gint) (a % 10) + '0');
-                a /= 10;
-            } while (a > 0);
-            if (l < 0)
-                putChar(value, offset + 0, '-');
+            StringCoding::copy((glong) chars, LATIN1, 0, (glong) value, coder, offset, count);
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -539,27 +536,14 @@ namespace core {
     }
 
     StringBuffer &StringBuffer::insertUnsigned(gint offset, glong l) {
+        if (offset == len) return appendUnsigned(l);
         try {
-            if (offset == len)
-                return appendUnsigned(l);
-            else if (l > 0)
-                return insert(offset, l);
-            else {
-                Preconditions::checkIndex(offset, len);
-                gint count = 0;
-                glong a = l;
-                while (a != 0) {
-                    count++;
-                    a = CORE_AS_UNSIGNED_LONG(a) / 10;
-                }
-                resize(len + count);
-                a = Math::abs(l);
-                do {
-                    count -= 1;
-                    putChar(value, offset + count, (gint) (CORE_AS_UNSIGNED_LONG(a) % 10) + '0');
-                    a = CORE_AS_UNSIGNED_LONG(a) / 10;
-                } while (a > 0);
-            }
+            Preconditions::checkIndex(offset, len);
+            gbyte chars[IntegerToChars::MAX_CHARS];
+            gint const count = IntegerToChars::toUnsignedChars(l, 10, (glong) chars);
+            resize(len + count);
+            shift(offset, count);
+            StringCoding::copy((glong) chars, LATIN1, 0, (glong) value, coder, offset, count);
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -593,46 +577,41 @@ namespace core {
             if (index == len) return append(chars, offset, length);
             Preconditions::checkIndex(index, len);
             Preconditions::checkIndexFromRange(offset, offset + length, chars.length());
+            inflate(coderOf(chars, offset, length));
             resize(len + length);
             shift(index, length);
-            for (gint i = 0; i < length; ++i) putChar(value, index + i, chars[i + offset]);
+            for (gint i = 0; i < length; ++i) putChar(value, coder, index + i, chars[i + offset]);
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
 
     StringBuffer &StringBuffer::insert(gint offset, const String &str, gint startIndex, gint endIndex) {
         try {
-            if (startIndex == len) return append(str, startIndex, endIndex);
+            if (offset == len) return append(str, startIndex, endIndex);
             Preconditions::checkIndex(offset, len);
             Preconditions::checkIndexFromRange(startIndex, endIndex, str.length());
             gint const length = endIndex - startIndex;
+            inflate(str.coder);
             resize(len + length);
             shift(offset, length);
-            arraycopy(str.value, startIndex, value, offset, length);
+            arraycopy(str.value, str.coder, startIndex, value, coder, offset, length);
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
 
     StringBuffer &StringBuffer::insert(gint offset, const StringBuffer &sb, gint startIndex, gint endIndex) {
         try {
-            if (startIndex == len) return append(sb, startIndex, endIndex);
+            if (offset == len) return append(sb, startIndex, endIndex);
             Preconditions::checkIndex(offset, len);
             Preconditions::checkIndexFromRange(startIndex, endIndex, sb.length());
+            if (this == &sb)
+                // the inserted chars are moved by the shift: insert a copy
+                return insert(offset, sb.subString(startIndex, endIndex));
             gint const length = endIndex - startIndex;
+            inflate(sb.coder);
             resize(len + length);
             shift(offset, length);
-            if (this == &sb) {
-                if (startIndex == offset) {}
-                else if (startIndex > offset || endIndex <= offset) {
-                    arraycopy(sb.value, startIndex + length, value, offset, length);
-                } else {
-                    gint const diff = offset - startIndex;
-                    arraycopy(sb.value, startIndex, value, offset, diff);
-                    arraycopy(sb.value, offset + length, value, offset + diff, length - diff);
-                }
-            } else {
-                arraycopy(sb.value, startIndex, value, offset, length);
-            }
+            arraycopy(sb.value, sb.coder, startIndex, value, coder, offset, length);
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -642,9 +621,16 @@ namespace core {
             Preconditions::checkIndexFromRange(startIndex, endIndex, len);
             gint const length = endIndex - startIndex;
             gint const n = str.length() - length;
-            resize(len + n);
-            shift(endIndex, n);
-            arraycopy(str.value, 0, value, startIndex, str.length());
+            inflate(str.coder);
+            if (n > 0) {
+                resize(len + n);
+                shift(endIndex, n);
+            } else if (n < 0) {
+                // the tail must be moved before the truncation
+                shift(endIndex, n);
+                resize(len + n);
+            }
+            arraycopy(str.value, str.coder, 0, value, coder, startIndex, str.length());
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -654,7 +640,7 @@ namespace core {
             Preconditions::checkIndexFromRange(srcBegin, srcEnd, len);
             Preconditions::checkIndexFromSize(dstBegin, srcEnd - srcBegin, dst.length());
             gint const length = srcEnd - srcBegin;
-            for (gint i = 0; i < length; ++i) dst[i + dstBegin] = nextChar(value, i + srcBegin);
+            for (gint i = 0; i < length; ++i) dst[i + dstBegin] = nextChar(value, coder, i + srcBegin);
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
 
@@ -670,16 +656,16 @@ namespace core {
         gint count = 0;
         // count code points
         for (gint i = 0; i < len;) {
-            gchar const ch1 = nextChar(value, i);
-            gchar const ch2 = nextChar(value, i + 1);
+            gchar const ch1 = nextChar(value, coder, i);
+            gchar const ch2 = nextChar(value, coder, i + 1);
             count += 1;
             i += Character::isSurrogatePair(ch1, ch2) && i + 1 < len ? 2 : 1;
         }
         IntArray array = IntArray(count);
         gint j = 0;
         for (gint i = 0; i < len;) {
-            gchar const ch1 = nextChar(value, i);
-            gchar const ch2 = nextChar(value, i + 1);
+            gchar const ch1 = nextChar(value, coder, i);
+            gchar const ch2 = nextChar(value, coder, i + 1);
             if (Character::isSurrogatePair(ch1, ch2) && i + 1 < len) {
                 array[j++] = Character::joinSurrogates(ch1, ch2);
                 i += 2;
@@ -702,9 +688,8 @@ namespace core {
             Preconditions::checkIndexFromRange(startIndex, endIndex, len);
             if (endIndex > len) endIndex = len;
             String str;
-            str.value = generate(endIndex - startIndex);
-            str.len = endIndex - startIndex;
-            arraycopy(value, startIndex, str.value, 0, str.len);
+            // the string chooses its own coder (the buffer may be inflated without need)
+            str.assign((glong) value + ((glong) startIndex << coder), coder, endIndex - startIndex);
             return str;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -712,22 +697,9 @@ namespace core {
     gint StringBuffer::indexOf(const String &str) const { return indexOf(str, 0); }
 
     gint StringBuffer::indexOf(const String &str, gint begin) const {
-        if (begin < 0 || begin + str.length() >= len || str.isEmpty() || len == 0)
+        if (begin < 0 || str.isEmpty() || len == 0)
             return -1;
-        for (gint i = begin; i < len; ++i) {
-            gbool isFound = true;
-            for (gint j = 0; j < str.len && i + j < len; ++j) {
-                gchar const ch1 = nextChar(value, i + j);
-                gchar const ch2 = nextChar(str.value, j);
-                if (ch1 != ch2) {
-                    isFound = false;
-                    break;
-                }
-            }
-            if (isFound)
-                return i;
-        }
-        return -1;
+        return StringCoding::indexOf((glong) value, coder, len, (glong) str.value, str.coder, str.len, begin);
     }
 
     gint StringBuffer::lastIndexOf(const String &str) const {
@@ -739,27 +711,28 @@ namespace core {
             startIndex = len - 1;
         if (startIndex < 0 || startIndex + 1 < str.len || str.isEmpty())
             return -1;
-        for (gint i = startIndex; i >= 0; --i) {
-            gbool isFound = true;
-            for (gint j = 0; j < str.len; ++j) {
-                gchar const ch1 = nextChar(value, i - j);
-                gchar const ch2 = nextChar(str.value, str.len - 1 - j);
-                if (ch1 != ch2) {
-                    isFound = false;
-                    break;
-                }
-            }
-            if (isFound) {
-                return i + 1 - str.len;
-            }
-        }
-        return -1;
+        // startIndex is the index of last char of matching
+        return StringCoding::lastIndexOf((glong) value, coder, len, (glong) str.value, str.coder, str.len,
+                                         startIndex + 1 - str.len);
     }
 
     StringBuffer &StringBuffer::reverse() {
-        for (gint i = 0; i <= (len >> 1); ++i) {
-            Unsafe::swapValues(value[i + 0], value[(len - 1) - (i + 0)]);
-            Unsafe::swapValues(value[i + 1], value[(len - 1) - (i + 1)]);
+        for (gint i = 0, j = len - 1; i < j; ++i, --j) {
+            gchar const ch = nextChar(value, coder, i);
+            putChar(value, coder, i, nextChar(value, coder, j));
+            putChar(value, coder, j, ch);
+        }
+        if (coder == UTF16) {
+            // restore the order of surrogate pairs
+            for (gint i = 0; i < len - 1; ++i) {
+                gchar const ch1 = nextChar(value, coder, i);
+                gchar const ch2 = nextChar(value, coder, i + 1);
+                if (Character::isLowSurrogate(ch1) && Character::isHighSurrogate(ch2)) {
+                    putChar(value, coder, i, ch2);
+                    putChar(value, coder, i + 1, ch1);
+                    i += 1;
+                }
+            }
         }
         return *this;
     }
@@ -780,20 +753,9 @@ namespace core {
     gint StringBuffer::compareTo(const StringBuffer &other) const {
         if (this == &other) return 0;
         gint const limit = Math::min(len, other.len);
-        if (limit < 7) {
-            // bitwise comparing
-            for (gint i = 0; i < 14; ++i) {
-                if (value[i] != other.value[i])
-                    return nextChar(value, i >> 1) - nextChar(other.value, i >> 1);
-            }
-        } else {
-            for (gint i = 0; i < limit; ++i) {
-                gchar const ch1 = nextChar(value, i);
-                gchar const ch2 = nextChar(other.value, i);
-                if (ch1 != ch2)
-                    return ch1 - ch2;
-            }
-        }
+        gint const i = StringCoding::mismatch((glong) value, coder, (glong) other.value, other.coder, limit);
+        if (i >= 0)
+            return nextChar(value, coder, i) - nextChar(other.value, other.coder, i);
         return len - other.len;
     }
 
@@ -805,14 +767,11 @@ namespace core {
         try {
             Preconditions::checkIndex(index, len);
             gint const limit = len - 1;
-            gint const n = 1;
-            len -= 1;
             // shift all character
-            for (int i = index; i < limit; i += 1) {
-                putChar(value, i, nextChar(value, i + n));
-            }
+            arraycopy(value, coder, index + 1, value, coder, index, limit - index);
             // fill last character
-            putChar(value, limit + n, 0);
+            putChar(value, coder, limit, (gchar) 0);
+            len -= 1;
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
@@ -824,26 +783,22 @@ namespace core {
             Preconditions::checkIndexFromRange(startIndex, endIndex, len);
             gint const n = endIndex - startIndex;
             gint const limit = len - n;
-            len -= n;
             if (n == 0)
                 return *this;
             // shift all character
-            for (int i = startIndex; i < limit; i += 1) {
-                putChar(value, i, nextChar(value, i + n));
-            }
+            arraycopy(value, coder, endIndex, value, coder, startIndex, len - endIndex);
             // fill zero
             for (int i = 0; i < n; i += 1) {
-                putChar(value, limit + i, 0);
+                putChar(value, coder, limit + i, (gchar) 0);
             }
+            len -= n;
             return *this;
         } catch (const IndexException &ie) { ie.throws(__trace("core.StringBuffer")); }
     }
 
     StringBuffer::~StringBuffer() {
-        if (len > 0) {
-            len = 0;
-            Unsafe::freeMemory((glong) value);
-        }
+        release(value);
+        len = 0;
         value = null;
     }
 
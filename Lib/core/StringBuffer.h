@@ -86,11 +86,45 @@ namespace core {
          */
         gint cap = {};
 
+        /**
+         * The identifier of the encoding used to store the characters in value
+         * (LATIN1 or UTF16). The buffer uses the LATIN1 coder until a non latin1
+         * character is added.
+         */
+        gbyte coder = {};
+
         /**
          * The default initial capacity
          */
         static CORE_FAST gint DEFAULT_CAPACITY = 1 << 4;
 
+        /**
+         * The size (in bytes) of the inline storage. It can hold the default
+         * capacity with the LATIN1 coder.
+         */
+        static CORE_FAST gint INLINE_SIZE = 24;
+
+        /**
+         * The inline storage used while the capacity of this buffer is small.
+         */
+        glong buffer[INLINE_SIZE >> 3] = {};
+
+        /**
+         * Return the storage of the given capacity with the given coder. The inline
+         * storage of this buffer is returned for the small capacities.
+         */
+        STORAGE allocate(gint capacity, gbyte coder);
+
+        /**
+         * Release the given storage of this buffer, if it has been allocated on the heap.
+         */
+        void release(STORAGE storage);
+
+        /**
+         * Exchange the content of this buffer with the content of the given buffer.
+         */
+        void exchange(StringBuffer &sb) CORE_NOTHROW;
+
         /**
          * Returns a capacity at least as large as the given minimum capacity.
          * Returns the current capacity increased by the current length + 2 if
@@ -109,6 +143,16 @@ namespace core {
          */
         void shift(gint offset, gint count);
 
+        /**
+         * Store the characters of this buffer with the given coder, if it is wider than
+         * the current coder (the LATIN1 storage is inflated to UTF16 storage).
+         */
+        void inflate(gbyte newCoder);
+
+        friend class StringRope;
+
+        friend class native::Formatter;
+
     public:
         /**
          * Construct new StringBuffer with no characters in it and an initial
@@ -405,6 +449,26 @@ namespace core {
          */
         StringBuffer &append(gdouble d);
 
+        /**
+         * Append to this sequence the characters formatted with the given format and
+         * arguments (see String.format). The characters are written directly to this
+         * sequence, without intermediate String.
+         *
+         * @param format
+         *          The format string
+         * @param args
+         *          The arguments referenced by the format specifiers
+         * @throws IllegalArgumentException if the format is illegal, or incompatible with
+         *          the given arguments.
+         */
+        template<class... Args>
+        StringBuffer &appendFormat(const String &format, Args &&...args) {
+            native::Formatter::Argument const argv[] = {native::Formatter::Argument(args)...,
+                                                        native::Formatter::Argument()};
+            native::Formatter::format(*this, format, argv, (gint) sizeof...(Args));
+            return *this;
+        }
+
         /**
          * Append String representation of the root argument to this sequence.
          *
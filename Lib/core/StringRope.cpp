@@ -0,0 +1,271 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "StringRope.h"
+#include <core/private/Unsafe.h>
+#include <core/private/StringCoding.h>
+#include <core/private/DoubleToDecimal.h>
+#include <core/private/IntegerToChars.h>
+#include <core/Character.h>
+#include <core/Integer.h>
+#include <core/Math.h>
+#include <core/MemoryError.h>
+
+namespace core {
+
+    using namespace native;
+
+    namespace {
+
+        CORE_FAST gbyte LATIN1 = StringCoding::LATIN1;
+        CORE_FAST gbyte UTF16 = StringCoding::UTF16;
+
+        /**
+         * The chunk of rope. The chunk either stores its characters just after its header
+         * (in the same memory block), or references the storage of a String stored just
+         * after its header (capacity is zero for these chunks).
+         */
+        interface Chunk {
+            Chunk *next;
+            glong chars;
+            gint count;
+            gint capacity;
+            gbyte coder;
+        };
+
+        /**
+         * The size (in bytes) of the header of each chunk, rounded to keep the chars aligned
+         */
+        CORE_FAST glong CHUNK_SIZE = (sizeof(Chunk) + 7) & ~7;
+
+        /**
+         * The minimum capacity (number of chars) of chunks
+         */
+        CORE_FAST gint MIN_CAPACITY = 1 << 8;
+
+        /**
+         * The maximum capacity (number of chars) of chunks, the larger insertions
+         * use a chunk of their exact size.
+         */
+        CORE_FAST gint MAX_CAPACITY = 1 << 16;
+
+        /**
+         * The minimum length of the strings referenced by a rope (instead of being copied).
+         */
+        CORE_FAST gint SHARING_THRESHOLD = 1 << 12;
+
+        String &stringOf(Chunk *chunk) {
+            return *(String *) ((glong) chunk + CHUNK_SIZE);
+        }
+    }
+
+    StringRope::StringRope(const StringRope &rope) {
+        append(rope.toString());
+    }
+
+    StringRope::StringRope(StringRope &&rope) CORE_NOTHROW {
+        Unsafe::swapValues(head, rope.head);
+        Unsafe::swapValues(tail, rope.tail);
+        Unsafe::swapValues(len, rope.len);
+        Unsafe::swapValues(copied, rope.copied);
+        Unsafe::swapValues(coder, rope.coder);
+    }
+
+    StringRope &StringRope::operator=(const StringRope &rope) {
+        if (this != &rope) {
+            String const str = rope.toString();
+            clear();
+            append(str);
+        }
+        return *this;
+    }
+
+    StringRope &StringRope::operator=(StringRope &&rope) CORE_NOTHROW {
+        if (this != &rope) {
+            Unsafe::swapValues(head, rope.head);
+            Unsafe::swapValues(tail, rope.tail);
+            Unsafe::swapValues(len, rope.len);
+            Unsafe::swapValues(copied, rope.copied);
+            Unsafe::swapValues(coder, rope.coder);
+        }
+        return *this;
+    }
+
+    gint StringRope::length() const {
+        return len;
+    }
+
+    gbool StringRope::isEmpty() const {
+        return len == 0;
+    }
+
+    void StringRope::clear() {
+        Chunk *chunk = (Chunk *) head;
+        while (chunk != null) {
+            Chunk *const next = chunk->next;
+            if (chunk->capacity == 0)
+                stringOf(chunk).~String();
+            Unsafe::freeMemory((glong) chunk);
+            chunk = next;
+        }
+        head = 0;
+        tail = 0;
+        len = 0;
+        copied = 0;
+        coder = LATIN1;
+    }
+
+    void StringRope::write(glong src, gbyte srcCoder, gint count, gbyte newCoder) {
+        if (count <= 0)
+            return;
+        if (count > Integer::MAX_VALUE - len)
+            MemoryError("Required length exceeds implementation limit").throws(__trace("core.StringRope"));
+        Chunk *chunk = (Chunk *) tail;
+        if (chunk == null || chunk->capacity - chunk->count < count || chunk->coder < newCoder) {
+            // the last chunk is full: the next chunk is as large as the copied chars
+            gint const capacity = Math::max(count, Math::min(Math::max(copied, MIN_CAPACITY), MAX_CAPACITY));
+            Chunk *const newChunk = (Chunk *) Unsafe::allocateMemory(CHUNK_SIZE + ((glong) capacity << newCoder));
+            newChunk->next = null;
+            newChunk->chars = (glong) newChunk + CHUNK_SIZE;
+            newChunk->count = 0;
+            newChunk->capacity = capacity;
+            newChunk->coder = newCoder;
+            if (chunk == null)
+                head = (glong) newChunk;
+            else
+                chunk->next = newChunk;
+            tail = (glong) newChunk;
+            chunk = newChunk;
+        }
+        StringCoding::copy(src, srcCoder, 0, chunk->chars, chunk->coder, chunk->count, count);
+        chunk->count += count;
+        len += count;
+        copied += count;
+        if (newCoder > coder)
+            coder = newCoder;
+    }
+
+    void StringRope::link(const String &str) {
+        if (str.len > Integer::MAX_VALUE - len)
+            MemoryError("Required length exceeds implementation limit").throws(__trace("core.StringRope"));
+        Chunk *const chunk = (Chunk *) Unsafe::allocateMemory(CHUNK_SIZE + (glong) sizeof(String));
+        // the copy of string shares its storage
+        String &copy = *new((GENERIC_PTR) &stringOf(chunk)) String(str);
+        chunk->next = null;
+        chunk->chars = (glong) copy.value;
+        chunk->count = copy.len;
+        chunk->capacity = 0;
+        chunk->coder = copy.coder;
+        if (tail == 0)
+            head = (glong) chunk;
+        else
+            ((Chunk *) tail)->next = chunk;
+        tail = (glong) chunk;
+        len += copy.len;
+        if (copy.coder > coder)
+            coder = copy.coder;
+    }
+
+    StringRope &StringRope::append(const Object &obj) {
+        if (&null == &obj)
+            write((glong) "null", LATIN1, 4, LATIN1);
+        else if (Class<String>::hasInstance(obj))
+            return append((const String &) obj);
+        else if (Class<StringBuffer>::hasInstance(obj))
+            return append((const StringBuffer &) obj);
+        else
+            return append(String::valueOf(obj));
+        return *this;
+    }
+
+    StringRope &StringRope::append(const String &str) {
+        Chunk *const chunk = (Chunk *) tail;
+        if (str.len >= SHARING_THRESHOLD && (chunk == null || chunk->capacity - chunk->count < str.len))
+            link(str);
+        else
+            write((glong) str.value, str.coder, str.len, str.coder);
+        return *this;
+    }
+
+    StringRope &StringRope::append(const StringBuffer &sb) {
+        // the buffer may be stored with UTF16 coder without non latin1 chars
+        gbyte const newCoder = sb.coder == LATIN1 || StringCoding::indexOfNonLatin1((glong) sb.value, sb.len) < 0
+                               ? LATIN1 : UTF16;
+        write((glong) sb.value, sb.coder, sb.len, newCoder);
+        return *this;
+    }
+
+    StringRope &StringRope::append(gbool b) {
+        if (b)
+            write((glong) "true", LATIN1, 4, LATIN1);
+        else
+            write((glong) "false", LATIN1, 5, LATIN1);
+        return *this;
+    }
+
+    StringRope &StringRope::append(gchar ch) {
+        write((glong) &ch, UTF16, 1, StringCoding::canEncode(ch) ? LATIN1 : UTF16);
+        return *this;
+    }
+
+    StringRope &StringRope::appendCodePoint(gint codePoint) {
+        if (!Character::isValidCodePoint(codePoint))
+            return append((gchar) '?');
+        if (!Character::isSupplementary(codePoint))
+            return append((gchar) codePoint);
+        gchar const pair[2] = {Character::highSurrogate(codePoint), Character::lowSurrogate(codePoint)};
+        write((glong) pair, UTF16, 2, UTF16);
+        return *this;
+    }
+
+    StringRope &StringRope::append(gint i) {
+        return append((glong) i);
+    }
+
+    StringRope &StringRope::append(glong l) {
+        gbyte chars[IntegerToChars::MAX_CHARS];
+        write((glong) chars, LATIN1, IntegerToChars::toChars(l, 10, (glong) chars), LATIN1);
+        return *this;
+    }
+
+    StringRope &StringRope::append(gfloat f) {
+        gbyte chars[DoubleToDecimal::MAX_FLOAT_CHARS];
+        write((glong) chars, LATIN1, DoubleToDecimal::toChars(f, (glong) chars), LATIN1);
+        return *this;
+    }
+
+    StringRope &StringRope::append(gdouble d) {
+        gbyte chars[DoubleToDecimal::MAX_CHARS];
+        write((glong) chars, LATIN1, DoubleToDecimal::toChars(d, (glong) chars), LATIN1);
+        return *this;
+    }
+
+    String StringRope::toString() const {
+        Chunk *chunk = (Chunk *) head;
+        if (chunk == null)
+            return {};
+        if (chunk->next == null && chunk->capacity == 0)
+            // only one string: its storage is shared
+            return stringOf(chunk);
+        String str;
+        str.len = len;
+        str.coder = coder;
+        str.value = str.allocate(len, coder);
+        gint offset = 0;
+        for (; chunk != null; chunk = chunk->next) {
+            StringCoding::copy(chunk->chars, chunk->coder, 0, (glong) str.value, coder, offset, chunk->count);
+            offset += chunk->count;
+        }
+        return str;
+    }
+
+    Object &StringRope::clone() const {
+        return Unsafe::allocateInstance<StringRope>(*this);
+    }
+
+    StringRope::~StringRope() {
+        clear();
+    }
+
+} // core
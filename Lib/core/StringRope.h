@@ -0,0 +1,238 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#ifndef CORE23_STRINGROPE_H
+#define CORE23_STRINGROPE_H
+
+#include <core/StringBuffer.h>
+
+namespace core {
+
+    /**
+     * A <b> StringRope</b> is an append-only sequence of characters, intended to build
+     * very large strings (like the reports or the JSON payloads of several megabytes).
+     *
+     * <p>Unlike the <b> StringBuffer</b>, the characters of a rope are not stored in one
+     * contiguous storage: they are stored in a list of chunks. When the last chunk is full,
+     * a new chunk is added (the chunks are never reallocated, nor copied). The large
+     * strings are not copied either: the rope references their storage (see String.subString).
+     * The characters are copied only once, in the String returned by <b> toString</b>.
+     *
+     * <p>The size of the chunks grows with the number of characters of the rope (from 256 to
+     * 65536 characters), such that the small ropes use small chunks.
+     *
+     * <p>
+     * Example:
+     * <blockquote><pre>
+     * StringRope rope;
+     * for (gint i = 0; i < count; ++i)
+     *     rope.append("item-"_S).append(i).append('\n');
+     * String report = rope.toString(); // the characters are copied here
+     * </pre></blockquote>
+     *
+     * @author Brunshweeck Tazeussong
+     * @see StringBuffer
+     */
+    class StringRope CORE_FINAL : public Object {
+    private:
+        /**
+         * The address of the first chunk (zero if this rope is empty)
+         */
+        glong head = {};
+
+        /**
+         * The address of the last chunk (zero if this rope is empty)
+         */
+        glong tail = {};
+
+        /**
+         * The character count of this rope
+         */
+        gint len = {};
+
+        /**
+         * The number of characters copied in the chunks of this rope (the strings
+         * referenced by this rope are not counted). This number determines the
+         * capacity of the next chunk.
+         */
+        gint copied = {};
+
+        /**
+         * The coder of the String returned by toString (UTF16 if at least one non
+         * latin1 character has been appended, LATIN1 otherwise).
+         */
+        gbyte coder = {};
+
+        /**
+         * Append the given characters (stored with the given coder) to this rope. The
+         * characters are stored in a chunk with the given coder (or a wider coder).
+         */
+        void write(glong src, gbyte srcCoder, gint count, gbyte newCoder);
+
+        /**
+         * Append the chunk that references the storage of the given String.
+         */
+        void link(const String &str);
+
+    public:
+        /**
+         * Construct new empty rope.
+         */
+        CORE_IMPLICIT StringRope() = default;
+
+        /**
+         * Construct new rope containing the characters of the given rope.
+         *
+         * @param rope
+         *          The rope to copy
+         */
+        StringRope(const StringRope &rope);
+
+        /**
+         * Construct new rope with the chunks of the given rope. The given rope becomes empty.
+         *
+         * @param rope
+         *          The rope to move
+         */
+        StringRope(StringRope &&rope) CORE_NOTHROW;
+
+        /**
+         * Set the characters of this rope with the characters of the given rope.
+         *
+         * @param rope
+         *          The rope to copy
+         */
+        StringRope &operator=(const StringRope &rope);
+
+        /**
+         * Exchange the chunks of this rope with the chunks of the given rope.
+         *
+         * @param rope
+         *          The rope to move
+         */
+        StringRope &operator=(StringRope &&rope) CORE_NOTHROW;
+
+        /**
+         * Return the current number of characters of this rope.
+         */
+        gint length() const;
+
+        /**
+         * Return true if this rope contains no character.
+         */
+        gbool isEmpty() const;
+
+        /**
+         * Remove all characters of this rope, and release its chunks.
+         */
+        void clear();
+
+        /**
+         * Append String representation of the Object argument
+         *
+         * @param obj
+         *         The Object to append
+         */
+        StringRope &append(const Object &obj);
+
+        /**
+         * Append String argument to this rope. The large strings are not copied,
+         * this rope references their storage.
+         *
+         * @param str
+         *         The String to append
+         */
+        StringRope &append(const String &str);
+
+        template<class Str, Class<gbool>::Iff<Class<Str>::isString()> = true>
+        StringRope &append(Str &&str) {
+            return append((String) str);
+        }
+
+        /**
+         * Append the characters of StringBuffer argument to this rope.
+         *
+         * @param sb
+         *         The StringBuffer to append
+         */
+        StringRope &append(const StringBuffer &sb);
+
+        /**
+         * Append String representation of boolean argument to this rope.
+         *
+         * @param b
+         *         The boolean to append
+         */
+        StringRope &append(gbool b);
+
+        /**
+         * Append char value argument to this rope.
+         *
+         * @param ch
+         *         The char value to append
+         */
+        StringRope &append(gchar ch);
+
+        template<class Chr, Class<gbool>::Iff<Class<Chr>::isCharacter()> = true>
+        StringRope &append(Chr &&ch) {
+            return append((gchar) ch);
+        }
+
+        /**
+         * Append character (unicode code point) argument to this rope.
+         *
+         * @param codePoint
+         *         The character (unicode code point) to append
+         */
+        StringRope &appendCodePoint(gint codePoint);
+
+        /**
+         * Append String representation of gint value argument to this rope.
+         *
+         * @param i
+         *         The gint value to append
+         */
+        StringRope &append(gint i);
+
+        /**
+         * Append String representation of glong value argument to this rope.
+         *
+         * @param l
+         *         The glong value to append
+         */
+        StringRope &append(glong l);
+
+        /**
+         * Append String representation of float value argument to this rope.
+         *
+         * @param f
+         *         The float value to append
+         */
+        StringRope &append(gfloat f);
+
+        /**
+         * Append String representation of double value argument to this rope.
+         *
+         * @param d
+         *         The double value to append
+         */
+        StringRope &append(gdouble d);
+
+        /**
+         * Return the String containing all characters of this rope. The characters of
+         * all chunks are copied once, in the storage of the returned String.
+         */
+        String toString() const override;
+
+        /**
+         * Return sharable copy of this Object
+         */
+        Object &clone() const override;
+
+        ~StringRope() override;
+    };
+
+} // core
+
+#endif //CORE23_STRINGROPE_H
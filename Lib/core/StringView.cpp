@@ -0,0 +1,183 @@
+//
+// Created by T.N.Brunshweeck on 15/10/2026.
+//
+
+#include "StringView.h"
+#include <core/private/StringCoding.h>
+#include <core/private/Unsafe.h>
+#include <core/util/Preconditions.h>
+#include <core/IndexException.h>
+#include <core/IllegalArgumentException.h>
+#include <core/NoSuchElementException.h>
+#include <core/Character.h>
+
+namespace core {
+
+    using namespace util;
+    using namespace native;
+
+    StringView::StringView(const String &str) : source(&str), offset(0), len(str.length()) {}
+
+    StringView::StringView(const String &str, gint offset, gint count) : source(&str), offset(offset), len(count) {
+        try {
+            Preconditions::checkIndexFromSize(offset, count, str.length());
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.StringView"));
+        }
+    }
+
+    gint StringView::length() const {
+        return len;
+    }
+
+    gbool StringView::isEmpty() const {
+        return len == 0;
+    }
+
+    gchar StringView::charAt(gint index) const {
+        try {
+            Preconditions::checkIndex(index, len);
+            return StringCoding::getChar((glong) source->value, source->coder, offset + index);
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.StringView"));
+        }
+    }
+
+    StringView StringView::subView(gint start, gint end) const {
+        try {
+            Preconditions::checkIndexFromRange(start, end, len);
+            StringView view;
+            view.source = source;
+            view.offset = offset + start;
+            view.len = end - start;
+            return view;
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.StringView"));
+        }
+    }
+
+    CharSequence &StringView::subSequence(gint start, gint end) const {
+        try {
+            return Unsafe::allocateInstance<StringView>(subView(start, end));
+        } catch (const IndexException &ie) {
+            ie.throws(__trace("core.StringView"));
+        }
+    }
+
+    gint StringView::indexOf(gint ch, gint fromIndex) const {
+        if (len == 0 || fromIndex >= len)
+            return -1;
+        if (fromIndex < 0)
+            fromIndex = 0;
+        if (Character::isSupplementary(ch)) {
+            // the search of supplementary characters is done by the string
+            gint const index = source->indexOf(ch, offset + fromIndex);
+            return index < 0 || index > offset + len - 2 ? -1 : index - offset;
+        }
+        gint const index = StringCoding::indexOf((glong) source->value, source->coder, offset + len, ch,
+                                                 offset + fromIndex);
+        return index < 0 ? -1 : index - offset;
+    }
+
+    gint StringView::startIndex() const {
+        return offset;
+    }
+
+    String::Span StringView::span() const {
+        if (len == 0)
+            // the empty view has no string
+            return {};
+        return source->span(offset, offset + len);
+    }
+
+    gbool StringView::equals(const Object &o) const {
+        if (this == &o)
+            return true;
+        if (Class<StringView>::hasInstance(o))
+            return equals((const StringView &) o);
+        if (Class<String>::hasInstance(o))
+            return equals(StringView((const String &) o));
+        return false;
+    }
+
+    gbool StringView::equals(const StringView &view) const {
+        if (len != view.len)
+            return false;
+        if (len == 0)
+            return true;
+        gbyte const coder = source->coder;
+        gbyte const coder2 = view.source->coder;
+        return StringCoding::mismatch((glong) source->value + ((glong) offset << coder), coder,
+                                      (glong) view.source->value + ((glong) view.offset << coder2), coder2, len) < 0;
+    }
+
+    gint StringView::hash() const {
+        if (len == 0)
+            return 0;
+        gbyte const coder = source->coder;
+        return StringCoding::hash((glong) source->value + ((glong) offset << coder), coder, len);
+    }
+
+    String StringView::toString() const {
+        if (len == 0)
+            return {};
+        return source->subString(offset, offset + len);
+    }
+
+    Object &StringView::clone() const {
+        return Unsafe::allocateInstance<StringView>(*this);
+    }
+
+    StringSplitter::StringSplitter(const String &str, gint delimiter) :
+            source(&str), delimiterChar(delimiter), delimiterLength(Character::charCount(delimiter)), cursor(0) {
+        if (delimiterLength > 1)
+            // the supplementary char is searched as string
+            this->delimiter = String::valueOfCodePoint(delimiter);
+    }
+
+    StringSplitter::StringSplitter(const String &str, const String &delimiter) :
+            source(&str), delimiter(delimiter), delimiterChar(0), delimiterLength(delimiter.length()), cursor(0) {
+        if (delimiterLength == 0)
+            IllegalArgumentException("Empty delimiter").throws(__trace("core.StringSplitter"));
+        if (delimiterLength == 1)
+            delimiterChar = delimiter.charAt(0);
+    }
+
+    gbool StringSplitter::hasNext() const {
+        return cursor >= 0;
+    }
+
+    const StringView &StringSplitter::next() {
+        if (cursor < 0)
+            NoSuchElementException().throws(__trace("core.StringSplitter"));
+        gint const start = cursor;
+        gint const end = delimiterLength == 1 ? source->indexOf(delimiterChar, start)
+                                              : source->indexOf(delimiter, start);
+        if (end < 0) {
+            // the last part
+            current = StringView(*source, start, source->length() - start);
+            cursor = -1;
+        } else {
+            current = StringView(*source, start, end - start);
+            cursor = end + delimiterLength;
+        }
+        return current;
+    }
+
+    Object &StringSplitter::clone() const {
+        return Unsafe::allocateInstance<StringSplitter>(*this);
+    }
+
+    StringSplitter String::splitView(gint ch) const {
+        return StringSplitter(*this, ch);
+    }
+
+    StringSplitter String::splitView(const String &delimiter) const {
+        try {
+            return StringSplitter(*this, delimiter);
+        } catch (const IllegalArgumentException &iae) {
+            iae.throws(__trace("core.String"));
+        }
+    }
+
+} // core
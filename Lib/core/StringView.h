@@ -0,0 +1,254 @@
+//
+// Created by T.N.Brunshweeck on 15/10/2026.
+//
+
+#ifndef CORE23_STRINGVIEW_H
+#define CORE23_STRINGVIEW_H
+
+#include <core/String.h>
+#include <core/util/Iterator.h>
+
+namespace core {
+
+    /**
+     * A <b> StringView</b> is a read-only sequence of characters of a <b> String</b>
+     * (the characters in range [offset, offset + length) of this string).
+     *
+     * <p>A view never copies the characters of its string, and never allocates memory.
+     * It is intended for the code that only inspects the content of the string (like the
+     * parsers of logs or CSV files), the view is converted to an owning String only when
+     * it must be kept (see toString).
+     *
+     * <p>A view references its string: the string must not be destroyed, nor modified
+     * while the view is used.
+     *
+     * <p>
+     * Example:
+     * <blockquote><pre>
+     * String line = "id,name,age"_S;
+     * StringSplitter it = line.splitView(',');
+     * while (it.hasNext()) {
+     *     StringView const &field = it.next(); // "id", "name" then "age"
+     *     ...
+     * }
+     * </pre></blockquote>
+     *
+     * @author Brunshweeck Tazeussong
+     * @see String.splitView
+     * @see StringTokenizer.nextTokenView
+     */
+    class StringView CORE_FINAL : public Object, public CharSequence {
+    private:
+        /**
+         * The string viewed by this view (null for the empty view).
+         */
+        const String *source = {};
+
+        /**
+         * The index (in source) of first char of this view.
+         */
+        gint offset = {};
+
+        /**
+         * The number of chars of this view.
+         */
+        gint len = {};
+
+    public:
+
+        /**
+         * Construct new empty view.
+         */
+        CORE_FAST StringView() = default;
+
+        /**
+         * Construct new view of all characters of given string.
+         *
+         * @param str
+         *          The viewed string
+         */
+        CORE_IMPLICIT StringView(const String &str);
+
+        /**
+         * Construct new view of the characters of given string in range
+         * [offset, offset + count).
+         *
+         * @param str
+         *          The viewed string
+         * @param offset
+         *          The index of first char of view
+         * @param count
+         *          The number of chars of view
+         *
+         * @throws IndexException if offset or count is negative, or if
+         *          offset + count is greater than the length of string.
+         */
+        CORE_EXPLICIT StringView(const String &str, gint offset, gint count);
+
+        /**
+         * Returns the number of characters of this view.
+         */
+        gint length() const override;
+
+        /**
+         * Returns true if this view has no character.
+         */
+        gbool isEmpty() const override;
+
+        /**
+         * Returns the char value at the specified index of this view.
+         *
+         * @param index
+         *          The index of char
+         *
+         * @throws IndexException if the index is out of range [0, length)
+         */
+        gchar charAt(gint index) const override;
+
+        /**
+         * Returns the view of characters of this view in range [start, end).
+         * The returned view has the same string as this view.
+         *
+         * @param start
+         *          The start index, inclusive
+         * @param end
+         *          The end index, exclusive
+         *
+         * @throws IndexException if start or end are negative, if end is greater
+         *          than the length of this view, or if start is greater than end.
+         */
+        StringView subView(gint start, gint end) const;
+
+        /**
+         * Returns the (allocated) view of characters of this view in range [start, end).
+         *
+         * @see subView(gint, gint)
+         */
+        CharSequence &subSequence(gint start, gint end) const override;
+
+        /**
+         * Returns the index within this view of the first occurrence of the specified
+         * character (starting at the given index), or -1 if not found.
+         *
+         * @param ch
+         *          The character (Unicode code point)
+         * @param fromIndex
+         *          The index to start the search from
+         */
+        gint indexOf(gint ch, gint fromIndex = 0) const;
+
+        /**
+         * Returns the index (in its string) of first char of this view.
+         */
+        gint startIndex() const;
+
+        /**
+         * Returns the read-only view of the code units of this view (without copy).
+         *
+         * @see String.span
+         */
+        String::Span span() const;
+
+        /**
+         * Returns true if the given object is a String or a StringView with the same
+         * sequence of characters as this view.
+         */
+        gbool equals(const Object &o) const override;
+
+        /**
+         * Returns true if the given view has the same sequence of characters as this view.
+         */
+        gbool equals(const StringView &view) const;
+
+        /**
+         * Returns the hash code of this view. This hash code is the same as the
+         * hash code of the String containing the same characters as this view.
+         *
+         * @see String.hash()
+         */
+        gint hash() const override;
+
+        /**
+         * Returns the String containing the characters of this view. This string shares
+         * the storage of the viewed string when possible (see String.subString).
+         */
+        String toString() const override;
+
+        Object &clone() const override;
+    };
+
+    /**
+     * The iterator over the parts of a string separated by a delimiter
+     * (see String.splitView). Each call to next returns the view of the next part,
+     * this view remains valid until the following call of next.
+     *
+     * <p>A string with n occurrences of delimiter has n + 1 parts, the empty parts
+     * (between two consecutive delimiters, or at the boundaries of the string) are
+     * also returned.
+     */
+    class StringSplitter CORE_FINAL : public util::Iterator<const StringView> {
+    private:
+        /**
+         * The split string
+         */
+        const String *source;
+
+        /**
+         * The delimiter (used when its length is greater than one)
+         */
+        String delimiter;
+
+        /**
+         * The delimiter char (used when the delimiter is a single char).
+         */
+        gint delimiterChar;
+
+        /**
+         * The number of chars of delimiter
+         */
+        gint delimiterLength;
+
+        /**
+         * The index of first char of the next part, or -1 if there are no more parts.
+         */
+        gint cursor;
+
+        /**
+         * The view returned by the last call of next
+         */
+        StringView current;
+
+    public:
+
+        /**
+         * Construct new iterator over the parts of given string separated by the
+         * given char.
+         */
+        CORE_EXPLICIT StringSplitter(const String &str, gint delimiter);
+
+        /**
+         * Construct new iterator over the parts of given string separated by the
+         * given (non-empty) delimiter.
+         *
+         * @throws IllegalArgumentException if the delimiter is empty.
+         */
+        CORE_EXPLICIT StringSplitter(const String &str, const String &delimiter);
+
+        /**
+         * Returns true if the string has more parts.
+         */
+        gbool hasNext() const override;
+
+        /**
+         * Returns the view of the next part.
+         *
+         * @throws NoSuchElementException if there are no more parts.
+         */
+        const StringView &next() override;
+
+        Object &clone() const override;
+    };
+
+} // core
+
+#endif //CORE23_STRINGVIEW_H
@@ -16,6 +16,7 @@
 #include <core/io/private/StringCharBuffer.h>
 #include <core/util/Optional.h>
 #include <core/Enum.h>
+#include <core/private/IntegerToChars.h>
 
 namespace core {
     namespace io {
@@ -563,5 +564,29 @@ namespace core {
             }
         }
 
+        CharBuffer &CharBuffer::append(gint i) {
+            try {
+                return append((glong) i);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.io.CharBuffer"));
+            }
+        }
+
+        CharBuffer &CharBuffer::append(glong l) {
+            gbyte chars[IntegerToChars::MAX_CHARS];
+            gint const count = IntegerToChars::toChars(l, 10, (glong) chars);
+            if (((Buffer &) *this).isReadOnly())
+                ReadOnlyBufferException().throws(__trace("core.io.CharBuffer"));
+            if (count > remaining())
+                BufferOverflowException().throws(__trace("core.io.CharBuffer"));
+            try {
+                for (gint i = 0; i < count; i++)
+                    put((gchar) chars[i]);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.io.CharBuffer"));
+            }
+            return *this;
+        }
+
     } // core
 } // io
@@ -1321,6 +1321,54 @@ namespace core {
              */
             CharBuffer &append(gchar c);
 
+            /**
+             * Appends the specified character to this buffer&nbsp;&nbsp;<i>(optional operation)</i>.
+             */
+            template<class Chr, Class<gbool>::Iff<Class<Chr>::isCharacter()> = true>
+            CharBuffer &append(Chr &&c) {
+                return append((gchar) c);
+            }
+
+            /**
+             * Appends the decimal representation of the specified <b>int</b> to this
+             * buffer&nbsp;&nbsp;<i>(optional operation)</i>.
+             *
+             * <p> The digits are written directly in this buffer, without creation
+             * of String.
+             *
+             * @param  i
+             *         The <b>int</b> to append
+             *
+             * @return  This buffer
+             *
+             * @throws  BufferOverflowException
+             *          If there is insufficient space in this buffer
+             *
+             * @throws  ReadOnlyBufferException
+             *          If this buffer is read-only
+             */
+            CharBuffer &append(gint i);
+
+            /**
+             * Appends the decimal representation of the specified <b>long</b> to this
+             * buffer&nbsp;&nbsp;<i>(optional operation)</i>.
+             *
+             * <p> The digits are written directly in this buffer, without creation
+             * of String.
+             *
+             * @param  l
+             *         The <b>long</b> to append
+             *
+             * @return  This buffer
+             *
+             * @throws  BufferOverflowException
+             *          If there is insufficient space in this buffer
+             *
+             * @throws  ReadOnlyBufferException
+             *          If this buffer is read-only
+             */
+            CharBuffer &append(glong l);
+
             // -- Other byte stuff: Access to binary data --
             /**
              * Retrieves this buffer's byte order.
@@ -36,6 +36,7 @@ namespace core {
 
             CORE_FRATERNITY(::core::native::Unsafe);
             CORE_FRATERNITY_T1(::core::util::PriorityQueue);
+            CORE_FRATERNITY_T2(::core::util::TimSort);
 
         public:
             /**
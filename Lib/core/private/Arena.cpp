@@ -0,0 +1,122 @@
+//
+// Created by T.N.Brunshweeck on 15/10/2026.
+//
+
+#include "Arena.h"
+#include <core/Long.h>
+
+namespace core {
+
+    namespace native {
+
+        Arena::Arena() : Arena(DEFAULT_CHUNK_SIZE) {}
+
+        Arena::Arena(glong chunkSize) :
+                chunks(null), cursor(0), limit(0), chunkSize(chunkSize), used(0), finalizers(null) {
+            if (chunkSize <= 0)
+                IllegalArgumentException("Illegal chunk size: " + String::valueOf(chunkSize))
+                        .throws(__trace("core.private.Arena"));
+        }
+
+        Arena::Arena(Arena &&arena) CORE_NOTHROW:
+                chunks(null), cursor(0), limit(0), chunkSize(arena.chunkSize), used(0), finalizers(null) {
+            Unsafe::swapValues(chunks, arena.chunks);
+            Unsafe::swapValues(cursor, arena.cursor);
+            Unsafe::swapValues(limit, arena.limit);
+            Unsafe::swapValues(used, arena.used);
+            Unsafe::swapValues(finalizers, arena.finalizers);
+        }
+
+        glong Arena::allocateMemory(glong sizeInBytes) {
+            if (sizeInBytes < 0)
+                IllegalArgumentException("Illegal size: " + String::valueOf(sizeInBytes))
+                        .throws(__trace("core.private.Arena"));
+            glong const size = (sizeInBytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+            if (size > limit - cursor) {
+                // new chunk
+                glong const capacity = size > chunkSize - CHUNK_HEADER_SIZE ? size : chunkSize - CHUNK_HEADER_SIZE;
+                glong address = 0;
+                try {
+                    address = Unsafe::allocateMemory(CHUNK_HEADER_SIZE + capacity);
+                } catch (const Throwable &thr) {
+                    thr.throws(__trace("core.private.Arena"));
+                }
+                Chunk *chunk = (Chunk *) address;
+                chunk->size = CHUNK_HEADER_SIZE + capacity;
+                if (size > chunkSize - CHUNK_HEADER_SIZE && chunks != null) {
+                    // dedicated chunk, the current chunk remains used for the next allocations
+                    chunk->next = chunks->next;
+                    chunks->next = chunk;
+                    used += size;
+                    return address + CHUNK_HEADER_SIZE;
+                }
+                chunk->next = chunks;
+                chunks = chunk;
+                cursor = address + CHUNK_HEADER_SIZE;
+                limit = address + chunk->size;
+            }
+            glong const address = cursor;
+            cursor += size;
+            used += size;
+            return address;
+        }
+
+        void Arena::registerFinalizer(glong finalizer, glong address, void (*destroy)(glong)) {
+            Finalizer &f = *(Finalizer *) finalizer;
+            f.address = address;
+            f.destroy = destroy;
+            f.next = finalizers;
+            finalizers = &f;
+        }
+
+        gbool Arena::contains(glong address) const {
+            for (Chunk *chunk = chunks; chunk != null; chunk = chunk->next) {
+                glong const start = (glong) chunk;
+                if (address >= start + CHUNK_HEADER_SIZE && address < start + chunk->size)
+                    return true;
+            }
+            return false;
+        }
+
+        glong Arena::size() const {
+            return used;
+        }
+
+        void Arena::release() {
+            while (finalizers != null) {
+                Finalizer &f = *finalizers;
+                finalizers = f.next;
+                try {
+                    f.destroy(f.address);
+                } catch (...) {
+                    // the destructors must not throw
+                }
+            }
+            while (chunks != null) {
+                Chunk *chunk = chunks;
+                chunks = chunk->next;
+                Unsafe::freeMemory((glong) chunk);
+            }
+            cursor = limit = used = 0;
+        }
+
+        gbool Arena::equals(const Object &o) const {
+            return this == &o;
+        }
+
+        Object &Arena::clone() const {
+            CloneNotSupportedException("Arena is not cloneable").throws(__trace("core.private.Arena"));
+            return null;
+        }
+
+        String Arena::toString() const {
+            return "Arena[size=" + String::valueOf(used) + "]";
+        }
+
+        Arena::~Arena() {
+            release();
+        }
+
+    } // native
+
+} // core
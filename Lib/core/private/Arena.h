@@ -0,0 +1,262 @@
+//
+// Created by T.N.Brunshweeck on 15/10/2026.
+//
+
+#ifndef CORE23_ARENA_H
+#define CORE23_ARENA_H
+
+#include <core/private/Unsafe.h>
+
+namespace core {
+
+    namespace native {
+
+        /**
+         * The Arena class represent a region of native memory in which the objects
+         * sharing the same lifetime are allocated (for example, all temporary
+         * structures built for a request).
+         *
+         * <p>The memory is obtained from the system by large chunks, and each allocation
+         * only moves a cursor in the current chunk (bump-pointer allocation). The objects
+         * allocated in an arena are never released individually: all of them are destroyed
+         * (in reverse order of creation) and their memory is returned to the system in one
+         * call to <b style="color: orange;"> release</b> (or when the arena is destroyed).
+         *
+         * <p>The collections <b>ArrayList</b>, <b>LinkedList</b>, <b>HashMap</b> and <b>TreeMap</b>
+         * accept an arena at construction. In this case, all their internal nodes, tables and
+         * element copies are allocated from the arena, and the collection must not be used
+         * after the release of its arena.
+         *
+         * <p><strong>Note that this implementation is not synchronized.</strong>
+         *
+         * @author Brunshweeck Tazeussong
+         */
+        class Arena CORE_FINAL : public Object {
+        private:
+
+            /**
+             * The header of each chunk of memory
+             */
+            interface Chunk {
+                Chunk *next;
+                glong size;
+            };
+
+            /**
+             * The record used to destroy an object allocated in this arena
+             */
+            interface Finalizer {
+                Finalizer *next;
+                glong address;
+
+                void (*destroy)(glong address);
+            };
+
+            /**
+             * The list of chunks (the head is the current chunk)
+             */
+            Chunk *chunks;
+
+            /**
+             * The address of first free byte of current chunk
+             */
+            glong cursor;
+
+            /**
+             * The address of end of current chunk
+             */
+            glong limit;
+
+            /**
+             * The default size of new chunks
+             */
+            glong chunkSize;
+
+            /**
+             * The number of bytes allocated from this arena
+             */
+            glong used;
+
+            /**
+             * The list of objects to destroy on release (the head is the last created)
+             */
+            Finalizer *finalizers;
+
+            /**
+             * The alignment of all blocks allocated in this arena
+             */
+            static CORE_FAST glong ALIGNMENT = 16;
+
+            /**
+             * The size reserved for the header of each chunk (multiple of alignment)
+             */
+            static CORE_FAST glong CHUNK_HEADER_SIZE = (sizeof(Chunk) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+            /**
+             * The size reserved for each finalizer (multiple of alignment)
+             */
+            static CORE_FAST glong FINALIZER_SIZE = (sizeof(Finalizer) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+            /**
+             * Register the destruction of object at given address.
+             */
+            void registerFinalizer(glong finalizer, glong address, void (*destroy)(glong));
+
+            template<class T>
+            static void destroy(glong address) {
+                ((T *) address)->~T();
+            }
+
+            template<class T>
+            static void destroyHeapInstance(glong address) {
+                Unsafe::destroyInstance(*(T *) address);
+            }
+
+            template<class T,
+                    gbool isCopyable = Class<T>::isFinal() && Class<T>::template isConstructible<const T &>()>
+            class CopyImpl {
+            public:
+                static T &copy(Arena &arena, const T &x) {
+                    // the real type of x may be derived type of T: it is cloned on the heap
+                    T &copy = Unsafe::copyInstance(x);
+                    if (&copy != &x) {
+                        try {
+                            arena.registerFinalizer(arena.allocateMemory(FINALIZER_SIZE), (glong) &copy,
+                                                    &destroyHeapInstance<T>);
+                        } catch (const Throwable &thr) {
+                            Unsafe::destroyInstance(copy);
+                            thr.throws(__trace("core.private.Arena"));
+                        }
+                    }
+                    return copy;
+                }
+            };
+
+            template<class T>
+            class CopyImpl<T, true> {
+            public:
+                static T &copy(Arena &arena, const T &x) {
+                    return arena.allocateInstance<T>(x);
+                }
+            };
+
+            Arena(const Arena &) = delete;
+
+            Arena &operator=(const Arena &) = delete;
+
+        public:
+
+            /**
+             * The default size of chunks (64 KiB)
+             */
+            static CORE_FAST glong DEFAULT_CHUNK_SIZE = 1LL << 16;
+
+            /**
+             * Construct new empty arena with the default chunk size.
+             */
+            Arena();
+
+            /**
+             * Construct new empty arena with the given chunk size.
+             *
+             * @param chunkSize the size (in bytes) of each chunk obtained from the system.
+             *          the allocations greater than this size use a dedicated chunk.
+             * @throws IllegalArgumentException if the chunk size is not positive
+             */
+            CORE_EXPLICIT Arena(glong chunkSize);
+
+            /**
+             * Construct new arena with the content of given arena.
+             * the given arena becomes empty.
+             */
+            Arena(Arena &&arena) CORE_NOTHROW;
+
+            /**
+             * Allocates a new block of memory in this arena. The content of the
+             * block is uninitialized, and the block is aligned for all value types.
+             * The block is released with the arena.
+             *
+             * @param sizeInBytes the size of block
+             * @throws IllegalArgumentException if the size is negative
+             * @throws MemoryError if the allocation is refused by the system
+             */
+            glong allocateMemory(glong sizeInBytes);
+
+            /**
+             * Create new instance in this arena. The instance is destroyed
+             * when this arena is released.
+             *
+             * @param params the arguments of constructor
+             */
+            template<class T, class...Params>
+            T &allocateInstance(Params &&...params) {
+                CORE_STATIC_ASSERT(Class<T>::isClass(), "This method require class type");
+                glong const address = allocateMemory(FINALIZER_SIZE + (glong) sizeof(T));
+                T &instance = Unsafe::initializeInstance<T>(address + FINALIZER_SIZE,
+                                                            Unsafe::forwardInstance<Params>(params)...);
+                registerFinalizer(address, (glong) &instance, &destroy<T>);
+                return instance;
+            }
+
+            /**
+             * Copy the given instance in this arena. The copy is destroyed
+             * when this arena is released.
+             *
+             * <p>The final classes are copied in the arena, the others are
+             * cloned on heap (to keep their real type), and destroyed with this arena.
+             *
+             * @param o The instance to be copied
+             */
+            template<class T>
+            T &copyInstance(const T &o) {
+                CORE_STATIC_ASSERT(Class<Object>::isSuper<T>(), "Unsupported type");
+                if (null == o)
+                    return (T &) o;
+                return CopyImpl<T>::copy(*this, o);
+            }
+
+            /**
+             * Return true if the given address has been allocated in this arena.
+             */
+            gbool contains(glong address) const;
+
+            /**
+             * Return the number of bytes allocated from this arena.
+             */
+            glong size() const;
+
+            /**
+             * Destroy all objects created in this arena (in reverse order of creation)
+             * and return all chunks to the system. This arena can be reused after
+             * this operation.
+             */
+            void release();
+
+            /**
+             * Return true if the given object is this arena.
+             */
+            gbool equals(const Object &o) const override;
+
+            /**
+             * The arena is not cloneable.
+             *
+             * @throws CloneNotSupportedException
+             */
+            Object &clone() const override;
+
+            /**
+             * Return string representation of this arena.
+             */
+            String toString() const override;
+
+            /**
+             * Destroy this arena and all its objects.
+             */
+            ~Arena() override;
+        };
+
+    } // native
+
+} // core
+
+#endif //CORE23_ARENA_H
@@ -0,0 +1,338 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "CharsToInteger.h"
+#include <core/private/StringCoding.h>
+#include <core/String.h>
+#include <core/StringView.h>
+#include <core/native/CharArray.h>
+
+namespace core {
+
+    namespace native {
+
+        namespace {
+
+            CORE_FAST GENERIC_UINT64 MAX_UNSIGNED_LONG = 0xFFFFFFFFFFFFFFFFULL;
+
+            /**
+             * The digit value of the ASCII chars (or 36 for the chars that are not digit).
+             */
+            gint digit(gint ch) {
+                if (ch >= '0' && ch <= '9')
+                    return ch - '0';
+                ch |= 0x20; // to lower case
+                if (ch >= 'a' && ch <= 'z')
+                    return ch - 'a' + 10;
+                return 36;
+            }
+
+            /**
+             * Load the next eight chars in one word: the first char in the low byte. Return
+             * false if one of these chars is not LATIN1.
+             */
+            gbool load(const gbyte *chars, GENERIC_UINT64 &word) {
+                word = 0;
+                for (gint i = 0; i < 8; ++i)
+                    word |= (GENERIC_UINT64) (chars[i] & 0xFF) << (i << 3);
+                return true;
+            }
+
+            gbool load(const gchar *chars, GENERIC_UINT64 &word) {
+                word = 0;
+                gchar high = 0;
+                for (gint i = 0; i < 8; ++i) {
+                    word |= (GENERIC_UINT64) (chars[i] & 0xFF) << (i << 3);
+                    high |= chars[i];
+                }
+                return high < 0x100;
+            }
+
+            /**
+             * Return true if the eight bytes of the given word are ASCII decimal digits.
+             */
+            gbool isEightDigits(GENERIC_UINT64 word) {
+                // each byte in range [0x30, 0x39] has its high nibble equals to 3 before and after the addition of 6
+                return ((word & 0xF0F0F0F0F0F0F0F0ULL) |
+                        (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+            }
+
+            /**
+             * Return the value of the eight decimal digits of the given word (the first digit
+             * is the most significant).
+             */
+            GENERIC_UINT32 eightDigits(GENERIC_UINT64 word) {
+                word -= 0x3030303030303030ULL;
+                // the pairs of digits: 10 * d[i] + d[i + 1] in the bytes of even index
+                word = (word * 10) + (word >> 8);
+                // the quadruples of digits (100 * pair[0] + pair[1]) in the two halves, then their combination
+                word = (((word & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+                        (((word >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+                return (GENERIC_UINT32) word;
+            }
+
+            /**
+             * Parse the sign and the digits of the given chars. The magnitude is set only on
+             * success.
+             */
+            template<class Chr>
+            gint parse(const Chr *chars, gint count, gint base, gbool &negative, GENERIC_UINT64 &magnitude) {
+                if (count <= 0 || base < 2 || base > 36)
+                    return CharsToInteger::INVALID_FORMAT;
+                gint i = 0;
+                negative = false;
+                if (chars[0] == '-' || chars[0] == '+') {
+                    negative = chars[0] == '-';
+                    i = 1;
+                    if (i == count)
+                        return CharsToInteger::INVALID_FORMAT;
+                }
+                // the leading zeros have no effect on the value
+                while (i < count && chars[i] == '0')
+                    i += 1;
+                GENERIC_UINT64 value = 0;
+                if (base == 10) {
+                    // the value of 19 digits is always representable
+                    gint digits = 0;
+                    GENERIC_UINT64 word = 0;
+                    while (count - i >= 8 && digits <= 11 && load(chars + i, word) && isEightDigits(word)) {
+                        value = value * 100000000ULL + eightDigits(word);
+                        digits += 8;
+                        i += 8;
+                    }
+                }
+                GENERIC_UINT64 const limit = MAX_UNSIGNED_LONG / base;
+                gint const lastDigit = (gint) (MAX_UNSIGNED_LONG % base);
+                gbool overflow = false;
+                for (; i < count; ++i) {
+                    gint const d = chars[i] < 0x80 ? digit(chars[i]) : 36;
+                    if (d >= base)
+                        return CharsToInteger::INVALID_FORMAT;
+                    if (value > limit || (value == limit && d > lastDigit))
+                        // the remaining chars are only validated
+                        overflow = true;
+                    value = value * base + d;
+                }
+                if (overflow)
+                    return CharsToInteger::OUT_OF_RANGE;
+                magnitude = value;
+                return CharsToInteger::SUCCESS;
+            }
+
+            /**
+             * Parse the given chars as signed integer in range [-(limit + 1), limit].
+             */
+            template<class Chr>
+            gint parseSigned(const Chr *chars, gint count, gint base, GENERIC_UINT64 limit, glong &result) {
+                gbool negative = false;
+                GENERIC_UINT64 magnitude = 0;
+                gint const status = parse(chars, count, base, negative, magnitude);
+                if (status != CharsToInteger::SUCCESS)
+                    return status;
+                if (magnitude > limit + (negative ? 1 : 0))
+                    return CharsToInteger::OUT_OF_RANGE;
+                result = negative ? (glong) (0 - magnitude) : (glong) magnitude;
+                return CharsToInteger::SUCCESS;
+            }
+
+            /**
+             * Parse the given chars as unsigned integer in range [0, limit].
+             */
+            template<class Chr>
+            gint parseUnsigned(const Chr *chars, gint count, gint base, GENERIC_UINT64 limit, glong &result) {
+                gbool negative = false;
+                GENERIC_UINT64 magnitude = 0;
+                gint const status = parse(chars, count, base, negative, magnitude);
+                if (status != CharsToInteger::SUCCESS)
+                    return status;
+                if (negative)
+                    return CharsToInteger::INVALID_FORMAT;
+                if (magnitude > limit)
+                    return CharsToInteger::OUT_OF_RANGE;
+                result = (glong) magnitude;
+                return CharsToInteger::SUCCESS;
+            }
+
+            template<class Chr>
+            gint parse(const Chr *chars, gint count, gint base, gbool isSigned, GENERIC_UINT64 limit, glong &result) {
+                return isSigned ? parseSigned(chars, count, base, limit, result)
+                                : parseUnsigned(chars, count, base, limit, result);
+            }
+
+            /**
+             * Parse the chars stored at the given address with the given coder.
+             */
+            gint parse(glong src, gbyte coder, gint count, gint base, gbool isSigned, GENERIC_UINT64 limit,
+                       glong &result) {
+                return coder == StringCoding::LATIN1
+                       ? parse((const gbyte *) src, count, base, isSigned, limit, result)
+                       : parse((const gchar *) src, count, base, isSigned, limit, result);
+            }
+
+            /**
+             * Parse the chars in range [beginIndex, endIndex) of the given sequence.
+             */
+            gint parse(const CharSequence &csq, gint beginIndex, gint endIndex, gint base, gbool isSigned,
+                       GENERIC_UINT64 limit, glong &result) {
+                String::Span span;
+                if (Class<String>::hasInstance(csq))
+                    span = ((const String &) csq).span(beginIndex, endIndex);
+                else if (Class<StringView>::hasInstance(csq))
+                    span = ((const StringView &) csq).subView(beginIndex, endIndex).span();
+                else {
+                    // the other sequences are copied (on the stack for the common lengths)
+                    gint const count = endIndex - beginIndex;
+                    gchar buffer[64];
+                    if (count <= 64) {
+                        for (gint i = 0; i < count; ++i)
+                            buffer[i] = csq.charAt(beginIndex + i);
+                        return parse(buffer, count, base, isSigned, limit, result);
+                    }
+                    CharArray chars = CharArray(count);
+                    for (gint i = 0; i < count; ++i)
+                        chars[i] = csq.charAt(beginIndex + i);
+                    return parse(&chars[0], count, base, isSigned, limit, result);
+                }
+                return span.isLatin1() ? parse(span.latin1(), span.length(), base, isSigned, limit, result)
+                                       : parse(span.utf16(), span.length(), base, isSigned, limit, result);
+            }
+
+            /**
+             * The char at the given index (the LATIN1 bytes are unsigned).
+             */
+            gchar charAt(const gbyte *chars, gint index) { return (gchar) (chars[index] & 0xFF); }
+
+            gchar charAt(const gchar *chars, gint index) { return chars[index]; }
+
+            /**
+             * Parse the signed decimal values separated by the given delimiter.
+             */
+            template<class Chr, class T>
+            gint parseAll(const Chr *chars, gint length, gchar delimiter, GENERIC_UINT64 limit, T *dst,
+                          gint capacity, gint &count, gint &index) {
+                count = 0;
+                index = 0;
+                if (length == 0)
+                    return CharsToInteger::SUCCESS;
+                gint begin = 0;
+                while (true) {
+                    if (count == capacity) {
+                        // the delimiter before the remaining values
+                        index = begin == 0 ? 0 : begin - 1;
+                        return CharsToInteger::SUCCESS;
+                    }
+                    gint end = begin;
+                    while (end < length && charAt(chars, end) != delimiter)
+                        end += 1;
+                    glong value = 0;
+                    gint const status = parseSigned(chars + begin, end - begin, 10, limit, value);
+                    if (status != CharsToInteger::SUCCESS) {
+                        index = begin;
+                        return status;
+                    }
+                    dst[count++] = (T) value;
+                    if (end == length) {
+                        index = length;
+                        return CharsToInteger::SUCCESS;
+                    }
+                    begin = end + 1;
+                }
+            }
+
+            /**
+             * Parse the values of the given sequence separated by the given delimiter.
+             */
+            template<class T>
+            gint parseAll(const CharSequence &csq, gchar delimiter, GENERIC_UINT64 limit, T *dst,
+                          gint capacity, gint &count, gint &index) {
+                String::Span span;
+                if (Class<String>::hasInstance(csq))
+                    span = ((const String &) csq).span();
+                else if (Class<StringView>::hasInstance(csq))
+                    span = ((const StringView &) csq).span();
+                else {
+                    // the other sequences are copied once
+                    gint const length = csq.length();
+                    if (length == 0)
+                        return parseAll(span.latin1(), 0, delimiter, limit, dst, capacity, count, index);
+                    CharArray chars = CharArray(length);
+                    for (gint i = 0; i < length; ++i)
+                        chars[i] = csq.charAt(i);
+                    return parseAll(&chars[0], length, delimiter, limit, dst, capacity, count, index);
+                }
+                return span.isLatin1()
+                       ? parseAll(span.latin1(), span.length(), delimiter, limit, dst, capacity, count, index)
+                       : parseAll(span.utf16(), span.length(), delimiter, limit, dst, capacity, count, index);
+            }
+
+            CORE_FAST GENERIC_UINT64 MAX_INT = 0x7FFFFFFFULL;
+            CORE_FAST GENERIC_UINT64 MAX_LONG = 0x7FFFFFFFFFFFFFFFULL;
+            CORE_FAST GENERIC_UINT64 MAX_UNSIGNED_INT = 0xFFFFFFFFULL;
+        }
+
+        gint CharsToInteger::parseInt(glong src, gbyte coder, gint count, gint base, gint &result) {
+            glong value = 0;
+            gint const status = parse(src, coder, count, base, true, MAX_INT, value);
+            if (status == SUCCESS)
+                result = (gint) value;
+            return status;
+        }
+
+        gint CharsToInteger::parseLong(glong src, gbyte coder, gint count, gint base, glong &result) {
+            return parse(src, coder, count, base, true, MAX_LONG, result);
+        }
+
+        gint CharsToInteger::parseUnsignedInt(glong src, gbyte coder, gint count, gint base, gint &result) {
+            glong value = 0;
+            gint const status = parse(src, coder, count, base, false, MAX_UNSIGNED_INT, value);
+            if (status == SUCCESS)
+                result = (gint) value;
+            return status;
+        }
+
+        gint CharsToInteger::parseUnsignedLong(glong src, gbyte coder, gint count, gint base, glong &result) {
+            return parse(src, coder, count, base, false, MAX_UNSIGNED_LONG, result);
+        }
+
+        gint CharsToInteger::parseInt(const CharSequence &csq, gint beginIndex, gint endIndex, gint base,
+                                      gint &result) {
+            glong value = 0;
+            gint const status = parse(csq, beginIndex, endIndex, base, true, MAX_INT, value);
+            if (status == SUCCESS)
+                result = (gint) value;
+            return status;
+        }
+
+        gint CharsToInteger::parseLong(const CharSequence &csq, gint beginIndex, gint endIndex, gint base,
+                                       glong &result) {
+            return parse(csq, beginIndex, endIndex, base, true, MAX_LONG, result);
+        }
+
+        gint CharsToInteger::parseUnsignedInt(const CharSequence &csq, gint beginIndex, gint endIndex, gint base,
+                                              gint &result) {
+            glong value = 0;
+            gint const status = parse(csq, beginIndex, endIndex, base, false, MAX_UNSIGNED_INT, value);
+            if (status == SUCCESS)
+                result = (gint) value;
+            return status;
+        }
+
+        gint CharsToInteger::parseUnsignedLong(const CharSequence &csq, gint beginIndex, gint endIndex, gint base,
+                                               glong &result) {
+            return parse(csq, beginIndex, endIndex, base, false, MAX_UNSIGNED_LONG, result);
+        }
+
+        gint CharsToInteger::parseInts(const CharSequence &csq, gchar delimiter, gint *dst, gint capacity,
+                                       gint &count, gint &index) {
+            return parseAll(csq, delimiter, MAX_INT, dst, capacity, count, index);
+        }
+
+        gint CharsToInteger::parseLongs(const CharSequence &csq, gchar delimiter, glong *dst, gint capacity,
+                                        gint &count, gint &index) {
+            return parseAll(csq, delimiter, MAX_LONG, dst, capacity, count, index);
+        }
+
+    } // native
+
+} // core
@@ -0,0 +1,140 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#ifndef CORE23_CHARSTOINTEGER_H
+#define CORE23_CHARSTOINTEGER_H
+
+#include <core/Object.h>
+
+namespace core {
+
+    class CharSequence;
+
+    namespace native {
+
+        /**
+         * The conversion of the strings to the integers (used by Integer.parseInt,
+         * Long.parseLong, Integer.tryParse, ...).
+         *
+         * <p>The accepted strings have an optional sign ('+' or '-', the sign '-' is refused
+         * by the unsigned conversions), followed by at least one digit of the given base
+         * (the ASCII digits and letters, in lower or upper case). No whitespace is ignored.
+         *
+         * <p>The decimal digits are converted eight at a time: eight chars are loaded in one
+         * 64-bit word, validated with two masks, and combined with three multiplications
+         * (SWAR: SIMD within a register). The digits of the other bases are converted one at
+         * a time.
+         *
+         * <p>The chars are read directly from their storage (one byte per char with LATIN1
+         * coder, two bytes per char with UTF16 coder, see StringCoding). None of these
+         * methods perform bounds checks, nor allocate memory, nor throw exception: the
+         * result of the conversion is given by the returned status.
+         *
+         * @author Brunshweeck Tazeussong
+         */
+        class CharsToInteger CORE_FINAL : public Object {
+        private:
+            CharsToInteger() = default;
+
+        public:
+
+            /**
+             * The status of the successful conversion.
+             */
+            static CORE_FAST gint SUCCESS = 0;
+
+            /**
+             * The status of the conversion of chars that have not the format of integer.
+             */
+            static CORE_FAST gint INVALID_FORMAT = 1;
+
+            /**
+             * The status of the conversion of integer that is not representable by the
+             * target type.
+             */
+            static CORE_FAST gint OUT_OF_RANGE = 2;
+
+            /**
+             * Set the given result with the int value of the given chars in the given base
+             * (in range [2, 36]), and return the status of the conversion.
+             */
+            static gint parseInt(glong src, gbyte coder, gint count, gint base, gint &result);
+
+            /**
+             * Set the given result with the long value of the given chars in the given base
+             * (in range [2, 36]), and return the status of the conversion.
+             */
+            static gint parseLong(glong src, gbyte coder, gint count, gint base, glong &result);
+
+            /**
+             * Set the given result with the unsigned int value of the given chars in the
+             * given base (in range [2, 36]), and return the status of the conversion.
+             */
+            static gint parseUnsignedInt(glong src, gbyte coder, gint count, gint base, gint &result);
+
+            /**
+             * Set the given result with the unsigned long value of the given chars in the
+             * given base (in range [2, 36]), and return the status of the conversion.
+             */
+            static gint parseUnsignedLong(glong src, gbyte coder, gint count, gint base, glong &result);
+
+            /**
+             * Set the given result with the int value of the chars of given sequence in
+             * range [beginIndex, endIndex), and return the status of the conversion. The
+             * range is not checked.
+             *
+             * <p>The chars of String and StringView are read from the storage of their
+             * string (without copy).
+             */
+            static gint parseInt(const CharSequence &csq, gint beginIndex, gint endIndex, gint base, gint &result);
+
+            /**
+             * Set the given result with the long value of the chars of given sequence in
+             * range [beginIndex, endIndex), and return the status of the conversion. The
+             * range is not checked.
+             */
+            static gint parseLong(const CharSequence &csq, gint beginIndex, gint endIndex, gint base, glong &result);
+
+            /**
+             * Set the given result with the unsigned int value of the chars of given
+             * sequence in range [beginIndex, endIndex), and return the status of the
+             * conversion. The range is not checked.
+             */
+            static gint parseUnsignedInt(const CharSequence &csq, gint beginIndex, gint endIndex, gint base,
+                                         gint &result);
+
+            /**
+             * Set the given result with the unsigned long value of the chars of given
+             * sequence in range [beginIndex, endIndex), and return the status of the
+             * conversion. The range is not checked.
+             */
+            static gint parseUnsignedLong(const CharSequence &csq, gint beginIndex, gint endIndex, gint base,
+                                          glong &result);
+
+            /**
+             * Parse the decimal int values of given sequence separated by the given delimiter,
+             * store them in the given array (with room for <b style="color: orange;">
+             * capacity</b> values), and return the status of the conversion.
+             *
+             * <p>The count is set with the number of stored values, and the index with the
+             * index of first char not consumed: the beginning of the invalid value on failure,
+             * otherwise the length of sequence, or the delimiter that follows the last stored
+             * value if the capacity is reached. The empty sequence contains no value.
+             */
+            static gint parseInts(const CharSequence &csq, gchar delimiter, gint *dst, gint capacity,
+                                  gint &count, gint &index);
+
+            /**
+             * Parse the decimal long values of given sequence separated by the given delimiter,
+             * as <b style="color: orange;"> parseInts</b>.
+             */
+            static gint parseLongs(const CharSequence &csq, gchar delimiter, glong *dst, gint capacity,
+                                   gint &count, gint &index);
+        };
+
+    } // native
+
+} // core
+
+#endif //CORE23_CHARSTOINTEGER_H
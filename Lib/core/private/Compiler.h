@@ -1191,6 +1191,37 @@
 #endif
 
 
+/*
+    Instruction sets enabled by the compiler options
+*/
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CORE_XCOMPILER_SSE2
+#endif
+#if defined(__SSE3__)
+#define CORE_XCOMPILER_SSE3
+#endif
+#if defined(__SSSE3__)
+#define CORE_XCOMPILER_SSSE3
+#endif
+#if defined(__SSE4_1__)
+#define CORE_XCOMPILER_SSE4_1
+#endif
+#if defined(__SSE4_2__)
+#define CORE_XCOMPILER_SSE4_2
+#endif
+#if defined(__AVX__)
+#define CORE_XCOMPILER_AVX
+#endif
+#if defined(__AVX2__)
+#define CORE_XCOMPILER_AVX2
+#endif
+#if defined(__F16C__)
+#define CORE_XCOMPILER_F16C
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define CORE_XCOMPILER_NEON
+#endif
+
 /*
     Sanitize compiler feature availability
 */
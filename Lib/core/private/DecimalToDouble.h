@@ -0,0 +1,78 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#ifndef CORE23_DECIMALTODOUBLE_H
+#define CORE23_DECIMALTODOUBLE_H
+
+#include <core/Object.h>
+
+namespace core {
+
+    class CharSequence;
+
+    namespace native {
+
+        /**
+         * The conversion of the decimal (and hexadecimal) strings to the floating-point
+         * values (used by Double.parseDouble and Float.parseFloat).
+         *
+         * <p>The accepted strings have the format described by Double.valueOf(String): an
+         * optional sign, followed by "NaN", "Infinity", a decimal number with an optional
+         * exponent, or a hexadecimal number with a binary exponent, followed by an optional
+         * type suffix (f, F, d or D). The leading and trailing chars less than or equal to
+         * U+0020 are ignored.
+         *
+         * <p>The result is correctly rounded (round half to even). The decimals with at
+         * most 19 significant digits are converted with the Eisel-Lemire algorithm (one or
+         * two 128-bit multiplications by the table of powers of five). Longer decimals
+         * are converted with their first 19 digits when this is sufficient to find the
+         * rounded result, and with exact decimal arithmetic otherwise.
+         *
+         * <p>The chars are read directly from their storage (one byte per char with LATIN1
+         * coder, two bytes per char with UTF16 coder, see StringCoding). None of these
+         * methods perform bounds checks, nor allocate memory for the common strings.
+         *
+         * @author Brunshweeck Tazeussong
+         */
+        class DecimalToDouble CORE_FINAL : public Object {
+        private:
+            DecimalToDouble() = default;
+
+        public:
+
+            /**
+             * Set the given result with the double value of the given chars, and return
+             * true, or return false if these chars have not the format of double.
+             */
+            static gbool parseDouble(glong src, gbyte coder, gint count, gdouble &result);
+
+            /**
+             * Set the given result with the float value of the given chars, and return
+             * true, or return false if these chars have not the format of float.
+             */
+            static gbool parseFloat(glong src, gbyte coder, gint count, gfloat &result);
+
+            /**
+             * Set the given result with the double value of the chars of given sequence
+             * in range [beginIndex, endIndex), and return true, or return false if these
+             * chars have not the format of double. The range is not checked.
+             *
+             * <p>The chars of String and StringView are read from the storage of their
+             * string (without copy).
+             */
+            static gbool parseDouble(const CharSequence &csq, gint beginIndex, gint endIndex, gdouble &result);
+
+            /**
+             * Set the given result with the float value of the chars of given sequence
+             * in range [beginIndex, endIndex), and return true, or return false if these
+             * chars have not the format of float. The range is not checked.
+             */
+            static gbool parseFloat(const CharSequence &csq, gint beginIndex, gint endIndex, gfloat &result);
+        };
+
+    } // native
+
+} // core
+
+#endif //CORE23_DECIMALTODOUBLE_H
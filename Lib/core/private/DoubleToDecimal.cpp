@@ -0,0 +1,962 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "DoubleToDecimal.h"
+#include <core/Double.h>
+#include <core/Float.h>
+#include <core/Math.h>
+
+namespace core {
+
+    namespace native {
+
+        namespace {
+
+            /**
+             * The precision (in bits), the minimum exponent, the minimum normal
+             * significand and the limit of tiny significand of double values.
+             */
+            CORE_FAST gint DOUBLE_P = 53;
+            CORE_FAST gint DOUBLE_Q_MIN = -1074;
+            CORE_FAST glong DOUBLE_C_MIN = 1LL << (DOUBLE_P - 1);
+            CORE_FAST glong DOUBLE_C_TINY = 3;
+
+            /**
+             * The precision (in bits), the minimum exponent, the minimum normal
+             * significand and the limit of tiny significand of float values.
+             */
+            CORE_FAST gint FLOAT_P = 24;
+            CORE_FAST gint FLOAT_Q_MIN = -149;
+            CORE_FAST gint FLOAT_C_MIN = 1 << (FLOAT_P - 1);
+            CORE_FAST gint FLOAT_C_TINY = 8;
+
+            CORE_FAST glong MASK_32 = (1LL << 32) - 1;
+            CORE_FAST glong MASK_63 = (glong) (((GENERIC_UINT64) 1 << 63) - 1);
+
+            /**
+             * The smallest and the largest decimal exponent of the table G.
+             */
+            CORE_FAST gint K_MIN = -324;
+            CORE_FAST gint K_MAX = 292;
+
+            /**
+             * The 126-bit approximations of the powers of ten: for k in [K_MIN, K_MAX],
+             * let r = flog2pow10(-k) - 125, and g = floor(10^(-k) / 2^r) + 1 (with
+             * 2^125 < g < 2^126). The table stores g1 = g / 2^63 at index 2(k - K_MIN),
+             * and g0 = g mod 2^63 at index 2(k - K_MIN) + 1.
+             */
+            CORE_FAST glong G[(K_MAX - K_MIN + 1) << 1] = {
+                0x4F0CEDC95A718DD4LL, 0x5B01E8B09AA0D1B5LL, // -324
+                0x7E7B160EF71C1621LL, 0x119CA780F767B5EELL, // -323
+                0x652F44D8C5B011B4LL, 0x0E16EC672C52F7F2LL, // -322
+                0x50F29D7A37C00E29LL, 0x581256B8F0425FF5LL, // -321
+                0x40C21794F96671BALL, 0x79A84560C0351991LL, // -320
+                0x679CF287F570B5F7LL, 0x75DA089ACD21C281LL, // -319
+                0x52E3F5399126F7F9LL, 0x44AE6D48A41B0201LL, // -318
+                0x424FF76140EBF994LL, 0x36F1F106E9AF34CDLL, // -317
+                0x6A198BCECE465C20LL, 0x57E981A4A918547BLL, // -316
+                0x54E13CA571D1E34DLL, 0x2CBACE1D541376C9LL, // -315
+                0x43E763B78E4182A4LL, 0x23C8A4E44342C56ELL, // -314
+                0x6CA56C58E39C043ALL, 0x060DD4A06B9E08B0LL, // -313
+                0x56EABD13E9499CFBLL, 0x1E7176E6BC7E6D59LL, // -312
+                0x458897432107B0C8LL, 0x7EC12BEBC9FEBDE1LL, // -311
+                0x6F40F20501A5E7A7LL, 0x7E01DFDFA9979635LL, // -310
+                0x5900C19D9AEB1FB9LL, 0x4B34B319547944F7LL, // -309
+                0x4733CE17AF227FC7LL, 0x55C3C27AA9FA9D93LL, // -308
+                0x71EC7CF2B1D0CC72LL, 0x560603F7765DC8EALL, // -307
+                0x5B2397288E40A38ELL, 0x7804CFF92B7E3A55LL, // -306
+                0x48E945BA0B66E93FLL, 0x13370CC755FE9511LL, // -305
+                0x74A86F90123E41FELL, 0x51F1AE0BBCCA881BLL, // -304
+                0x5D538C7341CB67FELL, 0x74C1580963D539AFLL, // -303
+                0x4AA93D29016F8665LL, 0x43CDE0078310FAF3LL, // -302
+                0x77752EA8024C0A3CLL, 0x0616333F381B2B1ELL, // -301
+                0x5F90F22001D66E96LL, 0x3811C298F9AF55B1LL, // -300
+                0x4C73F4E667DEBEDELL, 0x600E35472E25DE28LL, // -299
+                0x7A532170A6313164LL, 0x3349EED849D6303FLL, // -298
+                0x61DC1AC084F42783LL, 0x42A18BE03B11C033LL, // -297
+                0x4E49AF006A5CEC69LL, 0x1BB46FE695A7CCF5LL, // -296
+                0x7D42B19A43C7E0A8LL, 0x2C53E63DBC3FAE55LL, // -295
+                0x64355AE1CFD31A20LL, 0x237651CAFCFFBEAALL, // -294
+                0x502AAF1B0CA8E1B3LL, 0x35F8416F30CC9888LL, // -293
+                0x402225AF3D53E7C2LL, 0x5E603458F3D6E06DLL, // -292
+                0x669D0918621FD937LL, 0x4A3386F4B957CD7BLL, // -291
+                0x52173A79E8197A92LL, 0x6E8F9F2A2DDFD796LL, // -290
+                0x41AC2EC7ECE12EDBLL, 0x720C7F54F17FDFABLL, // -289
+                0x69137E0CAE3517C6LL, 0x1CE0CBBB1BFFCC45LL, // -288
+                0x540F980A24F74638LL, 0x171A3C95AFFFD69ELL, // -287
+                0x433FACD4EA5F6B60LL, 0x127B63AAF3331218LL, // -286
+                0x6B991487DD657899LL, 0x6A5F05DE51EB5026LL, // -285
+                0x5614106CB11DFA14LL, 0x5518D17EA7EF7352LL, // -284
+                0x44DCD9F08DB194DDLL, 0x2A7A41321FF2C2A8LL, // -283
+                0x6E2E2980E2B5BAFBLL, 0x5D906850331E043FLL, // -282
+                0x5824EE00B55E2F2FLL, 0x647386A68F4B3699LL, // -281
+                0x4683F19A2AB1BF59LL, 0x36C2D21ED908F87BLL, // -280
+                0x70D31C29DDE93228LL, 0x579E1CFE280E5A5DLL, // -279
+                0x5A427CEE4B20F4EDLL, 0x2C7E7D98200B7B7ELL, // -278
+                0x483530BEA280C3F1LL, 0x09FECAE019A2C932LL, // -277
+                0x73884DFDD0CE064ELL, 0x43314499C29E0EB6LL, // -276
+                0x5C6D0B3173D8050BLL, 0x4F5A9D47CEE4D891LL, // -275
+                0x49F0D5C129799DA2LL, 0x72AEE4397250AD41LL, // -274
+                0x764E22CEA8C295D1LL, 0x377E39F583B44868LL, // -273
+                0x5EA4E8A553CEDE41LL, 0x12CB61913629D387LL, // -272
+                0x4BB72084430BE500LL, 0x756F8140F8217605LL, // -271
+                0x792500D39E796E67LL, 0x6F18CECE59CF233CLL, // -270
+                0x60EA670FB1FABEB9LL, 0x3F470BD847D8E8FDLL, // -269
+                0x4D885272F4C89894LL, 0x329F3CAD064720CALL, // -268
+                0x7C0D50B7EE0DC0EDLL, 0x37652DE1A3A50143LL, // -267
+                0x633DDA2CBE716724LL, 0x2C50F1814FB73436LL, // -266
+                0x4F64AE8A31F45283LL, 0x3D0D8E010C92902BLL, // -265
+                0x7F077DA9E986EA6BLL, 0x7B48E334E0EA8045LL, // -264
+                0x659F97BB2138BB89LL, 0x49071C2A4D88669DLL, // -263
+                0x514C796280FA2FA1LL, 0x20D27CEEA46D1EE4LL, // -262
+                0x4109FAB533FB594DLL, 0x670ECA58838A7F1DLL, // -261
+                0x680FF788532BC216LL, 0x0B4ADD5A6C10CB62LL, // -260
+                0x533FF939DC2301ABLL, 0x22A24AAEBCDA3C4ELL, // -259
+                0x4299942E49B59AEFLL, 0x354EA22563E1C9D8LL, // -258
+                0x6A8F537D42BC2B18LL, 0x554A9D089FCFA95ALL, // -257
+                0x553F75FDCEFCEF46LL, 0x776EE406E63FBAAELL, // -256
+                0x4432C4CB0BFD8C38LL, 0x5F8BE99F1E996225LL, // -255
+                0x6D1E07AB466279F4LL, 0x327975CB64289D08LL, // -254
+                0x574B3955D1E86190LL, 0x28612B091CED4A6DLL, // -253
+                0x45D5C777DB204E0DLL, 0x06B4226DB0BDD524LL, // -252
+                0x6FBC72595E9A167BLL, 0x24536A491AC95506LL, // -251
+                0x59638EADE54811FCLL, 0x1D0F883A7BD44405LL, // -250
+                0x4782D88B1DD34196LL, 0x4A72D361FCA9D004LL, // -249
+                0x726AF411C952028ALL, 0x43EAEBCFFAA94CD3LL, // -248
+                0x5B88C3416DDB353BLL, 0x4FEF230CC88770A9LL, // -247
+                0x493A35CDF17C2A96LL, 0x0CBF4F3D6D3926EELL, // -246
+                0x7529EFAFE8C6AA89LL, 0x61321862485B717CLL, // -245
+                0x5DBB262653D22207LL, 0x675B46B506AF8DFDLL, // -244
+                0x4AFC1E850FDB4E6CLL, 0x52AF6BC405593E64LL, // -243
+                0x77F9CA6E7FC54A47LL, 0x377F12D33BC1FD6DLL, // -242
+                0x5FFB085866376E9FLL, 0x45FF42429634CABDLL, // -241
+                0x4CC8D379EB5F8BB2LL, 0x6B329B68782A3BCBLL, // -240
+                0x7ADAEBF64565AC51LL, 0x2B842BDA59DD2C77LL, // -239
+                0x6248BCC5045156A7LL, 0x3C69BCAEAE4A89F9LL, // -238
+                0x4EA0970403744552LL, 0x6387CA25583BA194LL, // -237
+                0x7DCDBE6CD253A21ELL, 0x05A6103BC05F68EDLL, // -236
+                0x64A498570EA94E7ELL, 0x37B80CFC99E5ED8ALL, // -235
+                0x5083AD1272210B98LL, 0x2C933D96E184BE08LL, // -234
+                0x40695741F4E73C79LL, 0x7075CADF1AD09807LL, // -233
+                0x670EF2032171FA5CLL, 0x4D8944982AE759A4LL, // -232
+                0x52725B35B45B2EB0LL, 0x3E076A135585E150LL, // -231
+                0x41F515C49048F226LL, 0x64D2BB42AAD1810DLL, // -230
+                0x698822D41A0E503ELL, 0x07B7920444826815LL, // -229
+                0x546CE8A9AE71D9CBLL, 0x1FC60E69D0685344LL, // -228
+                0x438A53BAF1F4AE3CLL, 0x196B3EBB0D20429DLL, // -227
+                0x6C1085F7E9877D2DLL, 0x0F11FDF815006A94LL, // -226
+                0x56739E5FEE05FDBDLL, 0x58DB319344005543LL, // -225
+                0x45294B7FF19E6497LL, 0x60AF5ADC3666AA9CLL, // -224
+                0x6EA878CCB5CA3A8CLL, 0x344BC4938A3DDDC7LL, // -223
+                0x5886C70A2B082ED6LL, 0x5D096A0FA1CB17D2LL, // -222
+                0x46D238D4EF39BF12LL, 0x173ABB3FB4A27975LL, // -221
+                0x71505AEE4B8F981DLL, 0x0B912B992103F588LL, // -220
+                0x5AA6AF25093FACE4LL, 0x0940EFADB4032AD3LL, // -219
+                0x488558EA6DCC8A50LL, 0x07672624900288A9LL, // -218
+                0x74088E43E2E0DD4CLL, 0x723EA36DB337410ELL, // -217
+                0x5CD3A5031BE71770LL, 0x5B654F8AF5C5CDA5LL, // -216
+                0x4A42EA68E31F45F3LL, 0x62B772D5916B0AEBLL, // -215
+                0x76D1770E38320986LL, 0x0458B7BC1BDE77DDLL, // -214
+                0x5F0DF8D82CF4D46BLL, 0x1D13C630164B9318LL, // -213
+                0x4C0B2D79BD90A9EFLL, 0x30DC9E8CDEA2DC13LL, // -212
+                0x79AB7BF5FC1AA97FLL, 0x0160FDAE31049351LL, // -211
+                0x6155FCC4C9AEEDFFLL, 0x1AB3FE24F403A90ELL, // -210
+                0x4DDE63D0A158BE65LL, 0x6229981D9002EDA5LL, // -209
+                0x7C97061A9BC130A2LL, 0x69DC2695B337E2A1LL, // -208
+                0x63AC04E2163426E8LL, 0x54B01EDE28F9821BLL, // -207
+                0x4FBCD0B4DE901F20LL, 0x43C018B1BA6134E2LL, // -206
+                0x7F9481216419CB67LL, 0x1F99C11C5D68549DLL, // -205
+                0x6610674DE9AE3C52LL, 0x4C7B00E37DED107ELL, // -204
+                0x51A6B90B21583042LL, 0x09FC00B5FE574065LL, // -203
+                0x41522DA2811359CELL, 0x3B3000919845CD1DLL, // -202
+                0x68837C3734EBC2E3LL, 0x784CCDB5C06FAE95LL, // -201
+                0x539C635F5D8968B6LL, 0x2D0A3E2B00595877LL, // -200
+                0x42E382B2B13ABA2BLL, 0x3DA1CB5599E11393LL, // -199
+                0x6B059DEAB52AC378LL, 0x629C7888F634EC1ELL, // -198
+                0x559E17EEF755692DLL, 0x3549FA072B5D89B1LL, // -197
+                0x447E798BF91120F1LL, 0x1107FB38EF7E07C1LL, // -196
+                0x6D9728DFF4E834B5LL, 0x01A65EC17F300C68LL, // -195
+                0x57AC20B32A535D5DLL, 0x4E1EB23465C009EDLL, // -194
+                0x46234D5C21DC4AB1LL, 0x24E55B5D1E333B24LL, // -193
+                0x70387BC69C93AAB5LL, 0x216EF894FD1EC506LL, // -192
+                0x59C6C96BB076222ALL, 0x4DF2607730E56A6CLL, // -191
+                0x47D23ABC8D2B4E88LL, 0x3E5B805F5A5121F0LL, // -190
+                0x72E9F79415121740LL, 0x63C59A322A1B697FLL, // -189
+                0x5BEE5FA9AA74DF67LL, 0x03047B5B54E2BACCLL, // -188
+                0x498B7FBAEEC3E5ECLL, 0x0269FC4910B5623DLL, // -187
+                0x75ABFF917E063CACLL, 0x6A432D41B45569FBLL, // -186
+                0x5E2332DACB38308ALL, 0x21CF5767C37787FCLL, // -185
+                0x4B4F5BE23C2CF3A1LL, 0x67D912B9692C6CCALL, // -184
+                0x787EF969F9E185CFLL, 0x595B5128A8471476LL, // -183
+                0x60659454C7E79E3FLL, 0x6115DA86ED05A9F8LL, // -182
+                0x4D1E1043D31FB1CCLL, 0x4DAB1538BD9E2193LL, // -181
+                0x7B634D3951CC4FADLL, 0x62AB552795C9CF52LL, // -180
+                0x62B5D7610E3D0C8BLL, 0x0222AA86116E3F75LL, // -179
+                0x4EF7DF80D830D6D5LL, 0x4E822204DABE992ALL, // -178
+                0x7E59659AF38157BCLL, 0x17369CD49130F510LL, // -177
+                0x65145148C2CDDFC9LL, 0x5F5EE3DD40F3F740LL, // -176
+                0x50DD0DD3CF0B196ELL, 0x1918B64A9A5CC5CDLL, // -175
+                0x40B0D7DCA5A27ABELL, 0x4746F83BAEB09E3ELL, // -174
+                0x678159610903F797LL, 0x253E59F91780FD2FLL, // -173
+                0x52CDE11A6D9CC612LL, 0x50FEAE60DF9A6426LL, // -172
+                0x423E4DAEBE1704DBLL, 0x5A65584D7FAEB685LL, // -171
+                0x69FD4917968B3AF9LL, 0x10A226E265E4573BLL, // -170
+                0x54CAA0DFABA29594LL, 0x0D4E8581EB1D1295LL, // -169
+                0x43D54D7FBC821143LL, 0x243ED134BC174211LL, // -168
+                0x6C887BFF94034ED2LL, 0x06CAE85460253682LL, // -167
+                0x56D396661002A574LL, 0x6BD586A9E6842B9BLL, // -166
+                0x457611EB40021DF7LL, 0x09779EEE52035616LL, // -165
+                0x6F234FDECCD02FF1LL, 0x5BF297E3B66BBCEFLL, // -164
+                0x58E90CB23D73598ELL, 0x165BACB62B8963F3LL, // -163
+                0x4720D6F4FDF5E13ELL, 0x451623C4EFA11CC2LL, // -162
+                0x71CE24BB2FEFCECALL, 0x3B569FA17F682E03LL, // -161
+                0x5B0B5095BFF30BD5LL, 0x15DEE61ACC535803LL, // -160
+                0x48D5DA11665C0977LL, 0x2B18B8157042ACCFLL, // -159
+                0x74895CE8A3C6758BLL, 0x5E8DF355806AAE18LL, // -158
+                0x5D3AB0BA1C9EC46FLL, 0x653E5C4466BBBE7ALL, // -157
+                0x4A955A2E7D4BD059LL, 0x3765169D1EFC9861LL, // -156
+                0x77555D172EDFB3C2LL, 0x256E8A94FE60F3CFLL, // -155
+                0x5F777DAC257FC301LL, 0x6ABED543FEB3F63FLL, // -154
+                0x4C5F97BCEACC9C01LL, 0x3BCBDDCFFEF65E99LL, // -153
+                0x7A328C6177ADC668LL, 0x5FAC961997F0975BLL, // -152
+                0x61C209E792F16B86LL, 0x7FBD44E1465A12AFLL, // -151
+                0x4E34D4B9425ABC6BLL, 0x7FCA9D810514DBBFLL, // -150
+                0x7D21545B9D5DFA46LL, 0x32DDC8CE6E87C5FFLL, // -149
+                0x641AA9E2E44B2E9ELL, 0x5BE4A0A525396B32LL, // -148
+                0x501554B5836F587ELL, 0x7CB6E6EA842DEF5CLL, // -147
+                0x4011109135F2AD32LL, 0x30925255368B25E3LL, // -146
+                0x6681B41B89844850LL, 0x4DB6EA21F0DEA304LL, // -145
+                0x52015CE2D469D373LL, 0x57C5881B2718826ALL, // -144
+                0x419AB0B576BB0F8FLL, 0x5FD139AF527A01EFLL, // -143
+                0x68F781225791B27FLL, 0x4C81F5E550C3364ALL, // -142
+                0x53F9341B79415B99LL, 0x239B2B1DDA35C508LL, // -141
+                0x432DC3492DCDE2E1LL, 0x02E288E4AE916A6DLL, // -140
+                0x6B7C6BA849496B01LL, 0x516A74A1174F10AELL, // -139
+                0x55FD22ED076DEF34LL, 0x4121F6E745D8DA25LL, // -138
+                0x44CA82573924BF5DLL, 0x1A8192529E4714EBLL, // -137
+                0x6E10D08B8EA1322ELL, 0x5D9C1D50FD3E87DDLL, // -136
+                0x580D73A2D880F4F2LL, 0x17B01773FDCB9FE4LL, // -135
+                0x4671294F139A5D8ELL, 0x4626792997D61984LL, // -134
+                0x70B50EE4EC2A2F4ALL, 0x3D0A5B75BFBCF59FLL, // -133
+                0x5A2A7250BCEE8C3BLL, 0x4A6EAF916630C47FLL, // -132
+                0x4821F50D63F209C9LL, 0x21F2260DEB5A36CCLL, // -131
+                0x736988156CB6760ELL, 0x69837016455D247ALL, // -130
+                0x5C546CDDF091F80BLL, 0x6E02C011D1175062LL, // -129
+                0x49DD23E4C074C66FLL, 0x719BCCDB0DAC404ELL, // -128
+                0x762E9FD467213D7FLL, 0x68F947C4E2AD33B0LL, // -127
+                0x5E8BB3105280FDFFLL, 0x6D94396A4EF0F627LL, // -126
+                0x4BA2F5A6A8673199LL, 0x3E102DEEA58D91B9LL, // -125
+                0x7904BC3DDA3EB5C2LL, 0x3019E3176F48E927LL, // -124
+                0x60D09697E1CBC49BLL, 0x4014B5AC590720ECLL, // -123
+                0x4D73ABACB4A303AFLL, 0x4CDD5E237A6C1A57LL, // -122
+                0x7BEC45E12104D2B2LL, 0x47C8969F2A46908ALL, // -121
+                0x63236B1A80D0A88ELL, 0x6CA0787F5505406FLL, // -120
+                0x4F4F88E200A6ED3FLL, 0x0A19F9FF773766BFLL, // -119
+                0x7EE5A7D0010B1531LL, 0x5CF65CCBF1F23DFELL, // -118
+                0x6584864000D5AA8ELL, 0x172B7D6FF4C1CB32LL, // -117
+                0x5136D1CCCD77BBA4LL, 0x78EF978CC3CE3C28LL, // -116
+                0x40F8A7D70AC62FB7LL, 0x13F2DFA3CFD83020LL, // -115
+                0x67F43FBE77A37F8BLL, 0x398499061959E699LL, // -114
+                0x5329CC985FB5FFA2LL, 0x6136E0D1ADE18548LL, // -113
+                0x4287D6E04C91994FLL, 0x00F8B3DAF181376DLL, // -112
+                0x6A72F166E0E8F54BLL, 0x1B27862B1C01F247LL, // -111
+                0x5528C11F1A53F76FLL, 0x2F52D1BC1667F506LL, // -110
+                0x44209A7F48432C59LL, 0x0C424163451FF738LL, // -109
+                0x6D00F7320D3846F4LL, 0x7A039BD208332526LL, // -108
+                0x5733F8F4D76038C3LL, 0x7B361641A028EA85LL, // -107
+                0x45C32D90AC4CFA36LL, 0x2F5E78348020BB9ELL, // -106
+                0x6F9EAF4DE07B29F0LL, 0x4BCA59ED99CDF8FCLL, // -105
+                0x594BBF71806287F3LL, 0x563B7B247B0B2D96LL, // -104
+                0x476FCC5ACD1B9FF6LL, 0x11C92F50626F57ACLL, // -103
+                0x724C7A2AE1C5CCBDLL, 0x02DB7EE703E55912LL, // -102
+                0x5B7061BBE7D17097LL, 0x1BE2CBEC031DE0DCLL, // -101
+                0x4926B496530DF3ACLL, 0x164F09899C17E716LL, // -100
+                0x750ABA8A1E7CB913LL, 0x3D4B4275C68CA4F0LL, // -99
+                0x5DA22ED4E530940FLL, 0x4AA29B916BA3B726LL, // -98
+                0x4AE825771DC07672LL, 0x6EE87C74561C9285LL, // -97
+                0x77D9D58B62CD8A51LL, 0x3173FA53BCFA8408LL, // -96
+                0x5FE177A2B5713B74LL, 0x278FFB7630C869A0LL, // -95
+                0x4CB45FB55DF42F90LL, 0x1FA662C4F3D387B3LL, // -94
+                0x7ABA32BBC986B280LL, 0x32A3D13B1FB8D91FLL, // -93
+                0x622E8EFCA1388ECDLL, 0x0EE9742F4C93E0E6LL, // -92
+                0x4E8BA596E760723DLL, 0x58BAC3590A0FE71ELL, // -91
+                0x7DAC3C24A5671D2FLL, 0x412AD228101971C9LL, // -90
+                0x6489C9B6EAB8E426LL, 0x00EF0E8673478E3BLL, // -89
+                0x506E3AF8BBC71CEBLL, 0x1A58D86B8F6C71C9LL, // -88
+                0x40582F2D6305B0BCLL, 0x1513E0560C56C16ELL, // -87
+                0x66F37EAF04D5E793LL, 0x3B530089AD579BE2LL, // -86
+                0x525C6558D0AB1FA9LL, 0x15DC006E2446164FLL, // -85
+                0x41E384470D55B2EDLL, 0x5E4999F1B69E783FLL, // -84
+                0x696C06D81555EB15LL, 0x7D428FE92430C065LL, // -83
+                0x54566BE0111188DELL, 0x31020CBA835A3384LL, // -82
+                0x4378564CDA746D7ELL, 0x5A680A2ECF7B5C69LL, // -81
+                0x6BF3BD47C3ED7BFDLL, 0x770CDD17B25EFA42LL, // -80
+                0x565C976C9CBDFCCBLL, 0x1270B0DFC1E59502LL, // -79
+                0x4516DF8A16FE63D5LL, 0x5B8D5A4C9B1E10CELL, // -78
+                0x6E8AFF4357FD6C89LL, 0x127BC3ADC4FCE7B0LL, // -77
+                0x586F329C466456D4LL, 0x0EC96957D0CA52F3LL, // -76
+                0x46BF5BB038504576LL, 0x3F07877973D50F29LL, // -75
+                0x71322C4D26E6D58ALL, 0x31A5A58F1FBB4B75LL, // -74
+                0x5A8E89D75252446ELL, 0x5AEAEAD8E62F6F91LL, // -73
+                0x487207DF750E9D25LL, 0x2F22557A51BF8C74LL, // -72
+                0x73E9A63254E42EA2LL, 0x1836EF2A1C65AD86LL, // -71
+                0x5CBAEB5B771CF21BLL, 0x2CF8BF54E3848AD2LL, // -70
+                0x4A2F22AF927D8E7CLL, 0x23FA32AA4F9D3BDBLL, // -69
+                0x76B1D118EA627D93LL, 0x5329EAAA18FB92F8LL, // -68
+                0x5EF4A74721E86476LL, 0x0F54BBBB472FA8C6LL, // -67
+                0x4BF6EC38E7ED1D2BLL, 0x25DD62FC38F2ED6CLL, // -66
+                0x798B138E3FE1C845LL, 0x22FBD1938E517BDFLL, // -65
+                0x613C0FA4FFE7D36ALL, 0x4F2FDADC71DAC97FLL, // -64
+                0x4DC9A61D998642BBLL, 0x58F3157D27E23ACCLL, // -63
+                0x7C75D695C2706AC5LL, 0x74B82261D969F7ADLL, // -62
+                0x63917877CEC0556BLL, 0x10934EB4ADEE5FBELL, // -61
+                0x4FA793930BCD1122LL, 0x4075D8908B251965LL, // -60
+                0x7F7285B812E1B504LL, 0x00BC8DB411D4F56ELL, // -59
+                0x65F537C675815D9CLL, 0x66FD3E29A7DD9125LL, // -58
+                0x5190F96B91344AE3LL, 0x6BFDCB54864ADA84LL, // -57
+                0x4140C78940F6A24FLL, 0x6FFE3C439EA2486ALL, // -56
+                0x6867A5A867F103B2LL, 0x7FFD2D38FDD073DCLL, // -55
+                0x53861E2053273628LL, 0x6664242D97D9F64ALL, // -54
+                0x42D1B1B375B8F820LL, 0x51E9B68ADFE191D5LL, // -53
+                0x6AE91C5255F4C034LL, 0x1CA924116635B621LL, // -52
+                0x558749DB77F70029LL, 0x63BA83411E915E81LL, // -51
+                0x446C3B15F9926687LL, 0x6962029A7EDAB201LL, // -50
+                0x6D79F82328EA3DA6LL, 0x0F03375D97C45001LL, // -49
+                0x5794C6828721CAEBLL, 0x259C2C4ADFD04001LL, // -48
+                0x46109ECED2816F22LL, 0x5149BD08B30D0001LL, // -47
+                0x701A97B150CF1837LL, 0x3542C80DEB480001LL, // -46
+                0x59AEDFC10D7279C5LL, 0x7768A00B22A00001LL, // -45
+                0x47BF19673DF52E37LL, 0x79208008E8800001LL, // -44
+                0x72CB5BD86321E38CLL, 0x5B67334174000001LL, // -43
+                0x5BD5E313828182D6LL, 0x7C528F6790000001LL, // -42
+                0x4977E8DC68679BDFLL, 0x16A872B940000001LL, // -41
+                0x758CA7C70D7292FELL, 0x5773EAC200000001LL, // -40
+                0x5E0A1FD271287598LL, 0x45F6556800000001LL, // -39
+                0x4B3B4CA85A86C47ALL, 0x04C5112000000001LL, // -38
+                0x785EE10D5DA46D90LL, 0x07A1B50000000001LL, // -37
+                0x604BE73DE4838AD9LL, 0x52E7C40000000001LL, // -36
+                0x4D0985CB1D3608AELL, 0x0F1FD00000000001LL, // -35
+                0x7B426FAB61F00DE3LL, 0x31CC800000000001LL, // -34
+                0x629B8C891B267182LL, 0x5B0A000000000001LL, // -33
+                0x4EE2D6D415B85ACELL, 0x7C08000000000001LL, // -32
+                0x7E37BE2022C0914BLL, 0x1340000000000001LL, // -31
+                0x64F964E68233A76FLL, 0x2900000000000001LL, // -30
+                0x50C783EB9B5C85F2LL, 0x5400000000000001LL, // -29
+                0x409F9CBC7C4A04C2LL, 0x1000000000000001LL, // -28
+                0x6765C793FA10079DLL, 0x0000000000000001LL, // -27
+                0x52B7D2DCC80CD2E4LL, 0x0000000000000001LL, // -26
+                0x422CA8B0A00A4250LL, 0x0000000000000001LL, // -25
+                0x69E10DE76676D080LL, 0x0000000000000001LL, // -24
+                0x54B40B1F852BDA00LL, 0x0000000000000001LL, // -23
+                0x43C33C1937564800LL, 0x0000000000000001LL, // -22
+                0x6C6B935B8BBD4000LL, 0x0000000000000001LL, // -21
+                0x56BC75E2D6310000LL, 0x0000000000000001LL, // -20
+                0x4563918244F40000LL, 0x0000000000000001LL, // -19
+                0x6F05B59D3B200000LL, 0x0000000000000001LL, // -18
+                0x58D15E1762800000LL, 0x0000000000000001LL, // -17
+                0x470DE4DF82000000LL, 0x0000000000000001LL, // -16
+                0x71AFD498D0000000LL, 0x0000000000000001LL, // -15
+                0x5AF3107A40000000LL, 0x0000000000000001LL, // -14
+                0x48C2739500000000LL, 0x0000000000000001LL, // -13
+                0x746A528800000000LL, 0x0000000000000001LL, // -12
+                0x5D21DBA000000000LL, 0x0000000000000001LL, // -11
+                0x4A817C8000000000LL, 0x0000000000000001LL, // -10
+                0x7735940000000000LL, 0x0000000000000001LL, // -9
+                0x5F5E100000000000LL, 0x0000000000000001LL, // -8
+                0x4C4B400000000000LL, 0x0000000000000001LL, // -7
+                0x7A12000000000000LL, 0x0000000000000001LL, // -6
+                0x61A8000000000000LL, 0x0000000000000001LL, // -5
+                0x4E20000000000000LL, 0x0000000000000001LL, // -4
+                0x7D00000000000000LL, 0x0000000000000001LL, // -3
+                0x6400000000000000LL, 0x0000000000000001LL, // -2
+                0x5000000000000000LL, 0x0000000000000001LL, // -1
+                0x4000000000000000LL, 0x0000000000000001LL, // 0
+                0x6666666666666666LL, 0x3333333333333334LL, // 1
+                0x51EB851EB851EB85LL, 0x0F5C28F5C28F5C29LL, // 2
+                0x4189374BC6A7EF9DLL, 0x5916872B020C49BBLL, // 3
+                0x68DB8BAC710CB295LL, 0x74F0D844D013A92BLL, // 4
+                0x53E2D6238DA3C211LL, 0x43F3E0370CDC8755LL, // 5
+                0x431BDE82D7B634DALL, 0x698FE69270B06C44LL, // 6
+                0x6B5FCA6AF2BD215ELL, 0x0F4CA41D811A46D4LL, // 7
+                0x55E63B88C230E77ELL, 0x3F70834ACDAE9F10LL, // 8
+                0x44B82FA09B5A52CBLL, 0x4C5A02A23E254C0DLL, // 9
+                0x6DF37F675EF6EADFLL, 0x2D5CD10396A21347LL, // 10
+                0x57F5FF85E592557FLL, 0x3DE3DA69454E75D3LL, // 11
+                0x465E6604B7A84465LL, 0x7E4FE1EDD10B9175LL, // 12
+                0x709709A125DA0709LL, 0x4A19697C81AC1BEFLL, // 13
+                0x5A126E1A84AE6C07LL, 0x54E1213067BCE326LL, // 14
+                0x480EBE7B9D58566CLL, 0x43E74DC052FD8285LL, // 15
+                0x734ACA5F6226F0ADLL, 0x530BAF9A1E626A6DLL, // 16
+                0x5C3BD5191B525A24LL, 0x426FBFAE7EB521F1LL, // 17
+                0x49C97747490EAE83LL, 0x4EBFCC8B9890E7F4LL, // 18
+                0x760F253EDB4AB0D2LL, 0x4ACC7A78F41B0CBALL, // 19
+                0x5E72843249088D75LL, 0x223D2EC729AF3D62LL, // 20
+                0x4B8ED0283A6D3DF7LL, 0x34FDBF05BAF29781LL, // 21
+                0x78E480405D7B9658LL, 0x54C931A2C4B758CFLL, // 22
+                0x60B6CD004AC94513LL, 0x5D6DC14F03C5E0A5LL, // 23
+                0x4D5F0A66A23A9DA9LL, 0x31249AA59C9E4D51LL, // 24
+                0x7BCB43D769F762A8LL, 0x4EA0F76F60FD4882LL, // 25
+                0x63090312BB2C4EEDLL, 0x254D92BF80CAA068LL, // 26
+                0x4F3A68DBC8F03F24LL, 0x1DD7A89933D54D20LL, // 27
+                0x7EC3DAF941806506LL, 0x62F2A75B86221500LL, // 28
+                0x65697BFA9ACD1D9FLL, 0x025BB91604E810CDLL, // 29
+                0x51212FFBAF0A7E18LL, 0x684960DE6A5340A4LL, // 30
+                0x40E7599625A1FE7ALL, 0x203AB3E521DC33B6LL, // 31
+                0x67D88F56A29CCA5DLL, 0x19F7863B696052BDLL, // 32
+                0x5313A5DEE87D6EB0LL, 0x7B2C6B62BAB37564LL, // 33
+                0x42761E4BED31255ALL, 0x2F56BC4EFBC2C450LL, // 34
+                0x6A5696DFE1E83BC3LL, 0x655793B192D13A1ALL, // 35
+                0x5512124CB4B9C969LL, 0x377942F475742E7BLL, // 36
+                0x440E750A2A2E3ABALL, 0x5F9435905DF68B96LL, // 37
+                0x6CE3EE76A9E3912ALL, 0x65B9EF4D63241289LL, // 38
+                0x571CBEC554B60DBBLL, 0x6AFB25D782834207LL, // 39
+                0x45B0989DDD5E7163LL, 0x08C8EB12CECF6806LL, // 40
+                0x6F80F42FC8971BD1LL, 0x5ADB11B7B14BD9A3LL, // 41
+                0x5933F68CA078E30ELL, 0x157C0E2C8DD647B5LL, // 42
+                0x475CC53D4D2D8271LL, 0x5DFCD823A4AB6C91LL, // 43
+                0x722E086215159D82LL, 0x632E269F6DDF141BLL, // 44
+                0x5B5806B4DDAAE468LL, 0x4F581EE5F17F4349LL, // 45
+                0x49133890B1558386LL, 0x72ACE584C1329C3BLL, // 46
+                0x74EB8DB44EEF38D7LL, 0x6AAE3C079B842D2ALL, // 47
+                0x5D893E29D8BF60ACLL, 0x5558300616035755LL, // 48
+                0x4AD431BB13CC4D56LL, 0x7779C004DE6912ABLL, // 49
+                0x77B9E92B52E07BBELL, 0x258F99A163DB5111LL, // 50
+                0x5FC7EDBC424D2FCBLL, 0x37A614811CAF740DLL, // 51
+                0x4C9FF163683DBFD5LL, 0x7951AA00E3BF900BLL, // 52
+                0x7A998238A6C932EFLL, 0x754F7667D2CC19ABLL, // 53
+                0x6214682D523A8F26LL, 0x2AA5F8530F09AE22LL, // 54
+                0x4E76B9BDDB620C1ELL, 0x55519375A5A1581BLL, // 55
+                0x7D8AC2C95F034697LL, 0x3BB5B8BC3C3559C5LL, // 56
+                0x646F023AB2690545LL, 0x7C9160969691149ELL, // 57
+                0x5058CE955B87376BLL, 0x16DAB3ABABA743B2LL, // 58
+                0x40470BAAAF9F5F88LL, 0x78AEF622EFB902F5LL, // 59
+                0x66D812AAB29898DBLL, 0x0DE4BD04B2C19E54LL, // 60
+                0x524675555BAD4715LL, 0x57EA30D08F014B76LL, // 61
+                0x41D1F7777C8A9F44LL, 0x4654F3DA0C01092CLL, // 62
+                0x694FF258C7443207LL, 0x23BB1FC346680EACLL, // 63
+                0x543FF513D29CF4D2LL, 0x4FC8E635D1ECD88ALL, // 64
+                0x43665DA9754A5D75LL, 0x263A51C4A7F0AD3BLL, // 65
+                0x6BD6FC425543C8BBLL, 0x56C3B607731AAEC4LL, // 66
+                0x5645969B77696D62LL, 0x789C919F8F488BD0LL, // 67
+                0x4504787C5F878AB5LL, 0x46E3A7B2D906D640LL, // 68
+                0x6E6D8D93CC0C1122LL, 0x3E390C515B3E239ALL, // 69
+                0x5857A4763CD6741BLL, 0x4B60D6A77C31B615LL, // 70
+                0x46AC8391CA4529AFLL, 0x55E7121F968E2B44LL, // 71
+                0x711405B6106EA919LL, 0x0971B698F0E3786DLL, // 72
+                0x5A766AF80D255414LL, 0x078E2BAD8D82C6BDLL, // 73
+                0x485EBBF9A41DDCDCLL, 0x6C71BC8AD79BD231LL, // 74
+                0x73CAC65C39C96161LL, 0x2D82C7448C2C8382LL, // 75
+                0x5CA23849C7D44DE7LL, 0x3E023903A356CF9BLL, // 76
+                0x4A1B603B06437185LL, 0x7E682D9C82ABD949LL, // 77
+                0x76923391A39F1C09LL, 0x4A4048FA6AAC8EDBLL, // 78
+                0x5EDB5C7482E5B007LL, 0x55003A61EEF07249LL, // 79
+                0x4BE2B05D35848CD2LL, 0x773361E7F259F507LL, // 80
+                0x796AB3C855A0E151LL, 0x3EB89CA6508FEE71LL, // 81
+                0x6122296D114D810DLL, 0x7EFA16EB73A6585BLL, // 82
+                0x4DB4EDF0DAA4673ELL, 0x3261ABEF8FB846AFLL, // 83
+                0x7C54AFE7C43A3ECALL, 0x1D691318E5F3A44BLL, // 84
+                0x6376F31FD02E98A1LL, 0x64540F471E5C836FLL, // 85
+                0x4F925C1973587A1BLL, 0x0376729F4B7D35F3LL, // 86
+                0x7F50935BEBC0C35ELL, 0x38BD84321261EFEBLL, // 87
+                0x65DA0F7CBC9A35E5LL, 0x13CAD0280EB4BFEFLL, // 88
+                0x517B3F96FD482B1DLL, 0x5CA240200BC3CCBFLL, // 89
+                0x412F66126439BC17LL, 0x63B50019A3030A33LL, // 90
+                0x684BD683D38F9359LL, 0x1F88002904D1A9EALL, // 91
+                0x536FDECFDC72DC47LL, 0x32D3335403DAEE55LL, // 92
+                0x42BFE57316C249D2LL, 0x5BDC291003158B77LL, // 93
+                0x6ACCA251BE03A951LL, 0x12F9DB4CD1BC1258LL, // 94
+                0x557081DAFE695440LL, 0x7594AF70A7C9A847LL, // 95
+                0x445A017BFEBAA9CDLL, 0x4476F2C0863AED06LL, // 96
+                0x6D5CCF2CCAC442E2LL, 0x3A57EACDA3917B3CLL, // 97
+                0x577D728A3BD03581LL, 0x7B7988A482DAC8FDLL, // 98
+                0x45FDF53B630CF79BLL, 0x15FAD3B6CF156D97LL, // 99
+                0x6FFCBB923814BF5ELL, 0x565E1F8AE4EF15BELL, // 100
+                0x5996FC74F9AA32B2LL, 0x11E4E608B725AAFFLL, // 101
+                0x47ABFD2A6154F55BLL, 0x27EA51A0928488CCLL, // 102
+                0x72ACC843CEEE555ELL, 0x7310829A84074146LL, // 103
+                0x5BBD6D030BF1DDE5LL, 0x42739BAED005CDD2LL, // 104
+                0x49645735A327E4B7LL, 0x4EC2E2F24004A4A8LL, // 105
+                0x756D5855D1D96DF2LL, 0x4AD16B1D333AA10CLL, // 106
+                0x5DF11377DB1457F5LL, 0x2241227DC2954DA3LL, // 107
+                0x4B2742C648DD132ALL, 0x4E9A81FE35443E1CLL, // 108
+                0x783ED13D4161B844LL, 0x175D9CC9EED39694LL, // 109
+                0x603240FDCDE7C69CLL, 0x7917B0A18BDC7876LL, // 110
+                0x4CF500CB0B1FD217LL, 0x1412F3B46FE39392LL, // 111
+                0x7B219ADE7832E9BELL, 0x535185ED7FD285B6LL, // 112
+                0x628148B1F9C25498LL, 0x42A79E57997537C5LL, // 113
+                0x4ECDD3C1949B76E0LL, 0x3552E512E12A9304LL, // 114
+                0x7E161F9C20F8BE33LL, 0x6EEB081E3510EB39LL, // 115
+                0x64DE7FB01A609829LL, 0x3F226CE4F740BC2ELL, // 116
+                0x50B1FFC0151A1354LL, 0x3281F0B72C33C9BELL, // 117
+                0x408E66334414DC43LL, 0x42018D5F568FD498LL, // 118
+                0x674A3D1ED354939FLL, 0x1CCF48988A7FBA8DLL, // 119
+                0x52A1CA7F0F76DC7FLL, 0x30A5D3AD3B99620BLL, // 120
+                0x421B0865A5F8B065LL, 0x73B7DC8A96144E6FLL, // 121
+                0x69C4DA3C3CC11A3CLL, 0x52BFC7442353B0B1LL, // 122
+                0x549D7B6363CDAE96LL, 0x756639034F7626F4LL, // 123
+                0x43B12F82B63E2545LL, 0x4451C735D92B525DLL, // 124
+                0x6C4EB26ABD303BA2LL, 0x3A1C71EFC1DEEA2ELL, // 125
+                0x56A55B889759C94ELL, 0x61B05B2634B254F2LL, // 126
+                0x45511606DF7B0772LL, 0x1AF37C1E908EAA5BLL, // 127
+                0x6EE8233E325E7250LL, 0x2B1F2CFDB41776F8LL, // 128
+                0x58B9B5CB5B7EC1D9LL, 0x6F4C23FE29AC5F2DLL, // 129
+                0x46FAF7D5E2CBCE47LL, 0x72A34FFE87BD18F1LL, // 130
+                0x71918C896ADFB073LL, 0x04387FFDA5FB5B1BLL, // 131
+                0x5ADAD6D4557FC05CLL, 0x0360666484C915AFLL, // 132
+                0x48AF1243779966B0LL, 0x02B3851D3707448CLL, // 133
+                0x744B506BF28F0AB3LL, 0x1DEC082EBE720746LL, // 134
+                0x5D090D2328726EF5LL, 0x64BCD358985B3905LL, // 135
+                0x4A6DA41C205B8BF7LL, 0x6A30A913AD15C738LL, // 136
+                0x7715D36033C5ACBFLL, 0x5D1AA81F7B560B8CLL, // 137
+                0x5F44A919C3048A32LL, 0x7DAEECE5FC44D609LL, // 138
+                0x4C36EDAE359D3B5BLL, 0x7E258A51969D7808LL, // 139
+                0x79F17C49EF61F893LL, 0x16A276E8F0FBF33FLL, // 140
+                0x618DFD07F2B4C6DCLL, 0x121B9253F3FCC299LL, // 141
+                0x4E0B30D328909F16LL, 0x41AFA84329970214LL, // 142
+                0x7CDEB4850DB431BDLL, 0x4F7F739EA8F19CEDLL, // 143
+                0x63E55D373E29C164LL, 0x3F99294BBA5AE3F1LL, // 144
+                0x4FEAB0F8FE87CDE9LL, 0x7FADBAA2FB7BE98DLL, // 145
+                0x7FDDE7F4CA72E30FLL, 0x7F7C5DD1925FDC15LL, // 146
+                0x664B1FF7085BE8D9LL, 0x4C637E4141E649ABLL, // 147
+                0x51D5B32C06AFED7ALL, 0x704F983434B83AEFLL, // 148
+                0x4177C2899EF32462LL, 0x26A6135CF6F9C8BFLL, // 149
+                0x68BF9DA8FE51D3D0LL, 0x3DD685618B294132LL, // 150
+                0x53CC7E20CB74A973LL, 0x4B12044E08EDCDC2LL, // 151
+                0x4309FE80A2C3BAC2LL, 0x6F419D0B3A57D7CELL, // 152
+                0x6B4330CDD1392AD1LL, 0x320294DEC3BFBFB0LL, // 153
+                0x55CF5A3E40FA88A7LL, 0x419BAA4BCFCC995ALL, // 154
+                0x44A5E1CB672ED3B9LL, 0x1AE2EEA30CA3ADE1LL, // 155
+                0x6DD636123EB152C1LL, 0x77D17DD1ADD2AFCFLL, // 156
+                0x57DE91A832277567LL, 0x797464A7BE42263FLL, // 157
+                0x464BA7B9C1B92AB9LL, 0x4790508631CE84FFLL, // 158
+                0x70790C5C6928445CLL, 0x0C1A1A704FB0D4CCLL, // 159
+                0x59FA7049EDB9D049LL, 0x567B4859D95A43D6LL, // 160
+                0x47FB8D07F161736ELL, 0x11FC39E17AAE9CABLL, // 161
+                0x732C14D98235857DLL, 0x032D2968C44A9445LL, // 162
+                0x5C2343E134F79DFDLL, 0x4F575453D03BA9D1LL, // 163
+                0x49B5CFE75D92E4CALL, 0x72AC4376402FBB0ELL, // 164
+                0x75EFB30BC8EB07ABLL, 0x0446D256CD192B49LL, // 165
+                0x5E595C096D88D2EFLL, 0x1D0575123DADBC3ALL, // 166
+                0x4B7AB0078AD3DBF2LL, 0x4A6AC40E97BE302FLL, // 167
+                0x78C44CD8DE1FC650LL, 0x771139B0F2C9E6B1LL, // 168
+                0x609D0A4718196B73LL, 0x78DA948D8F07EBC1LL, // 169
+                0x4D4A6E9F467ABC5CLL, 0x60AEDD3E0C065634LL, // 170
+                0x7BAA4A9870C46094LL, 0x344AFB9679A3BD20LL, // 171
+                0x62EEA2138D69E6DDLL, 0x103BFC78614FCA80LL, // 172
+                0x4F254E760ABB1F17LL, 0x26966393810CA200LL, // 173
+                0x7EA21723445E9825LL, 0x2423D2859B476999LL, // 174
+                0x654E78E9037EE01DLL, 0x69B642047C392148LL, // 175
+                0x510B93ED9C658017LL, 0x6E2B680396941AA0LL, // 176
+                0x40D60FF149EACCDFLL, 0x71BC53361210154DLL, // 177
+                0x67BCE64EDCAAE166LL, 0x1C6085235019BBAELL, // 178
+                0x52FD850BE3BBE784LL, 0x7D1A041C40149625LL, // 179
+                0x42646A6FE9631F9DLL, 0x4A7B367D0010781DLL, // 180
+                0x6A3A43E642383295LL, 0x5D91F0C8001A59C8LL, // 181
+                0x54FB698501C68EDELL, 0x17A7F3D3334847D4LL, // 182
+                0x43FC546A67D20BE4LL, 0x79532975C2A03976LL, // 183
+                0x6CC6ED770C83463BLL, 0x0EEB75893766C256LL, // 184
+                0x57058AC5A39C382FLL, 0x25892AD42C523512LL, // 185
+                0x459E089E1C7CF9BFLL, 0x37A0EF102374F742LL, // 186
+                0x6F6340FCFA618F98LL, 0x59017E8038BB2536LL, // 187
+                0x591C33FD951AD946LL, 0x7A67986693C8EA91LL, // 188
+                0x4749C33144157A9FLL, 0x151FAD1EDCA0BBA8LL, // 189
+                0x720F9EB539BBF765LL, 0x0832AE97C76792A5LL, // 190
+                0x5B3FB22A94965F84LL, 0x068EF21305EC7551LL, // 191
+                0x48FFC1BBAA11E603LL, 0x1ED8C1A8D189F774LL, // 192
+                0x74CC692C434FD66BLL, 0x4AF4690E1C0FF253LL, // 193
+                0x5D705423690CAB89LL, 0x225D20D816732843LL, // 194
+                0x4AC0434F873D5607LL, 0x35174D79AB8F5369LL, // 195
+                0x779A054C0B955672LL, 0x21BEE25C45B21F0ELL, // 196
+                0x5FAE6AA33C77785BLL, 0x3498B5169E2818D8LL, // 197
+                0x4C8B888296C5F9E2LL, 0x5D46F7454B534713LL, // 198
+                0x7A78DA6A8AD65C9DLL, 0x7BA4BED545520B52LL, // 199
+                0x61FA48553BDEB07ELL, 0x2FB6FF110441A2A8LL, // 200
+                0x4E61D37763188D31LL, 0x72F8CC0D9D014EEDLL, // 201
+                0x7D6952589E8DAEB6LL, 0x1E5AE015C80217E1LL, // 202
+                0x645441E07ED7BEF8LL, 0x1848B344A001ACB4LL, // 203
+                0x504367E6CBDFCBF9LL, 0x603A2903B3348A2ALL, // 204
+                0x4035ECB8A3196FFBLL, 0x002E873628F6D4EELL, // 205
+                0x66BCADF43828B32BLL, 0x19E40B89DB2487E3LL, // 206
+                0x52308B29C686F5BCLL, 0x14B66FA17C1D3983LL, // 207
+                0x41C06F549ED25E30LL, 0x1091F2E7967DC79CLL, // 208
+                0x6933E554315096B3LL, 0x341CB7D8F0C93F5FLL, // 209
+                0x542984435AA6DEF5LL, 0x767D5FE0C0A0FF80LL, // 210
+                0x435469CF7BB8B25ELL, 0x2B977FE70080CC66LL, // 211
+                0x6BBA42E592C11D63LL, 0x5F58CCA4CD9AE0A3LL, // 212
+                0x562E9BEADBCDB11CLL, 0x4C470A1D7148B3B6LL, // 213
+                0x44F216557CA48DB0LL, 0x3D05A1B1276D5C92LL, // 214
+                0x6E5023BBFAA0E2B3LL, 0x7B3C35E83F1560E9LL, // 215
+                0x58401C96621A4EF6LL, 0x2F635E5365AAB3EDLL, // 216
+                0x4699B0784E7B725ELL, 0x591C4B75EAEEF658LL, // 217
+                0x70F5E726E3F8B6FDLL, 0x74FA125644B18A26LL, // 218
+                0x5A5E5285832D5F31LL, 0x43FB41DE9D5AD4EBLL, // 219
+                0x484B75379C244C27LL, 0x4FFC34B2177BDD89LL, // 220
+                0x73ABEEBF603A1372LL, 0x4CC6BAB68BF96274LL, // 221
+                0x5C898BCC4CFB42C2LL, 0x0A38955ED6611B90LL, // 222
+                0x4A07A309D72F689BLL, 0x21C6DDE5784DAFA7LL, // 223
+                0x76729E762518A75ELL, 0x693E2FD58D49190BLL, // 224
+                0x5EC2185E8413B918LL, 0x5431BFDE0AA0E0D5LL, // 225
+                0x4BCE79E536762DADLL, 0x29C1664B3BB3E711LL, // 226
+                0x794A5CA1F0BD15E2LL, 0x0F9BD6DEC5ECA4E8LL, // 227
+                0x61084A1B26FDAB1BLL, 0x2616457F04BD50BALL, // 228
+                0x4DA03B48EBFE227CLL, 0x1E783798D09773C8LL, // 229
+                0x7C33920E46636A60LL, 0x30C058F480F252D9LL, // 230
+                0x635C74D8384F884DLL, 0x0D66AD9067284247LL, // 231
+                0x4F7D2A469372D370LL, 0x711EF14052869B6CLL, // 232
+                0x7F2EAA0A85848581LL, 0x34FE4ECD50D75F14LL, // 233
+                0x65BEEE6ED136D134LL, 0x2A650BD773DF7F43LL, // 234
+                0x51658B8BDA9240F6LL, 0x551DA312C319329CLL, // 235
+                0x411E093CAEDB672BLL, 0x5DB14F4235ADC217LL, // 236
+                0x68300EC77E2BD845LL, 0x7C4EE536BC49368ALL, // 237
+                0x5359A56C64EFE037LL, 0x7D0BEA92303A9208LL, // 238
+                0x42AE1DF050BFE693LL, 0x173CBBA8269541A0LL, // 239
+                0x6AB02FE6E79970EBLL, 0x3EC792A6A422029ALL, // 240
+                0x5559BFEBEC7AC0BCLL, 0x3239421EE9B4CEE1LL, // 241
+                0x4447CCBCBD2F0096LL, 0x5B6101B25490A581LL, // 242
+                0x6D3FADFAC84B3424LL, 0x2BCE691D541AA268LL, // 243
+                0x576624C8A03C29B6LL, 0x563EBA7DDCE21B87LL, // 244
+                0x45EB50A08030215ELL, 0x78322ECB171B4939LL, // 245
+                0x6FDEE76733803564LL, 0x59E9E47824F87527LL, // 246
+                0x597F1F85C2CCF783LL, 0x6187E9F9B72D2A86LL, // 247
+                0x4798E6049BD72C69LL, 0x346CBB2E2C242205LL, // 248
+                0x728E3CD42C8B7A42LL, 0x20ADF849E039D007LL, // 249
+                0x5BA4FD768A092E9BLL, 0x33BE603B19C7D99FLL, // 250
+                0x4950CAC53B3A8BAFLL, 0x42FEB3627B0647B3LL, // 251
+                0x754E113B91F745E5LL, 0x5197856A5E7072B8LL, // 252
+                0x5DD80DC941929E51LL, 0x27AC6ABB7EC05BC6LL, // 253
+                0x4B133E3A9ADBB1DALL, 0x52F05562CBCD1638LL, // 254
+                0x781EC9F75E2C4FC4LL, 0x1E4D556ADFAE89F3LL, // 255
+                0x6018A192B1BD0C9CLL, 0x7EA444557FBED4C3LL, // 256
+                0x4CE0814227CA707DLL, 0x4BB69D1132FF109CLL, // 257
+                0x7B00CED03FAA4D95LL, 0x5F8A94E851981A93LL, // 258
+                0x62670BD9CC883E11LL, 0x32D543ED0E134875LL, // 259
+                0x4EB8D647D6D364DALL, 0x5BDDCFF0D80F6D2BLL, // 260
+                0x7DF48A0C8AEBD491LL, 0x12FC7FE7C018AEABLL, // 261
+                0x64C3A1A3A25643A7LL, 0x28C9FFEC99AD5889LL, // 262
+                0x509C814FB511CFB9LL, 0x0707FFF07AF113A1LL, // 263
+                0x407D343FC40E3FC7LL, 0x1F39998D2F2742E7LL, // 264
+                0x672EB9FFA016CC71LL, 0x7EC28F484B7204A4LL, // 265
+                0x528BC7FFB345705BLL, 0x189BA5D36F8E6A1DLL, // 266
+                0x42096CCC8F6AC048LL, 0x7A161E42BFA521B1LL, // 267
+                0x69A8AE1418AACD41LL, 0x435696D132A1CF81LL, // 268
+                0x5486F1A9AD557101LL, 0x1C454574288172CELL, // 269
+                0x439F27BAF1112734LL, 0x169DD129BA0128A5LL, // 270
+                0x6C31D92B1B4EA520LL, 0x242FB50F9001DAA1LL, // 271
+                0x568E4755AF721DB3LL, 0x368C90D940017BB4LL, // 272
+                0x453E9F77BF8E7E29LL, 0x120A0D7A999AC95DLL, // 273
+                0x6ECA98BF98E3FD0ELL, 0x50101590F5C47561LL, // 274
+                0x58A213CC7A4FFDA5LL, 0x26734473F7D05DE8LL, // 275
+                0x46E80FD6C83FFE1DLL, 0x6B8F69F65FD9E4B9LL, // 276
+                0x71734C8AD9FFFCFCLL, 0x45B24323CC8FD45CLL, // 277
+                0x5AC2A3A247FFFD96LL, 0x6AF502830A0CA9E3LL, // 278
+                0x489BB61B6CCCCADFLL, 0x08C402026E7087E9LL, // 279
+                0x742C569247AE1164LL, 0x746CD003E3E73FDBLL, // 280
+                0x5CF04541D2F1A783LL, 0x76BD73364FEC3315LL, // 281
+                0x4A59D101758E1F9CLL, 0x5EFDF5C50CBCF5ABLL, // 282
+                0x76F61B3588E365C7LL, 0x4B2FEFA1ADFB22ABLL, // 283
+                0x5F2B48F7A0B5EB06LL, 0x08F3261AF195B555LL, // 284
+                0x4C22A0C61A2B226BLL, 0x20C284E25ADE2AABLL, // 285
+                0x79D1013CF6AB6A45LL, 0x1AD0D49D5E304444LL, // 286
+                0x617400FD9222BB6ALL, 0x48A7107DE4F369D0LL, // 287
+                0x4DF6673141B562BBLL, 0x53B8D9FE50C2BB0DLL, // 288
+                0x7CBD71E869223792LL, 0x52C15CCA1AD12B48LL, // 289
+                0x63CAC186BA81C60ELL, 0x75677D6E7BDA8906LL, // 290
+                0x4FD5679EFB9B04D8LL, 0x5DEC645863153A6CLL, // 291
+                0x7FBBD8FE5F5E6E27LL, 0x497A3A2704EEC3DFLL, // 292
+            };
+
+            /**
+             * Return floor(e log10(2)), for e in [-5456721, 5456721].
+             */
+            CORE_FAST gint flog10pow2(gint e) {
+                return (gint) ((e * 661971961083LL) >> 41);
+            }
+
+            /**
+             * Return floor(log10(3/4 2^e)), for e in [-3000, 3000].
+             */
+            CORE_FAST gint flog10threeQuartersPow2(gint e) {
+                return (gint) ((e * 661971961083LL - 274743187321LL) >> 41);
+            }
+
+            /**
+             * Return floor(e log2(10)), for e in [-1838394, 1838394].
+             */
+            CORE_FAST gint flog2pow10(gint e) {
+                return (gint) ((e * 913124641741LL) >> 38);
+            }
+
+            /**
+             * Return the most significant 64 bits of the signed 128-bit product
+             * of the given values.
+             */
+            inline glong multiplyHigh(glong x, glong y) {
+#if defined(__SIZEOF_INT128__)
+                return (glong) (((__int128) x * y) >> 64);
+#else
+                return Math::multiplyHigh(x, y);
+#endif
+            }
+
+            /**
+             * Return x >>> n (the unsigned right shift).
+             */
+            CORE_FAST glong shiftRight(glong x, gint n) {
+                return (glong) ((GENERIC_UINT64) x >> n);
+            }
+
+            /**
+             * Return x << n, with the wrapping of unsigned arithmetic (the signed
+             * overflow is undefined).
+             */
+            CORE_FAST glong shiftLeft(glong x, gint n) {
+                return (glong) ((GENERIC_UINT64) x << n);
+            }
+
+            /**
+             * Return the rounding to odd of (g1 2^63 + g0) cp / 2^127 (for doubles).
+             * The sums wrap around, they are computed with unsigned arithmetic.
+             */
+            inline glong roundToOdd(glong g1, glong g0, glong cp) {
+                GENERIC_UINT64 const x1 = (GENERIC_UINT64) multiplyHigh(g0, cp);
+                GENERIC_UINT64 const y0 = (GENERIC_UINT64) g1 * (GENERIC_UINT64) cp;
+                GENERIC_UINT64 const y1 = (GENERIC_UINT64) multiplyHigh(g1, cp);
+                GENERIC_UINT64 const z = (y0 >> 1) + x1;
+                GENERIC_UINT64 const vbp = y1 + (z >> 63);
+                return (glong) (vbp | (((z & (GENERIC_UINT64) MASK_63) + (GENERIC_UINT64) MASK_63) >> 63));
+            }
+
+            /**
+             * Return the rounding to odd of g cp / 2^95 (for floats).
+             */
+            inline gint roundToOdd(glong g, glong cp) {
+                GENERIC_UINT64 const x1 = (GENERIC_UINT64) multiplyHigh(g, cp);
+                GENERIC_UINT64 const vbp = x1 >> 31;
+                return (gint) (vbp | (((x1 & (GENERIC_UINT64) MASK_32) + (GENERIC_UINT64) MASK_32) >> 32));
+            }
+
+            /**
+             * Write the decimal f 10^e (with f > 0) at the given position, with the format
+             * of Double.toString, and return the position after the last written char.
+             */
+            gint writeDecimal(gbyte *out, gint next, glong f, gint e) {
+                // the trailing zeros of significand are moved to the exponent
+                while (f % 10 == 0) {
+                    f /= 10;
+                    e += 1;
+                }
+                // the digits are written from the end (17 digits at most)
+                gbyte digits[20];
+                gint i = 20;
+                do {
+                    digits[--i] = (gbyte) ('0' + (gint) (f % 10));
+                    f /= 10;
+                } while (f > 0);
+                gint const n = 20 - i;
+                gint const exponent = n + e - 1;
+                if (0 <= exponent && exponent < 7) {
+                    // plain notation: ddd.ddd, ddd000.0
+                    if (e >= 0) {
+                        for (; i < 20; ++i)
+                            out[next++] = digits[i];
+                        for (; e > 0; --e)
+                            out[next++] = '0';
+                        out[next++] = '.';
+                        out[next++] = '0';
+                    } else {
+                        for (gint j = 0; j <= exponent; ++j)
+                            out[next++] = digits[i++];
+                        out[next++] = '.';
+                        for (; i < 20; ++i)
+                            out[next++] = digits[i];
+                    }
+                } else if (-3 <= exponent && exponent < 0) {
+                    // plain notation: 0.00ddd
+                    out[next++] = '0';
+                    out[next++] = '.';
+                    for (gint j = exponent + 1; j < 0; ++j)
+                        out[next++] = '0';
+                    for (; i < 20; ++i)
+                        out[next++] = digits[i];
+                } else {
+                    // computerized scientific notation: d.dddE-ddd
+                    out[next++] = digits[i++];
+                    out[next++] = '.';
+                    if (i == 20)
+                        out[next++] = '0';
+                    for (; i < 20; ++i)
+                        out[next++] = digits[i];
+                    out[next++] = 'E';
+                    gint a = exponent;
+                    if (a < 0) {
+                        out[next++] = '-';
+                        a = -a;
+                    }
+                    if (a >= 100) {
+                        out[next++] = (gbyte) ('0' + a / 100);
+                        a %= 100;
+                        out[next++] = (gbyte) ('0' + a / 10);
+                    } else if (a >= 10)
+                        out[next++] = (gbyte) ('0' + a / 10);
+                    out[next++] = (gbyte) ('0' + a % 10);
+                }
+                return next;
+            }
+
+            /**
+             * Write the shortest decimal of the double value c 2^q (with c > 0), and
+             * return the position after the last written char. The exponent of the
+             * selected decimal is increased by dk (dk = -1 when c has been multiplied by 10).
+             */
+            gint writeDouble(gbyte *out, gint next, gint q, glong c, gint dk) {
+                gint const odd = (gint) c & 1;
+                glong const cb = c << 2;
+                glong const cbr = cb + 2;
+                glong cbl;
+                gint k;
+                if (c != DOUBLE_C_MIN || q == DOUBLE_Q_MIN) {
+                    cbl = cb - 2;
+                    k = flog10pow2(q);
+                } else {
+                    // the predecessor of value is closer than its successor
+                    cbl = cb - 1;
+                    k = flog10threeQuartersPow2(q);
+                }
+                gint const h = q + flog2pow10(-k) + 2;
+                glong const g1 = G[(k - K_MIN) << 1];
+                glong const g0 = G[(k - K_MIN) << 1 | 1];
+                glong const vb = roundToOdd(g1, g0, shiftLeft(cb, h));
+                glong const vbl = roundToOdd(g1, g0, shiftLeft(cbl, h));
+                glong const vbr = roundToOdd(g1, g0, shiftLeft(cbr, h));
+                glong const s = vb >> 2;
+                if (s >= 100) {
+                    // the decimals of length one less than s are preferred (sp10 = floor(s / 10) 10)
+                    glong const sp10 = 10 * multiplyHigh(s, 115292150460684698LL << 4);
+                    glong const tp10 = sp10 + 10;
+                    gbool const upin = vbl + odd <= shiftLeft(sp10, 2);
+                    gbool const wpin = shiftLeft(tp10, 2) + odd <= vbr;
+                    if (upin != wpin)
+                        return writeDecimal(out, next, upin ? sp10 : tp10, k);
+                }
+                glong const t = s + 1;
+                gbool const uin = vbl + odd <= shiftLeft(s, 2);
+                gbool const win = shiftLeft(t, 2) + odd <= vbr;
+                if (uin != win)
+                    return writeDecimal(out, next, uin ? s : t, k + dk);
+                // both s and t round to value: the closest is selected (the even one on ties)
+                glong const cmp = vb - ((s + t) << 1);
+                return writeDecimal(out, next, cmp < 0 || (cmp == 0 && (s & 1) == 0) ? s : t, k + dk);
+            }
+
+            /**
+             * Write the shortest decimal of the float value c 2^q (with c > 0), and
+             * return the position after the last written char.
+             */
+            gint writeFloat(gbyte *out, gint next, gint q, gint c, gint dk) {
+                gint const odd = c & 1;
+                glong const cb = (glong) c << 2;
+                glong const cbr = cb + 2;
+                glong cbl;
+                gint k;
+                if (c != FLOAT_C_MIN || q == FLOAT_Q_MIN) {
+                    cbl = cb - 2;
+                    k = flog10pow2(q);
+                } else {
+                    cbl = cb - 1;
+                    k = flog10threeQuartersPow2(q);
+                }
+                gint const h = q + flog2pow10(-k) + 33;
+                glong const g = G[(k - K_MIN) << 1] + 1;
+                gint const vb = roundToOdd(g, shiftLeft(cb, h));
+                gint const vbl = roundToOdd(g, shiftLeft(cbl, h));
+                gint const vbr = roundToOdd(g, shiftLeft(cbr, h));
+                gint const s = vb >> 2;
+                if (s >= 100) {
+                    gint const sp10 = s / 10 * 10;
+                    gint const tp10 = sp10 + 10;
+                    gbool const upin = vbl + odd <= sp10 << 2;
+                    gbool const wpin = (tp10 << 2) + odd <= vbr;
+                    if (upin != wpin)
+                        return writeDecimal(out, next, upin ? sp10 : tp10, k);
+                }
+                gint const t = s + 1;
+                gbool const uin = vbl + odd <= s << 2;
+                gbool const win = (t << 2) + odd <= vbr;
+                if (uin != win)
+                    return writeDecimal(out, next, uin ? s : t, k + dk);
+                gint const cmp = vb - ((s + t) << 1);
+                return writeDecimal(out, next, cmp < 0 || (cmp == 0 && (s & 1) == 0) ? s : t, k + dk);
+            }
+
+            /**
+             * Write the given LATIN1 chars, and return their count.
+             */
+            gint writeChars(gbyte *out, const char *chars) {
+                gint i = 0;
+                for (; chars[i] != 0; ++i)
+                    out[i] = (gbyte) chars[i];
+                return i;
+            }
+        }
+
+        gint DoubleToDecimal::toChars(gdouble d, glong dst) {
+            gbyte *const out = (gbyte *) dst;
+            glong const bits = Double::toLongBits(d);
+            glong const t = bits & ((1LL << (DOUBLE_P - 1)) - 1);
+            gint const bq = (gint) shiftRight(bits, DOUBLE_P - 1) & 0x7FF;
+            if (bq == 0x7FF)
+                return writeChars(out, t != 0 ? "NaN" : bits > 0 ? "Infinity" : "-Infinity");
+            gint next = 0;
+            if (bits < 0)
+                out[next++] = '-';
+            if (bq != 0) {
+                // normal value: c 2^q with 2^52 <= c < 2^53
+                gint const mq = -DOUBLE_Q_MIN + 1 - bq;
+                glong const c = DOUBLE_C_MIN | t;
+                if (0 < mq && mq < DOUBLE_P) {
+                    // fast path for the integers less than 2^53
+                    glong const f = c >> mq;
+                    if (f << mq == c)
+                        return writeDecimal(out, next, f, 0);
+                }
+                return writeDouble(out, next, -mq, c, 0);
+            }
+            if (t != 0)
+                // subnormal value: the too small significands are multiplied by 10
+                return t < DOUBLE_C_TINY
+                       ? writeDouble(out, next, DOUBLE_Q_MIN, 10 * t, -1)
+                       : writeDouble(out, next, DOUBLE_Q_MIN, t, 0);
+            return next + writeChars(out + next, "0.0");
+        }
+
+        gint DoubleToDecimal::toChars(gfloat f, glong dst) {
+            gbyte *const out = (gbyte *) dst;
+            gint const bits = Float::toIntBits(f);
+            gint const t = bits & ((1 << (FLOAT_P - 1)) - 1);
+            gint const bq = (bits >> (FLOAT_P - 1)) & 0xFF;
+            if (bq == 0xFF)
+                return writeChars(out, t != 0 ? "NaN" : bits > 0 ? "Infinity" : "-Infinity");
+            gint next = 0;
+            if (bits < 0)
+                out[next++] = '-';
+            if (bq != 0) {
+                gint const mq = -FLOAT_Q_MIN + 1 - bq;
+                gint const c = FLOAT_C_MIN | t;
+                if (0 < mq && mq < FLOAT_P) {
+                    gint const i = c >> mq;
+                    if (i << mq == c)
+                        return writeDecimal(out, next, i, 0);
+                }
+                return writeFloat(out, next, -mq, c, 0);
+            }
+            if (t != 0)
+                return t < FLOAT_C_TINY
+                       ? writeFloat(out, next, FLOAT_Q_MIN, 10 * t, -1)
+                       : writeFloat(out, next, FLOAT_Q_MIN, t, 0);
+            return next + writeChars(out + next, "0.0");
+        }
+
+    } // native
+
+} // core
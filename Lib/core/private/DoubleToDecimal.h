@@ -0,0 +1,69 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#ifndef CORE23_DOUBLETODECIMAL_H
+#define CORE23_DOUBLETODECIMAL_H
+
+#include <core/Object.h>
+
+namespace core {
+
+    namespace native {
+
+        /**
+         * The conversion of the floating-point values to their shortest decimal
+         * representation (used by Double.toString and Float.toString).
+         *
+         * <p>The decimal selected for a finite value <i>v</i> is the shortest decimal that
+         * rounds to <i>v</i> (the closest to <i>v</i> if there are several such decimals, with
+         * the even significand on ties). It is computed with the Schubfach algorithm of
+         * Raffaello Giulietti, with integer arithmetic only: one table lookup and three
+         * multiplications of 128 bits, without loop, nor big number.
+         *
+         * <p>The characters are written as LATIN1 bytes at the given native address, which
+         * must have room for <b style="color: orange;"> MAX_CHARS</b> bytes. None of these
+         * methods perform bounds checks, nor allocate memory.
+         *
+         * @author Brunshweeck Tazeussong
+         */
+        class DoubleToDecimal CORE_FINAL : public Object {
+        private:
+            DoubleToDecimal() = default;
+
+        public:
+
+            /**
+             * The maximum number of characters written for a double value
+             * (like "-2.2250738585072014E-308").
+             */
+            static CORE_FAST gint MAX_CHARS = 24;
+
+            /**
+             * The maximum number of characters written for a float value
+             * (the sign, 9 digits, the decimal point and an exponent like "E-38").
+             */
+            static CORE_FAST gint MAX_FLOAT_CHARS = 15;
+
+            /**
+             * Write at the given address the shortest decimal representation of the given
+             * double value (with the format of Double.toString).
+             *
+             * @return the number of written characters
+             */
+            static gint toChars(gdouble d, glong dst);
+
+            /**
+             * Write at the given address the shortest decimal representation of the given
+             * float value (with the format of Float.toString).
+             *
+             * @return the number of written characters
+             */
+            static gint toChars(gfloat f, glong dst);
+        };
+
+    } // native
+
+} // core
+
+#endif //CORE23_DOUBLETODECIMAL_H
@@ -0,0 +1,711 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "Formatter.h"
+#include <core/private/StringCoding.h>
+#include <core/private/DoubleToDecimal.h>
+#include <core/private/Null.h>
+#include <core/StringBuffer.h>
+#include <core/Character.h>
+#include <core/Double.h>
+#include <core/Math.h>
+#include <core/IllegalArgumentException.h>
+#include <core/IndexException.h>
+#include <core/native/CharArray.h>
+
+namespace core {
+
+    namespace native {
+
+        CORE_ALIAS(UINT32, GENERIC_UINT32);
+        CORE_ALIAS(UINT64, GENERIC_UINT64);
+
+        class Formatter::Output {
+        public:
+            /**
+             * Write the given characters (stored with the given coder).
+             */
+            virtual void write(glong src, gbyte coder, gint count) = 0;
+
+            /**
+             * Write count characters of the given String, from the given index.
+             */
+            void write(const String &str, gint index, gint count) {
+                write((glong) str.value + ((glong) index << str.coder), str.coder, count);
+            }
+
+            /**
+             * Write count times the given latin1 character.
+             */
+            void fill(gchar ch, gint count) {
+                gbyte chars[32];
+                for (gint i = 0; i < 32; ++i)
+                    chars[i] = (gbyte) ch;
+                for (; count > 32; count -= 32)
+                    write((glong) chars, StringCoding::LATIN1, 32);
+                if (count > 0)
+                    write((glong) chars, StringCoding::LATIN1, count);
+            }
+
+            virtual ~Output() = default;
+        };
+
+        /**
+         * The output of String.format. The characters are written in a local storage, such
+         * that the result (when it is not too large) is built with only one allocation.
+         */
+        class Formatter::StringOutput CORE_FINAL : public Formatter::Output {
+        private:
+            static CORE_FAST gint LOCAL_CAPACITY = 256;
+
+            gchar chars[LOCAL_CAPACITY] = {};
+            gint count = 0;
+
+            /**
+             * The storage of the large results (used when the local storage is full)
+             */
+            StringBuffer overflow;
+
+        public:
+            void write(glong src, gbyte coder, gint n) override {
+                if (overflow.len == 0 && n <= LOCAL_CAPACITY - count) {
+                    StringCoding::copy(src, coder, 0, (glong) chars, StringCoding::UTF16, count, n);
+                    count += n;
+                    return;
+                }
+                if (overflow.len == 0)
+                    append(overflow, (glong) chars, StringCoding::UTF16, count);
+                append(overflow, src, coder, n);
+            }
+
+            /**
+             * Append the given characters to the given buffer.
+             */
+            static void append(StringBuffer &sb, glong src, gbyte coder, gint n) {
+                if (n <= 0)
+                    return;
+                gint const oldLen = sb.len;
+                // the UTF16 chars may all be latin1 chars
+                sb.inflate(coder == StringCoding::LATIN1 || StringCoding::indexOfNonLatin1(src, n) < 0
+                           ? StringCoding::LATIN1 : StringCoding::UTF16);
+                sb.resize(oldLen + n);
+                StringCoding::copy(src, coder, 0, (glong) sb.value, sb.coder, oldLen, n);
+            }
+
+            String toString() const {
+                if (overflow.len > 0)
+                    return overflow.toString();
+                String str;
+                str.assign((glong) chars, StringCoding::UTF16, count);
+                return str;
+            }
+        };
+
+        /**
+         * The output of StringBuffer.appendFormat.
+         */
+        class Formatter::BufferOutput CORE_FINAL : public Formatter::Output {
+        private:
+            StringBuffer &dst;
+
+        public:
+            CORE_EXPLICIT BufferOutput(StringBuffer &dst) : dst(dst) {}
+
+            void write(glong src, gbyte coder, gint n) override {
+                StringOutput::append(dst, src, coder, n);
+            }
+        };
+
+        /**
+         * The output of String.formatTo.
+         */
+        class Formatter::ArrayOutput CORE_FINAL : public Formatter::Output {
+        private:
+            CharArray &dst;
+
+        public:
+            gint offset;
+
+            CORE_EXPLICIT ArrayOutput(CharArray &dst, gint offset) : dst(dst), offset(offset) {}
+
+            void write(glong src, gbyte coder, gint n) override {
+                if (n <= 0)
+                    return;
+                if (n > dst.length() - offset)
+                    IndexException("Formatted characters exceed the array").throws(__trace("core.native.Formatter"));
+                StringCoding::copy(src, coder, 0, (glong) &dst[offset], StringCoding::UTF16, 0, n);
+                offset += n;
+            }
+        };
+
+        namespace {
+
+            CORE_FAST gbyte LATIN1 = StringCoding::LATIN1;
+            CORE_FAST gbyte UTF16 = StringCoding::UTF16;
+
+            CORE_FAST gint LEFT_JUSTIFY = 1;
+            CORE_FAST gint ZERO_PAD = 2;
+            CORE_FAST gint LEADING_SIGN = 4;
+            CORE_FAST gint LEADING_SPACE = 8;
+            CORE_FAST gint ALTERNATE = 16;
+
+            /**
+             * The number of fraction digits computed exactly. The next digits are always
+             * zero (the fraction of a double has at most 1074 digits).
+             */
+            CORE_FAST gint DIGITS_LIMIT = 1100;
+
+            /**
+             * The parsed format specifier
+             */
+            interface Spec {
+                gint flags;
+                gint width;
+                gint precision;
+                gchar conversion;
+            };
+
+            using Output = Formatter::Output;
+            using Argument = Formatter::Argument;
+
+            void illegalFormat(const String &message, gchar conversion) {
+                IllegalArgumentException(message + " '%"_S + String::valueOf(conversion) + "'"_S)
+                        .throws(__trace("core.native.Formatter"));
+            }
+
+            /**
+             * Write the padded number: the prefix (sign or radix), the zeros for the zero-padding,
+             * the body, the trailing zeros and the suffix (exponent).
+             */
+            void writeNumber(Output &out, const Spec &spec, const gbyte *prefix, gint prefixLength,
+                             const gbyte *body, gint bodyLength, gint zeros, const gbyte *suffix, gint suffixLength) {
+                gint const length = prefixLength + bodyLength + zeros + suffixLength;
+                gint const padding = spec.width > length ? spec.width - length : 0;
+                if ((spec.flags & (LEFT_JUSTIFY | ZERO_PAD)) == 0)
+                    out.fill(' ', padding);
+                out.write((glong) prefix, LATIN1, prefixLength);
+                if ((spec.flags & (LEFT_JUSTIFY | ZERO_PAD)) == ZERO_PAD)
+                    out.fill('0', padding);
+                out.write((glong) body, LATIN1, bodyLength);
+                out.fill('0', zeros);
+                out.write((glong) suffix, LATIN1, suffixLength);
+                if ((spec.flags & LEFT_JUSTIFY) != 0)
+                    out.fill(' ', padding);
+            }
+
+            /**
+             * Write the padded text (padded with spaces only).
+             */
+            void writeText(Output &out, const Spec &spec, glong src, gbyte coder, gint count) {
+                gint const padding = spec.width > count ? spec.width - count : 0;
+                if ((spec.flags & LEFT_JUSTIFY) == 0)
+                    out.fill(' ', padding);
+                out.write(src, coder, count);
+                if ((spec.flags & LEFT_JUSTIFY) != 0)
+                    out.fill(' ', padding);
+            }
+
+            void writeText(Output &out, const Spec &spec, const String &str) {
+                gint const count = spec.precision >= 0 ? Math::min(spec.precision, str.length()) : str.length();
+                gint const padding = spec.width > count ? spec.width - count : 0;
+                if ((spec.flags & LEFT_JUSTIFY) == 0)
+                    out.fill(' ', padding);
+                out.write(str, 0, count);
+                if ((spec.flags & LEFT_JUSTIFY) != 0)
+                    out.fill(' ', padding);
+            }
+
+            /**
+             * Return the sign prefix of the decimal numbers
+             */
+            gint signOf(const Spec &spec, gbool negative, gbyte *prefix) {
+                if (negative)
+                    prefix[0] = '-';
+                else if ((spec.flags & LEADING_SIGN) != 0)
+                    prefix[0] = '+';
+                else if ((spec.flags & LEADING_SPACE) != 0)
+                    prefix[0] = ' ';
+                else
+                    return 0;
+                return 1;
+            }
+
+            void formatInteger(Output &out, const Spec &spec, const Argument &arg, gbool negative, UINT64 bits) {
+                gint const conversion = spec.conversion | 0x20;
+                gint const shift = conversion == 'd' ? 0 : conversion == 'o' ? 3 : 4;
+                CORE_FAST gchar upperDigits[] = {'0', '1', '2', '3', '4', '5', '6', '7',
+                                                 '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+                CORE_FAST gchar lowerDigits[] = {'0', '1', '2', '3', '4', '5', '6', '7',
+                                                 '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+                const gchar *const digits = spec.conversion == 'X' ? upperDigits : lowerDigits;
+                gbyte body[24];
+                gbyte prefix[2];
+                gint i = 24;
+                gint prefixLength = 0;
+                if (shift == 0) {
+                    do {
+                        body[--i] = (gbyte) ('0' + (gint) (bits % 10));
+                        bits /= 10;
+                    } while (bits > 0);
+                    prefixLength = signOf(spec, negative, prefix);
+                } else {
+                    if (negative && arg.size < 8)
+                        // two's complement on the size of argument type
+                        bits &= ((UINT64) 1 << (arg.size << 3)) - 1;
+                    do {
+                        body[--i] = (gbyte) digits[bits & ((1 << shift) - 1)];
+                        bits >>= shift;
+                    } while (bits > 0);
+                    if ((spec.flags & ALTERNATE) != 0) {
+                        prefix[prefixLength++] = '0';
+                        if (shift == 4)
+                            prefix[prefixLength++] = (gbyte) spec.conversion;
+                    }
+                }
+                writeNumber(out, spec, prefix, prefixLength, body + i, 24 - i, 0, null, 0);
+            }
+
+            /**
+             * The exact decimal expansion of a finite non-negative double. The digits of integer part
+             * are computed at construction, the digits of fraction are generated one by one.
+             */
+            class Decimal CORE_FINAL {
+            private:
+                /**
+                 * The fraction, stored in little-endian 32-bit limbs. The value of fraction is
+                 * (limbs / 2^scale).
+                 */
+                UINT32 limbs[36] = {};
+                gint size = 0;
+                gint scale = 0;
+
+            public:
+                /**
+                 * The digits of integer part (empty when the integer part is zero)
+                 */
+                gbyte integer[320] = {};
+                gint integerLength = 0;
+
+                CORE_EXPLICIT Decimal(gdouble value) {
+                    glong const bits = Double::toLongBits(value);
+                    gint exponent = (gint) ((bits & Double::EXPONENT_BIT_MASK) >> (Double::SIGNIFICAND_WIDTH - 1));
+                    UINT64 significand = (UINT64) (bits & Double::SIGNIFICAND_BIT_MASK);
+                    if (exponent == 0)
+                        exponent = 1;
+                    else
+                        significand |= (UINT64) 1 << (Double::SIGNIFICAND_WIDTH - 1);
+                    if (significand == 0)
+                        return;
+                    // value = significand * 2^shift
+                    gint const shift = exponent - Double::EXPONENT_BIAS - (Double::SIGNIFICAND_WIDTH - 1);
+                    UINT32 n[34] = {};
+                    gint count = 0;
+                    if (shift >= 0) {
+                        gint const q = shift >> 5;
+                        gint const r = shift & 31;
+                        n[q] = (UINT32) (significand << r);
+                        n[q + 1] = (UINT32) (r > 0 ? significand >> (32 - r) : significand >> 32);
+                        n[q + 2] = (UINT32) (r > 0 ? significand >> (64 - r) : 0);
+                        count = q + 3;
+                    } else {
+                        scale = -shift;
+                        UINT64 const integralPart = scale < 64 ? significand >> scale : 0;
+                        UINT64 const fraction = scale < 64 ? significand & (((UINT64) 1 << scale) - 1) : significand;
+                        n[0] = (UINT32) integralPart;
+                        n[1] = (UINT32) (integralPart >> 32);
+                        count = 2;
+                        limbs[0] = (UINT32) fraction;
+                        limbs[1] = (UINT32) (fraction >> 32);
+                        size = (scale >> 5) + 2;
+                    }
+                    toDecimal(n, count);
+                }
+
+                /**
+                 * Return the next digit of fraction
+                 */
+                gint nextDigit() {
+                    if (scale == 0)
+                        return 0;
+                    UINT64 carry = 0;
+                    for (gint i = 0; i < size; ++i) {
+                        UINT64 const product = (UINT64) limbs[i] * 10 + carry;
+                        limbs[i] = (UINT32) product;
+                        carry = product >> 32;
+                    }
+                    // the digit is stored in the 4 bits from position scale
+                    gint const q = scale >> 5;
+                    gint const r = scale & 31;
+                    gint const digit = (gint) (((limbs[q] | ((UINT64) limbs[q + 1] << 32)) >> r) & 15);
+                    limbs[q] &= ((UINT32) 1 << r) - 1;
+                    limbs[q + 1] = 0;
+                    return digit;
+                }
+
+            private:
+                /**
+                 * Compute the digits of the given integer (little-endian 32-bit limbs), by
+                 * groups of 9 digits.
+                 */
+                void toDecimal(UINT32 *n, gint count) {
+                    UINT32 groups[36];
+                    gint groupCount = 0;
+                    while (count > 0 && n[count - 1] == 0)
+                        count -= 1;
+                    while (count > 0) {
+                        UINT64 remainder = 0;
+                        for (gint i = count - 1; i >= 0; --i) {
+                            UINT64 const current = (remainder << 32) | n[i];
+                            n[i] = (UINT32) (current / 1000000000);
+                            remainder = current % 1000000000;
+                        }
+                        groups[groupCount++] = (UINT32) remainder;
+                        while (count > 0 && n[count - 1] == 0)
+                            count -= 1;
+                    }
+                    for (gint i = groupCount - 1; i >= 0; --i) {
+                        UINT32 group = groups[i];
+                        gint length = 9;
+                        if (i == groupCount - 1)
+                            for (length = 1; length < 9 && group >= pow10(length); ++length) {}
+                        for (gint j = integerLength + length - 1; j >= integerLength; --j) {
+                            integer[j] = (gbyte) ('0' + group % 10);
+                            group /= 10;
+                        }
+                        integerLength += length;
+                    }
+                }
+
+                static UINT32 pow10(gint n) {
+                    UINT32 p = 1;
+                    for (gint i = 0; i < n; ++i)
+                        p *= 10;
+                    return p;
+                }
+            };
+
+            /**
+             * Round half-up the given digits with the given next digit. Return true if
+             * the carry propagates beyond the first digit (all digits become zero).
+             */
+            gbool roundUp(gbyte *digits, gint count, gint nextDigit) {
+                if (nextDigit < 5)
+                    return false;
+                for (gint i = count - 1; i >= 0; --i) {
+                    if (digits[i] == '.')
+                        continue;
+                    if (digits[i] != '9') {
+                        digits[i] += 1;
+                        return false;
+                    }
+                    digits[i] = '0';
+                }
+                return true;
+            }
+
+            void formatFloating(Output &out, const Spec &spec, gdouble value) {
+                gbool const upper = spec.conversion == 'E';
+                gbyte prefix[1];
+                gint const prefixLength = signOf(spec, Double::toLongBits(value) < 0, prefix);
+                if (!(Math::abs(value) <= Double::MAX_VALUE)) {
+                    // NaN or infinity
+                    Spec textSpec = spec;
+                    textSpec.flags &= ~ZERO_PAD;
+                    CORE_FAST gbyte nan[] = {'N', 'a', 'N'};
+                    CORE_FAST gbyte infinity[] = {'I', 'n', 'f', 'i', 'n', 'i', 't', 'y'};
+                    CORE_FAST gbyte upperInfinity[] = {'I', 'N', 'F', 'I', 'N', 'I', 'T', 'Y'};
+                    if (Double::isNaN(value))
+                        writeNumber(out, textSpec, null, 0, nan, 3, 0, null, 0);
+                    else
+                        writeNumber(out, textSpec, prefix, prefixLength, upper ? upperInfinity : infinity, 8, 0,
+                                    null, 0);
+                    return;
+                }
+                gint const precision = spec.precision >= 0 ? spec.precision : 6;
+                gint const exactDigits = Math::min(precision, DIGITS_LIMIT);
+                Decimal decimal(Math::abs(value));
+                // the first digit is reserved for the carry of rounding
+                gbyte body[1 + 320 + 1 + DIGITS_LIMIT];
+                gint length = 1;
+                body[0] = '0';
+                if (spec.conversion == 'f') {
+                    if (decimal.integerLength == 0)
+                        body[length++] = '0';
+                    for (gint i = 0; i < decimal.integerLength; ++i)
+                        body[length++] = decimal.integer[i];
+                    if (exactDigits > 0 || (spec.flags & ALTERNATE) != 0)
+                        body[length++] = '.';
+                    for (gint i = 0; i < exactDigits; ++i)
+                        body[length++] = (gbyte) ('0' + decimal.nextDigit());
+                    gbool const carry = precision == exactDigits && roundUp(body + 1, length - 1, decimal.nextDigit());
+                    gint const start = carry ? 0 : 1;
+                    if (carry)
+                        body[0] = '1';
+                    writeNumber(out, spec, prefix, prefixLength, body + start, length - start, precision - exactDigits,
+                                null, 0);
+                    return;
+                }
+                // scientific notation: the significant digits are the digits of integer part,
+                // then the digits of fraction (from the first non-zero digit)
+                gint exponent = 0;
+                gint index = 0;
+                gint digit = 0;
+                if (decimal.integerLength > 0) {
+                    exponent = decimal.integerLength - 1;
+                    digit = decimal.integer[index++] - '0';
+                } else if (value != 0) {
+                    exponent = -1;
+                    for (digit = decimal.nextDigit(); digit == 0; digit = decimal.nextDigit())
+                        exponent -= 1;
+                }
+                for (gint i = 0; i <= exactDigits; ++i) {
+                    body[length++] = (gbyte) ('0' + digit);
+                    if (i == 0 && (exactDigits > 0 || (spec.flags & ALTERNATE) != 0))
+                        body[length++] = '.';
+                    digit = index < decimal.integerLength ? decimal.integer[index++] - '0' : decimal.nextDigit();
+                }
+                if (precision == exactDigits && roundUp(body + 1, length - 1, digit)) {
+                    // 9.99 is rounded to 1.00 (with next exponent)
+                    body[1] = '1';
+                    exponent += 1;
+                }
+                gbyte suffix[6];
+                gint suffixLength = 0;
+                suffix[suffixLength++] = upper ? 'E' : 'e';
+                suffix[suffixLength++] = exponent < 0 ? '-' : '+';
+                gint const absExponent = Math::abs(exponent);
+                if (absExponent >= 100)
+                    suffix[suffixLength++] = (gbyte) ('0' + absExponent / 100);
+                suffix[suffixLength++] = (gbyte) ('0' + absExponent / 10 % 10);
+                suffix[suffixLength++] = (gbyte) ('0' + absExponent % 10);
+                writeNumber(out, spec, prefix, prefixLength, body + 1, length - 1, precision - exactDigits,
+                            suffix, suffixLength);
+            }
+
+            void formatCharacter(Output &out, const Spec &spec, gint codePoint) {
+                if (!Character::isValidCodePoint(codePoint))
+                    illegalFormat("Illegal code point for specifier"_S, spec.conversion);
+                if (spec.conversion == 'C')
+                    codePoint = Character::toUpperCase(codePoint);
+                gchar chars[2];
+                gint count = 1;
+                if (Character::isSupplementary(codePoint)) {
+                    chars[0] = Character::highSurrogate(codePoint);
+                    chars[1] = Character::lowSurrogate(codePoint);
+                    count = 2;
+                } else
+                    chars[0] = (gchar) codePoint;
+                writeText(out, spec, (glong) chars, UTF16, count);
+            }
+
+            void formatString(Output &out, const Spec &spec, const Argument &arg, const Object *obj) {
+                if (arg.kind == Argument::CHARS && arg.address == 0) {
+                    writeText(out, spec, "null"_S);
+                    return;
+                }
+                if (arg.kind == Argument::CHARS && arg.size == 1 && spec.conversion == 's') {
+                    // the ascii literals are written without conversion to String
+                    const gbyte *const chars = (const gbyte *) arg.address;
+                    gint count = 0;
+                    while (chars[count] > 0)
+                        count += 1;
+                    if (chars[count] == 0) {
+                        if (spec.precision >= 0)
+                            count = Math::min(count, spec.precision);
+                        writeText(out, spec, (glong) chars, LATIN1, count);
+                        return;
+                    }
+                }
+                if (arg.kind == Argument::OBJECT && Class<String>::hasInstance(*obj) && spec.conversion == 's') {
+                    writeText(out, spec, (const String &) *obj);
+                    return;
+                }
+                if (arg.kind == Argument::FLOATING && spec.conversion == 's') {
+                    // the shortest decimal is written without conversion to String
+                    gbyte chars[DoubleToDecimal::MAX_CHARS];
+                    gint count = arg.size == 4 ? DoubleToDecimal::toChars((gfloat) arg.doubleValue, (glong) chars)
+                                               : DoubleToDecimal::toChars(arg.doubleValue, (glong) chars);
+                    if (spec.precision >= 0)
+                        count = Math::min(count, spec.precision);
+                    writeText(out, spec, (glong) chars, LATIN1, count);
+                    return;
+                }
+                String str;
+                switch (arg.kind) {
+                    case Argument::BOOLEAN:
+                        str = String::valueOf(arg.longValue != 0);
+                        break;
+                    case Argument::CHARACTER:
+                        str = String::valueOfCodePoint((gint) arg.longValue);
+                        break;
+                    case Argument::INTEGER:
+                        str = String::valueOf(arg.longValue);
+                        break;
+                    case Argument::UNSIGNED:
+                        str = String::valueOfUnsigned(arg.longValue);
+                        break;
+                    case Argument::FLOATING:
+                        str = arg.size == 4 ? String::valueOf((gfloat) arg.doubleValue)
+                                            : String::valueOf(arg.doubleValue);
+                        break;
+                    case Argument::CHARS:
+                        str = arg.size == 1 ? String((const char *) arg.address) :
+                              arg.size == 2 ? String((const char16_t *) arg.address) :
+                              String((const char32_t *) arg.address);
+                        break;
+                    default:
+                        str = String::valueOf(*obj);
+                        break;
+                }
+                writeText(out, spec, spec.conversion == 'S' ? str.toUpperCase() : str);
+            }
+
+            /**
+             * Parse the decimal number from the given index, and set the index to the
+             * first character after the number. Return -1 if the number is missing.
+             */
+            gint parseNumber(const String &format, gint &index) {
+                gint number = -1;
+                for (gint length = format.length(); index < length; ++index) {
+                    gchar const ch = format.charAt(index);
+                    if (ch < '0' || ch > '9')
+                        break;
+                    number = (number < 0 ? 0 : number) * 10 + (ch - '0');
+                    if (number > 1000000)
+                        illegalFormat("Too large number in format specifier"_S, ch);
+                }
+                return number;
+            }
+        }
+
+        void Formatter::format(Output &out, const String &format, const Argument *argv, gint argc) {
+            gint const length = format.len;
+            gint ordinaryIndex = 0;
+            gint i = 0;
+            while (i < length) {
+                // the fixed text is written at once
+                gint const j = StringCoding::indexOf((glong) format.value, format.coder, length, '%', i);
+                out.write(format, i, (j < 0 ? length : j) - i);
+                if (j < 0)
+                    break;
+                i = j + 1;
+                Spec spec = {0, -1, -1, 0};
+                gint argIndex = -1;
+                gint k = i;
+                gint const number = parseNumber(format, k);
+                if (number >= 0 && k < length && format.charAt(k) == '$') {
+                    if (number == 0)
+                        illegalFormat("Illegal argument index for specifier"_S, '0');
+                    argIndex = number - 1;
+                    i = k + 1;
+                }
+                for (; i < length; ++i) {
+                    gchar const ch = format.charAt(i);
+                    gint const flag = ch == '-' ? LEFT_JUSTIFY : ch == '0' ? ZERO_PAD : ch == '+' ? LEADING_SIGN :
+                                      ch == ' ' ? LEADING_SPACE : ch == '#' ? ALTERNATE : 0;
+                    if (flag == 0)
+                        break;
+                    spec.flags |= flag;
+                }
+                spec.width = parseNumber(format, i);
+                if (i < length && format.charAt(i) == '.') {
+                    i += 1;
+                    spec.precision = parseNumber(format, i);
+                    if (spec.precision < 0)
+                        illegalFormat("Missing precision for specifier"_S, '.');
+                }
+                if (i >= length)
+                    illegalFormat("Missing format conversion after"_S, '%');
+                spec.conversion = format.charAt(i++);
+                if ((spec.flags & (LEFT_JUSTIFY | ZERO_PAD)) != 0 && spec.width < 0)
+                    illegalFormat("Missing width for specifier"_S, spec.conversion);
+                switch (spec.conversion) {
+                    case '%':
+                        writeText(out, spec, (glong) "%", LATIN1, 1);
+                        continue;
+                    case 'n':
+                        out.write((glong) "\n", LATIN1, 1);
+                        continue;
+                    case 'b':
+                    case 'B':
+                    case 'c':
+                    case 'C':
+                    case 'd':
+                    case 'o':
+                    case 'x':
+                    case 'X':
+                    case 'e':
+                    case 'E':
+                    case 'f':
+                    case 's':
+                    case 'S':
+                        break;
+                    default:
+                        illegalFormat("Unknown format conversion"_S, spec.conversion);
+                }
+                gint const index = argIndex >= 0 ? argIndex : ordinaryIndex++;
+                if (index >= argc)
+                    illegalFormat("Missing format argument for specifier"_S, spec.conversion);
+                const Argument &arg = argv[index];
+                const Object *const obj = arg.kind == Argument::OBJECT ? (const Object *) arg.address : null;
+                switch (spec.conversion | 0x20) {
+                    case 'b':
+                        if (arg.kind == Argument::BOOLEAN ? arg.longValue != 0 : obj == null || &null != obj)
+                            writeText(out, spec, (glong) (spec.conversion == 'B' ? "TRUE" : "true"), LATIN1, 4);
+                        else
+                            writeText(out, spec, (glong) (spec.conversion == 'B' ? "FALSE" : "false"), LATIN1, 5);
+                        break;
+                    case 'c':
+                        if (arg.kind != Argument::CHARACTER && arg.kind != Argument::INTEGER)
+                            illegalFormat("Incompatible format argument for specifier"_S, spec.conversion);
+                        formatCharacter(out, spec, (gint) arg.longValue);
+                        break;
+                    case 'd':
+                    case 'o':
+                    case 'x':
+                        if (arg.kind != Argument::INTEGER && arg.kind != Argument::UNSIGNED)
+                            illegalFormat("Incompatible format argument for specifier"_S, spec.conversion);
+                        if (spec.precision >= 0)
+                            illegalFormat("Precision not allowed for specifier"_S, spec.conversion);
+                        if (arg.kind == Argument::INTEGER && arg.longValue < 0)
+                            formatInteger(out, spec, arg, true, spec.conversion == 'd' ? -(UINT64) arg.longValue
+                                                                                       : (UINT64) arg.longValue);
+                        else
+                            formatInteger(out, spec, arg, false, (UINT64) arg.longValue);
+                        break;
+                    case 'e':
+                    case 'f':
+                        if (arg.kind != Argument::FLOATING)
+                            illegalFormat("Incompatible format argument for specifier"_S, spec.conversion);
+                        formatFloating(out, spec, arg.doubleValue);
+                        break;
+                    default:
+                        formatString(out, spec, arg, obj);
+                        break;
+                }
+            }
+        }
+
+        String Formatter::format(const String &format, const Argument *argv, gint argc) {
+            StringOutput out;
+            Formatter::format(out, format, argv, argc);
+            return out.toString();
+        }
+
+        void Formatter::format(StringBuffer &dst, const String &format, const Argument *argv, gint argc) {
+            BufferOutput out(dst);
+            Formatter::format(out, format, argv, argc);
+        }
+
+        gint Formatter::format(CharArray &dst, gint offset, const String &format, const Argument *argv, gint argc) {
+            if (offset < 0 || offset > dst.length())
+                IndexException(offset).throws(__trace("core.native.Formatter"));
+            ArrayOutput out(dst, offset);
+            Formatter::format(out, format, argv, argc);
+            return out.offset - offset;
+        }
+
+    } // native
+
+} // core
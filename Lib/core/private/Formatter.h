@@ -0,0 +1,236 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#ifndef CORE23_FORMATTER_H
+#define CORE23_FORMATTER_H
+
+#include <core/Object.h>
+
+namespace core {
+
+    class String;
+
+    class StringBuffer;
+
+    namespace native {
+
+        class CharArray;
+
+        /**
+         * The engine of formatting used by String.format, String.formatTo and
+         * StringBuffer.appendFormat.
+         *
+         * <p>The format string contains fixed text and format specifiers, with the syntax:
+         * <blockquote><pre>
+         *   %[argument_index$][flags][width][.precision]conversion
+         * </pre></blockquote>
+         *
+         * <ul>
+         * <li><b style="color: orange;"> argument_index</b>: the position (from 1) of argument
+         *     in the list of arguments. By default, the specifiers take the arguments in order.
+         * <li><b style="color: orange;"> flags</b>: <b> '-'</b> (left-justified), <b> '0'</b>
+         *     (zero-padded), <b> '+'</b> (always signed), <b> ' '</b> (leading space for the
+         *     positive values), <b> '#'</b> (prefix 0x or 0 for the hexadecimal and octal values).
+         * <li><b style="color: orange;"> width</b>: the minimum number of characters written
+         *     (the result is padded with spaces, or zeros).
+         * <li><b style="color: orange;"> precision</b>: the number of digits after the decimal
+         *     separator (for 'e' and 'f', 6 by default), or the maximum number of characters (for 's').
+         * <li><b style="color: orange;"> conversion</b>: <b> 'b'</b> (boolean), <b> 'c'</b> (character),
+         *     <b> 'd'</b> (decimal integer), <b> 'o'</b> (octal integer), <b> 'x'</b> (hexadecimal
+         *     integer), <b> 'e'</b> (decimal floating-point in scientific notation), <b> 'f'</b>
+         *     (decimal floating-point), <b> 's'</b> (string, the objects are converted with
+         *     toString), <b> '%'</b> (the percent sign) and <b> 'n'</b> (the line separator).
+         *     The upper-case conversions ('B', 'C', 'X', 'E' and 'S') produce upper-case results.
+         * </ul>
+         *
+         * <p>The negative integers are formatted with 'o' and 'x' in two's complement (on the
+         * size of their type). The floating-point values are formatted from their exact binary
+         * value, rounded half-up.
+         *
+         * <p>The arguments are never copied: each argument is referenced by a small descriptor
+         * (see Formatter.Argument), and the characters are written directly to the destination.
+         * The format string is parsed once, while the result is written.
+         *
+         * @author Brunshweeck Tazeussong
+         */
+        class Formatter CORE_FINAL : public Object {
+        private:
+            Formatter() = default;
+
+        public:
+
+            /**
+             * The descriptor of one formatting argument (its kind, the size of its type and
+             * its value or address). The descriptor of object references this object, it is
+             * valid only while this object lives.
+             */
+            class Argument CORE_FINAL {
+            public:
+                static CORE_FAST gint NONE = 0;
+                static CORE_FAST gint BOOLEAN = 1;
+                static CORE_FAST gint CHARACTER = 2;
+                static CORE_FAST gint INTEGER = 3;
+                static CORE_FAST gint UNSIGNED = 4;
+                static CORE_FAST gint FLOATING = 5;
+                static CORE_FAST gint CHARS = 6;
+                static CORE_FAST gint OBJECT = 7;
+
+            private:
+                template<gint K>
+                interface Tag {
+                };
+
+                /**
+                 * The sign of integer types (the other types are never unsigned).
+                 */
+                template<class T, gbool = Class<T>::isInteger()>
+                interface Sign {
+                    static CORE_FAST gbool isUnsigned() { return false; }
+                };
+
+                template<class T>
+                interface Sign<T, true> {
+                    static CORE_FAST gbool isUnsigned() { return (typename Class<T>::NCVRef) -1 > 0; }
+                };
+
+            public:
+
+                /**
+                 * Return the kind of arguments of type T. The unsigned integers of 64 bits
+                 * are distinguished, the other integers are stored as signed 64-bit integers.
+                 */
+                template<class T>
+                static CORE_FAST gint kindOf() {
+                    return Class<T>::isBoolean() ? BOOLEAN :
+                           Class<T>::isCharacter() ? CHARACTER :
+                           Class<T>::isInteger() ? (Sign<T>::isUnsigned() && sizeof(T) >= 8 ? UNSIGNED : INTEGER) :
+                           Class<T>::isFloating() ? FLOATING :
+                           Class<T>::isString() ? CHARS :
+                           Class<Object>::template isSuper<T>() ? OBJECT : NONE;
+                }
+
+                /**
+                 * The kind of this argument
+                 */
+                gint kind;
+
+                /**
+                 * The size (in bytes) of the type of this argument
+                 */
+                gint size;
+
+                /**
+                 * The value of this argument (its address for the chars literals and the objects)
+                 */
+                union {
+                    glong longValue;
+                    gdouble doubleValue;
+                    glong address;
+                };
+
+            private:
+                template<class T>
+                CORE_EXPLICIT Argument(const T &, Tag<NONE>) : Argument() {}
+
+                template<class T>
+                CORE_EXPLICIT Argument(const T &value, Tag<BOOLEAN>) :
+                        kind(BOOLEAN), size(1), longValue(value ? 1 : 0) {}
+
+                template<class T>
+                CORE_EXPLICIT Argument(const T &value, Tag<CHARACTER>) :
+                        kind(CHARACTER), size(sizeof(T)), longValue(sizeof(T) == 1 ? value & 0xFF : (glong) value) {}
+
+                template<class T>
+                CORE_EXPLICIT Argument(const T &value, Tag<INTEGER>) :
+                        kind(INTEGER), size(sizeof(T)), longValue((glong) value) {}
+
+                template<class T>
+                CORE_EXPLICIT Argument(const T &value, Tag<UNSIGNED>) :
+                        kind(UNSIGNED), size(sizeof(T)), longValue((glong) value) {}
+
+                template<class T>
+                CORE_EXPLICIT Argument(const T &value, Tag<FLOATING>) :
+                        kind(FLOATING), size(sizeof(T)), doubleValue((gdouble) value) {}
+
+                template<class T>
+                CORE_EXPLICIT Argument(const T &value, Tag<CHARS>) :
+                        kind(CHARS), size(sizeof(value[0])), address((glong) value) {}
+
+                template<class T>
+                CORE_EXPLICIT Argument(const T &value, Tag<OBJECT>) :
+                        kind(OBJECT), size(0), address((glong) &value) {}
+
+            public:
+
+                /**
+                 * Construct the descriptor of missing argument.
+                 */
+                CORE_FAST Argument() : kind(NONE), size(0), longValue(0) {}
+
+                /**
+                 * Construct the descriptor of the given argument (boolean, character, integer,
+                 * floating-point, chars literal or object).
+                 */
+                template<class T>
+                CORE_IMPLICIT Argument(const T &value) : Argument(value, Tag<kindOf<T>()>()) {
+                    CORE_STATIC_ASSERT(kindOf<T>() != NONE, "Unsupported type of formatting argument");
+                }
+            };
+
+            /**
+             * The destination of the formatted characters (a String in construction,
+             * a StringBuffer or a CharArray).
+             */
+            class Output;
+
+        private:
+
+            class StringOutput;
+
+            class BufferOutput;
+
+            class ArrayOutput;
+
+            /**
+             * Write to the given output the characters formatted with the given format
+             * and arguments.
+             */
+            static void format(Output &out, const String &format, const Argument *argv, gint argc);
+
+        public:
+
+            /**
+             * Return the String formatted with the given format and arguments.
+             *
+             * @throws IllegalArgumentException if the format is illegal, or incompatible with
+             *          the given arguments.
+             */
+            static String format(const String &format, const Argument *argv, gint argc);
+
+            /**
+             * Append to the given buffer the characters formatted with the given format
+             * and arguments.
+             *
+             * @throws IllegalArgumentException if the format is illegal, or incompatible with
+             *          the given arguments.
+             */
+            static void format(StringBuffer &dst, const String &format, const Argument *argv, gint argc);
+
+            /**
+             * Write in the given array (from the given offset) the characters formatted
+             * with the given format and arguments.
+             *
+             * @return the number of written characters
+             * @throws IllegalArgumentException if the format is illegal, or incompatible with
+             *          the given arguments.
+             * @throws IndexException if the formatted characters exceed the array.
+             */
+            static gint format(CharArray &dst, gint offset, const String &format, const Argument *argv, gint argc);
+        };
+
+    } // native
+
+} // core
+
+#endif //CORE23_FORMATTER_H
@@ -193,6 +193,9 @@ namespace core {
         template<class>
         class PriorityQueue;
 
+        template<class, class>
+        class TimSort;
+
         template<class, class>
         class Map;
 
@@ -0,0 +1,147 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "IntegerToChars.h"
+#include <core/Long.h>
+
+namespace core {
+
+    namespace native {
+
+        namespace {
+
+            CORE_FAST char DIGITS[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+            /**
+             * The pairs of decimal digits: the pair of n (0 <= n < 100) is at index 2n.
+             */
+            CORE_FAST char DIGIT_PAIRS[] = "00010203040506070809"
+                                           "10111213141516171819"
+                                           "20212223242526272829"
+                                           "30313233343536373839"
+                                           "40414243444546474849"
+                                           "50515253545556575859"
+                                           "60616263646566676869"
+                                           "70717273747576777879"
+                                           "80818283848586878889"
+                                           "90919293949596979899";
+
+            CORE_FAST GENERIC_UINT64 POWERS_OF_TEN[] = {
+                    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+                    100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+                    10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+                    100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+            };
+
+            /**
+             * Return the number of decimal digits of the given value.
+             */
+            gint digitCount(GENERIC_UINT64 value) {
+                // approximation of log10(value) from its number of bits (1233 / 4096 ~ log10(2))
+                gint const bits = 64 - Long::leadingZeros((glong) (value | 1));
+                gint const t = (bits * 1233) >> 12;
+                return t + ((value | 1) >= POWERS_OF_TEN[t] ? 1 : 0);
+            }
+
+            /**
+             * Write the decimal digits of the given value, the last one at index end - 1.
+             */
+            void writeDecimal(GENERIC_UINT64 value, gbyte *out, gint end) {
+                gint i = end;
+                while (value > 0xFFFFFFFFULL) {
+                    GENERIC_UINT64 const q = value / 100;
+                    gint const r = (gint) (value - q * 100) << 1;
+                    out[--i] = (gbyte) DIGIT_PAIRS[r + 1];
+                    out[--i] = (gbyte) DIGIT_PAIRS[r];
+                    value = q;
+                }
+                // the remaining digits are computed with 32-bit divisions
+                GENERIC_UINT32 v = (GENERIC_UINT32) value;
+                while (v >= 100) {
+                    GENERIC_UINT32 const q = v / 100;
+                    gint const r = (gint) (v - q * 100) << 1;
+                    out[--i] = (gbyte) DIGIT_PAIRS[r + 1];
+                    out[--i] = (gbyte) DIGIT_PAIRS[r];
+                    v = q;
+                }
+                if (v >= 10) {
+                    gint const r = (gint) v << 1;
+                    out[--i] = (gbyte) DIGIT_PAIRS[r + 1];
+                    out[--i] = (gbyte) DIGIT_PAIRS[r];
+                } else
+                    out[--i] = (gbyte) ('0' + v);
+            }
+
+            /**
+             * Write the digits of the given value in base 2^shift, and return their count.
+             */
+            gint writeBinary(GENERIC_UINT64 value, gint shift, gbyte *out) {
+                gint const bits = 64 - Long::leadingZeros((glong) (value | 1));
+                gint const count = (bits + shift - 1) / shift;
+                GENERIC_UINT64 const mask = ((GENERIC_UINT64) 1 << shift) - 1;
+                for (gint i = count - 1; i >= 0; --i) {
+                    out[i] = (gbyte) DIGITS[value & mask];
+                    value >>= shift;
+                }
+                return count;
+            }
+
+            /**
+             * Write the digits of the given value in the given base, and return their count.
+             */
+            gint writeDigits(GENERIC_UINT64 value, gint base, gbyte *out) {
+                switch (base) {
+                    case 10: {
+                        gint const count = digitCount(value);
+                        writeDecimal(value, out, count);
+                        return count;
+                    }
+                    case 2:
+                        return writeBinary(value, 1, out);
+                    case 4:
+                        return writeBinary(value, 2, out);
+                    case 8:
+                        return writeBinary(value, 3, out);
+                    case 16:
+                        return writeBinary(value, 4, out);
+                    case 32:
+                        return writeBinary(value, 5, out);
+                    default: {
+                        gint count = 0;
+                        for (GENERIC_UINT64 v = value; count == 0 || v > 0; v /= base)
+                            count += 1;
+                        for (gint i = count - 1; i >= 0; --i) {
+                            out[i] = (gbyte) DIGITS[value % base];
+                            value /= base;
+                        }
+                        return count;
+                    }
+                }
+            }
+        }
+
+        gint IntegerToChars::toChars(glong value, gint base, glong dst) {
+            gbyte *const out = (gbyte *) dst;
+            if (base < 2 || base > 36)
+                base = 10;
+            if (value >= 0)
+                return writeDigits((GENERIC_UINT64) value, base, out);
+            out[0] = '-';
+            // the magnitude of Long.MIN_VALUE is representable as unsigned
+            return 1 + writeDigits(-(GENERIC_UINT64) value, base, out + 1);
+        }
+
+        gint IntegerToChars::toUnsignedChars(glong value, gint base, glong dst) {
+            if (base < 2 || base > 36)
+                base = 10;
+            return writeDigits((GENERIC_UINT64) value, base, (gbyte *) dst);
+        }
+
+        gint IntegerToChars::decimalLength(glong value) {
+            return value >= 0 ? digitCount((GENERIC_UINT64) value) : 1 + digitCount(-(GENERIC_UINT64) value);
+        }
+
+    } // native
+
+} // core
@@ -0,0 +1,67 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#ifndef CORE23_INTEGERTOCHARS_H
+#define CORE23_INTEGERTOCHARS_H
+
+#include <core/Object.h>
+
+namespace core {
+
+    namespace native {
+
+        /**
+         * The conversion of the integers to their representation in a given base (used by
+         * Integer.toString, Long.toString, StringBuffer.append, ...).
+         *
+         * <p>The number of digits is computed first, then the digits are written from the
+         * last one: two decimal digits per division (with a table of the 100 pairs of
+         * digits), and one digit per shift and mask for the bases 2, 4, 8, 16 and 32.
+         *
+         * <p>The characters are written as LATIN1 bytes at the given native address, which
+         * must have room for <b style="color: orange;"> MAX_CHARS</b> bytes. None of these
+         * methods perform bounds checks, nor allocate memory. The bases out of range [2, 36]
+         * are replaced by the base 10.
+         *
+         * @author Brunshweeck Tazeussong
+         */
+        class IntegerToChars CORE_FINAL : public Object {
+        private:
+            IntegerToChars() = default;
+
+        public:
+
+            /**
+             * The maximum number of characters written (the sign and 64 binary digits).
+             */
+            static CORE_FAST gint MAX_CHARS = 65;
+
+            /**
+             * Write at the given address the representation of the given value in the given
+             * base (with the sign '-' if the value is negative).
+             *
+             * @return the number of written characters
+             */
+            static gint toChars(glong value, gint base, glong dst);
+
+            /**
+             * Write at the given address the representation of the given value in the given
+             * base, where the value is treated as an unsigned 64-bit integer.
+             *
+             * @return the number of written characters
+             */
+            static gint toUnsignedChars(glong value, gint base, glong dst);
+
+            /**
+             * Return the number of characters of the decimal representation of the given
+             * value (with the sign '-' if the value is negative).
+             */
+            static gint decimalLength(glong value);
+        };
+
+    } // native
+
+} // core
+
+#endif //CORE23_INTEGERTOCHARS_H
@@ -73,9 +73,7 @@ namespace core {
         if (l > Integer::MAX_VALUE) {
             IllegalArgumentException("Literal string length exceed integer range").throws(__xtrace());
         }
-        if (l == 0)
-            return {};
-        return String(s, 0, (gint) l);
+        return String::literal((glong) s, 1, (gint) l);
     }
 
     String operator ""_S(const char16_t s[], size_t l) {
@@ -85,14 +83,7 @@ namespace core {
         if (l > Integer::MAX_VALUE) {
             IllegalArgumentException("Literal string length exceed integer range").throws(__xtrace());
         }
-        if (l == 0)
-            return {};
-        gint const length = (gint) l;
-        CharArray chars = CharArray(length);
-        for (int i = 0; i < length; i += 1) {
-            chars[i] = s[i];
-        }
-        return String(chars);
+        return String::literal((glong) s, 2, (gint) l);
     }
 
     String operator ""_S(const char32_t s[], size_t l) {
@@ -102,33 +93,17 @@ namespace core {
         if (l > Integer::MAX_VALUE) {
             IllegalArgumentException("Literal string length exceed integer range").throws(__xtrace());
         }
-        if (l == 0)
-            return {};
-        gint length = 0;
-        size_t i;
-        for (i = 0; i < l && length >= 0; ++i) {
-            length += Character::charCount((gint) s[i]);
-        }
-        if (i < l) {
-            IllegalArgumentException("Literal string length exceed integer range").throws(__xtrace());
-        }
-        CharArray chars = CharArray(length);
-        i = 0;
-        for (int j = 0; j < length; ++j) {
-            gint const cp = (gint) s[i++];
-            if (cp > Character::MAX_VALUE) {
-                chars[j++] = Character::highSurrogate(cp);
-                chars[j] = Character::lowSurrogate(cp);
-            } else {
-                chars[j] = (gchar) cp;
-            }
-        }
-        return String(chars);
+        return String::literal((glong) s, 4, (gint) l);
     }
 
     String operator ""_S(const wchar_t s[], size_t l) {
-        CORE_ALIAS(LargeToUnicode, , typename Class<char16_t>::If<sizeof(wchar_t) == 2, char32_t>);
-        return operator ""_S((const LargeToUnicode *) s, l);
+        if (s == null) {
+            IllegalArgumentException("Illegal literal string").throws(__xtrace());
+        }
+        if (l > Integer::MAX_VALUE) {
+            IllegalArgumentException("Literal string length exceed integer range").throws(__xtrace());
+        }
+        return String::literal((glong) s, (gint) sizeof(wchar_t), (gint) l);
     }
 
 
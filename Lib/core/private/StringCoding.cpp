@@ -0,0 +1,1233 @@
+//
+// Created by T.N.Brunshweeck on 15/10/2026.
+//
+
+#include "StringCoding.h"
+#include <core/Long.h>
+
+#if defined(CORE_XCOMPILER_SSE2)
+#include <emmintrin.h>
+#endif
+#if defined(CORE_XCOMPILER_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace core {
+
+    namespace native {
+
+        namespace {
+
+            CORE_ALIAS(PBYTE, typename Class<gbyte>::Ptr);
+            CORE_ALIAS(PCBYTE, typename Class<const gbyte>::Ptr);
+            CORE_ALIAS(PCHAR, typename Class<gchar>::Ptr);
+            CORE_ALIAS(PCCHAR, typename Class<const gchar>::Ptr);
+
+            CORE_FAST gint U(gbyte b) { return b & 0xFF; }
+
+            CORE_FAST gint U(gchar c) { return c; }
+
+            /**
+             * The loops of this file are written on one coder (without any test of coder
+             * inside the loop). The searches use the vector instructions (SSE2 or AVX2)
+             * when they are enabled, and the scalar loops for the remaining chars.
+             *
+             * The vector operations return a mask with one bit per byte (so sizeof(T)
+             * bits per char) set for each char that matches.
+             */
+
+            CORE_ALWAYS_INLINE gint lowestBit(glong mask) {
+#if defined(CORE_COMPILER_GNU)
+                return __builtin_ctzll((unsigned long long) mask);
+#else
+                return Long::trailingZeros(mask);
+#endif
+            }
+
+            CORE_ALWAYS_INLINE gint highestBit(glong mask) {
+#if defined(CORE_COMPILER_GNU)
+                return 63 - __builtin_clzll((unsigned long long) mask);
+#else
+                return 63 - Long::leadingZeros(mask);
+#endif
+            }
+
+            CORE_ALWAYS_INLINE gint bitCount(glong mask) {
+#if defined(CORE_COMPILER_GNU)
+                return __builtin_popcountll((unsigned long long) mask);
+#else
+                return Long::bitCount(mask);
+#endif
+            }
+
+            /**
+             * Return the mask without the bits of char at the given index (in block).
+             */
+            template<class T>
+            CORE_ALWAYS_INLINE glong clearChar(glong mask, gint index) {
+                return mask & ~(((1LL << sizeof(T)) - 1) << (index * (gint) sizeof(T)));
+            }
+
+#if defined(CORE_XCOMPILER_SSE2)
+
+            /**
+             * The operations on 128-bit vectors (SSE2).
+             */
+            struct Vector128 {
+                CORE_ALIAS(Vec, __m128i);
+
+                static CORE_FAST gint SIZE = 16;
+
+                static CORE_ALWAYS_INLINE Vec broadcast(const gbyte *, gint c) { return _mm_set1_epi8((char) c); }
+
+                static CORE_ALWAYS_INLINE Vec broadcast(const gchar *, gint c) { return _mm_set1_epi16((short) c); }
+
+                static CORE_ALWAYS_INLINE glong match(const gbyte *p, Vec v) {
+                    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const Vec *) p), v));
+                }
+
+                static CORE_ALWAYS_INLINE glong match(const gchar *p, Vec v) {
+                    return _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((const Vec *) p), v));
+                }
+
+                static CORE_ALWAYS_INLINE Vec load(const void *p) { return _mm_loadu_si128((const Vec *) p); }
+
+                static CORE_ALWAYS_INLINE void store(void *p, Vec v) { _mm_storeu_si128((Vec *) p, v); }
+
+                static CORE_ALWAYS_INLINE glong mask(Vec v) { return _mm_movemask_epi8(v); }
+
+                static CORE_ALWAYS_INLINE Vec bitAnd(Vec a, Vec b) { return _mm_and_si128(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec bitOr(Vec a, Vec b) { return _mm_or_si128(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec bitXor(Vec a, Vec b) { return _mm_xor_si128(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec equal(const gbyte *, Vec a, Vec b) { return _mm_cmpeq_epi8(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec equal(const gchar *, Vec a, Vec b) { return _mm_cmpeq_epi16(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec zero() { return _mm_setzero_si128(); }
+
+                static CORE_ALWAYS_INLINE Vec subtract(const gbyte *, Vec a, Vec b) { return _mm_sub_epi8(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec subtract(const gchar *, Vec a, Vec b) { return _mm_sub_epi16(a, b); }
+
+                /**
+                 * Select the chars in range [lo, hi] (an ASCII range). The comparisons are
+                 * signed, so the chars greater than U+007F are never selected.
+                 */
+                static CORE_ALWAYS_INLINE Vec between(const gbyte *, Vec x, gint lo, gint hi) {
+                    return _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8((char) (lo - 1))),
+                                         _mm_cmpgt_epi8(_mm_set1_epi8((char) (hi + 1)), x));
+                }
+
+                static CORE_ALWAYS_INLINE Vec between(const gchar *, Vec x, gint lo, gint hi) {
+                    return _mm_and_si128(_mm_cmpgt_epi16(x, _mm_set1_epi16((short) (lo - 1))),
+                                         _mm_cmpgt_epi16(_mm_set1_epi16((short) (hi + 1)), x));
+                }
+
+                /**
+                 * Select the chars greater than U+007F.
+                 */
+                static CORE_ALWAYS_INLINE Vec nonAscii(const gbyte *, Vec x) {
+                    return _mm_cmpgt_epi8(_mm_setzero_si128(), x);
+                }
+
+                static CORE_ALWAYS_INLINE Vec nonAscii(const gchar *, Vec x) {
+                    return _mm_or_si128(_mm_cmpgt_epi16(_mm_setzero_si128(), x),
+                                        _mm_cmpgt_epi16(x, _mm_set1_epi16(0x7F)));
+                }
+
+                /**
+                 * Store the 16 given bytes (ASCII chars) as 16 chars.
+                 */
+                static CORE_ALWAYS_INLINE void inflate(gchar *dst, Vec x) {
+                    _mm_storeu_si128((Vec *) dst, _mm_unpacklo_epi8(x, _mm_setzero_si128()));
+                    _mm_storeu_si128((Vec *) (dst + 8), _mm_unpackhi_epi8(x, _mm_setzero_si128()));
+                }
+
+                /**
+                 * Store the 8 given chars (ASCII chars) as 8 bytes.
+                 */
+                static CORE_ALWAYS_INLINE void compress(gbyte *dst, Vec x) {
+                    _mm_storel_epi64((Vec *) dst, _mm_packus_epi16(x, x));
+                }
+            };
+
+#endif
+
+#if defined(CORE_XCOMPILER_AVX2)
+
+            /**
+             * The operations on 256-bit vectors (AVX2).
+             */
+            struct Vector256 {
+                CORE_ALIAS(Vec, __m256i);
+
+                static CORE_FAST gint SIZE = 32;
+
+                static CORE_ALWAYS_INLINE Vec broadcast(const gbyte *, gint c) { return _mm256_set1_epi8((char) c); }
+
+                static CORE_ALWAYS_INLINE Vec broadcast(const gchar *, gint c) { return _mm256_set1_epi16((short) c); }
+
+                static CORE_ALWAYS_INLINE glong match(const gbyte *p, Vec v) {
+                    return (glong) (unsigned) _mm256_movemask_epi8(
+                            _mm256_cmpeq_epi8(_mm256_loadu_si256((const Vec *) p), v));
+                }
+
+                static CORE_ALWAYS_INLINE glong match(const gchar *p, Vec v) {
+                    return (glong) (unsigned) _mm256_movemask_epi8(
+                            _mm256_cmpeq_epi16(_mm256_loadu_si256((const Vec *) p), v));
+                }
+
+                static CORE_ALWAYS_INLINE Vec load(const void *p) { return _mm256_loadu_si256((const Vec *) p); }
+
+                static CORE_ALWAYS_INLINE void store(void *p, Vec v) { _mm256_storeu_si256((Vec *) p, v); }
+
+                static CORE_ALWAYS_INLINE glong mask(Vec v) { return (glong) (unsigned) _mm256_movemask_epi8(v); }
+
+                static CORE_ALWAYS_INLINE Vec bitAnd(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec bitOr(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec bitXor(Vec a, Vec b) { return _mm256_xor_si256(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec equal(const gbyte *, Vec a, Vec b) { return _mm256_cmpeq_epi8(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec equal(const gchar *, Vec a, Vec b) { return _mm256_cmpeq_epi16(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec zero() { return _mm256_setzero_si256(); }
+
+                static CORE_ALWAYS_INLINE Vec subtract(const gbyte *, Vec a, Vec b) { return _mm256_sub_epi8(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec subtract(const gchar *, Vec a, Vec b) { return _mm256_sub_epi16(a, b); }
+
+                static CORE_ALWAYS_INLINE Vec between(const gbyte *, Vec x, gint lo, gint hi) {
+                    return _mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8((char) (lo - 1))),
+                                            _mm256_cmpgt_epi8(_mm256_set1_epi8((char) (hi + 1)), x));
+                }
+
+                static CORE_ALWAYS_INLINE Vec between(const gchar *, Vec x, gint lo, gint hi) {
+                    return _mm256_and_si256(_mm256_cmpgt_epi16(x, _mm256_set1_epi16((short) (lo - 1))),
+                                            _mm256_cmpgt_epi16(_mm256_set1_epi16((short) (hi + 1)), x));
+                }
+
+                static CORE_ALWAYS_INLINE Vec nonAscii(const gbyte *, Vec x) {
+                    return _mm256_cmpgt_epi8(_mm256_setzero_si256(), x);
+                }
+
+                static CORE_ALWAYS_INLINE Vec nonAscii(const gchar *, Vec x) {
+                    return _mm256_or_si256(_mm256_cmpgt_epi16(_mm256_setzero_si256(), x),
+                                           _mm256_cmpgt_epi16(x, _mm256_set1_epi16(0x7F)));
+                }
+
+                static CORE_ALWAYS_INLINE void inflate(gchar *dst, Vec x) {
+                    _mm256_storeu_si256((Vec *) dst, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(x)));
+                    _mm256_storeu_si256((Vec *) (dst + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(x, 1)));
+                }
+
+                static CORE_ALWAYS_INLINE void compress(gbyte *dst, Vec x) {
+                    _mm_storeu_si128((__m128i *) dst,
+                                     _mm_packus_epi16(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+                }
+            };
+
+#endif
+
+            /**
+             * Search forward the given char in blocks of vector size, starting at index i.
+             * On return, i is the index of first char that has not been checked.
+             */
+            template<class V, class T>
+            gint indexOfChar(const T *src, gint length, gint ch, gint &i) {
+                static CORE_FAST gint N = V::SIZE / (gint) sizeof(T);
+                typename V::Vec const v = V::broadcast(src, ch);
+                for (; i + N <= length; i += N) {
+                    glong const mask = V::match(src + i, v);
+                    if (mask != 0)
+                        return i + lowestBit(mask) / (gint) sizeof(T);
+                }
+                return -1;
+            }
+
+            /**
+             * Search backward the given char in blocks of vector size, in range [0, end).
+             * On return, end is the end of range that has not been checked.
+             */
+            template<class V, class T>
+            gint lastIndexOfChar(const T *src, gint ch, gint &end) {
+                static CORE_FAST gint N = V::SIZE / (gint) sizeof(T);
+                typename V::Vec const v = V::broadcast(src, ch);
+                for (; end >= N; end -= N) {
+                    glong const mask = V::match(src + (end - N), v);
+                    if (mask != 0)
+                        return end - N + highestBit(mask) / (gint) sizeof(T);
+                }
+                return -1;
+            }
+
+            /**
+             * Count the given char in blocks of vector size, starting at index i. Each lane
+             * counts the matches of its position (an equal lane is -1, so it is subtracted),
+             * and the lanes are added every 255 blocks, before a lane of byte overflows.
+             * On return, i is the index of first char that has not been checked.
+             */
+            template<class V, class T>
+            gint countChar(const T *src, gint length, gint ch, gint &i) {
+                static CORE_FAST gint N = V::SIZE / (gint) sizeof(T);
+                typename V::Vec const v = V::broadcast(src, ch);
+                gint count = 0;
+                while (i + N <= length) {
+                    typename V::Vec counts = V::zero();
+                    for (gint k = 0; k < 255 && i + N <= length; ++k, i += N)
+                        counts = V::subtract(src, counts, V::equal(src, V::load(src + i), v));
+                    T lanes[N];
+                    V::store(lanes, counts);
+                    for (gint k = 0; k < N; ++k)
+                        count += U(lanes[k]);
+                }
+                return count;
+            }
+
+            template<class A, class B>
+            gbool regionMatches(const A *a, gint aIndex, const B *b, gint length) {
+                for (gint j = 0; j < length; ++j) {
+                    if (U(a[aIndex + j]) != U(b[j]))
+                        return false;
+                }
+                return true;
+            }
+
+            /**
+             * Search forward the given string (of two chars or more) in blocks of vector size,
+             * starting at index i. Only the positions where the first and the last chars of
+             * string match are verified.
+             *
+             * @param limit the last index where the string can start
+             */
+            template<class V, class A, class B>
+            gint indexOfString(const A *src, gint limit, const B *str, gint strLength, gint &i) {
+                static CORE_FAST gint N = V::SIZE / (gint) sizeof(A);
+                typename V::Vec const first = V::broadcast(src, U(str[0]));
+                typename V::Vec const last = V::broadcast(src, U(str[strLength - 1]));
+                for (; i + N - 1 <= limit; i += N) {
+                    glong mask = V::match(src + i, first) & V::match(src + i + strLength - 1, last);
+                    while (mask != 0) {
+                        gint const k = lowestBit(mask) / (gint) sizeof(A);
+                        if (regionMatches(src, i + k + 1, str + 1, strLength - 2))
+                            return i + k;
+                        mask = clearChar<A>(mask, k);
+                    }
+                }
+                return -1;
+            }
+
+            /**
+             * Search backward the given string (of two chars or more) in blocks of vector size,
+             * in range [0, end) of start indexes.
+             */
+            template<class V, class A, class B>
+            gint lastIndexOfString(const A *src, const B *str, gint strLength, gint &end) {
+                static CORE_FAST gint N = V::SIZE / (gint) sizeof(A);
+                typename V::Vec const first = V::broadcast(src, U(str[0]));
+                typename V::Vec const last = V::broadcast(src, U(str[strLength - 1]));
+                for (; end >= N; end -= N) {
+                    gint const base = end - N;
+                    glong mask = V::match(src + base, first) & V::match(src + base + strLength - 1, last);
+                    while (mask != 0) {
+                        gint const k = highestBit(mask) / (gint) sizeof(A);
+                        if (regionMatches(src, base + k + 1, str + 1, strLength - 2))
+                            return base + k;
+                        mask = clearChar<A>(mask, k);
+                    }
+                }
+                return -1;
+            }
+
+            template<class T>
+            gint indexOfChar(const T *src, gint length, gint ch, gint fromIndex) {
+                gint i = fromIndex;
+                gint index = -1;
+#if defined(CORE_XCOMPILER_AVX2)
+                if ((index = indexOfChar<Vector256>(src, length, ch, i)) >= 0)
+                    return index;
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                if ((index = indexOfChar<Vector128>(src, length, ch, i)) >= 0)
+                    return index;
+#endif
+                for (; i < length; ++i) {
+                    if (U(src[i]) == ch)
+                        return i;
+                }
+                return index;
+            }
+
+            template<class T>
+            gint lastIndexOfChar(const T *src, gint ch, gint fromIndex) {
+                gint end = fromIndex + 1;
+                gint index = -1;
+#if defined(CORE_XCOMPILER_AVX2)
+                if ((index = lastIndexOfChar<Vector256>(src, ch, end)) >= 0)
+                    return index;
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                if ((index = lastIndexOfChar<Vector128>(src, ch, end)) >= 0)
+                    return index;
+#endif
+                for (gint i = end - 1; i >= 0; --i) {
+                    if (U(src[i]) == ch)
+                        return i;
+                }
+                return index;
+            }
+
+            template<class T>
+            gint countChar(const T *src, gint length, gint ch) {
+                gint i = 0;
+                gint count = 0;
+#if defined(CORE_XCOMPILER_AVX2)
+                count += countChar<Vector256>(src, length, ch, i);
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                count += countChar<Vector128>(src, length, ch, i);
+#endif
+                for (; i < length; ++i) {
+                    if (U(src[i]) == ch)
+                        count += 1;
+                }
+                return count;
+            }
+
+            template<class A, class B>
+            gint mismatchOf(const A *a, const B *b, gint length) {
+                for (gint i = 0; i < length; ++i) {
+                    if (U(a[i]) != U(b[i]))
+                        return i;
+                }
+                return -1;
+            }
+
+            template<class A, class B>
+            gint indexOfString(const A *src, gint length, const B *str, gint strLength, gint fromIndex) {
+                if (strLength == 1)
+                    return indexOfChar(src, length, U(str[0]), fromIndex);
+                gint const first = U(str[0]);
+                gint const limit = length - strLength;
+                gint i = fromIndex;
+                gint index = -1;
+#if defined(CORE_XCOMPILER_AVX2)
+                if ((index = indexOfString<Vector256>(src, limit, str, strLength, i)) >= 0)
+                    return index;
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                if ((index = indexOfString<Vector128>(src, limit, str, strLength, i)) >= 0)
+                    return index;
+#endif
+                for (; i <= limit; ++i) {
+                    if (U(src[i]) != first)
+                        continue;
+                    if (regionMatches(src, i + 1, str + 1, strLength - 1))
+                        return i;
+                }
+                return index;
+            }
+
+            template<class A, class B>
+            gint lastIndexOfString(const A *src, const B *str, gint strLength, gint fromIndex) {
+                if (strLength == 1)
+                    return lastIndexOfChar(src, U(str[0]), fromIndex);
+                gint const first = U(str[0]);
+                gint end = fromIndex + 1;
+                gint index = -1;
+#if defined(CORE_XCOMPILER_AVX2)
+                if ((index = lastIndexOfString<Vector256>(src, str, strLength, end)) >= 0)
+                    return index;
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                if ((index = lastIndexOfString<Vector128>(src, str, strLength, end)) >= 0)
+                    return index;
+#endif
+                for (gint i = end - 1; i >= 0; --i) {
+                    if (U(src[i]) != first)
+                        continue;
+                    if (regionMatches(src, i + 1, str + 1, strLength - 1))
+                        return i;
+                }
+                return index;
+            }
+
+            /**
+             * The ASCII letters differ from their other case only by this bit.
+             */
+            CORE_FAST gint CASE_BIT = 0x20;
+
+            /**
+             * Return the first letter of the ASCII letters changed by the conversion
+             * to upper case (if upper is true) or to lower case (otherwise).
+             */
+            CORE_FAST gint firstLetter(gbool upper) { return upper ? 'a' : 'A'; }
+
+            CORE_FAST gint toLowerAscii(gint ch) { return (GENERIC_UINT32) (ch - 'A') < 26U ? ch | CASE_BIT : ch; }
+
+            /**
+             * Search forward the first non-ASCII char in blocks of vector size, starting
+             * at index i.
+             */
+            template<class V, class T>
+            gint indexOfNonAscii(const T *src, gint length, gint &i) {
+                static CORE_FAST gint N = V::SIZE / (gint) sizeof(T);
+                for (; i + N <= length; i += N) {
+                    glong const mask = V::mask(V::nonAscii(src, V::load(src + i)));
+                    if (mask != 0)
+                        return i + lowestBit(mask) / (gint) sizeof(T);
+                }
+                return -1;
+            }
+
+            /**
+             * Search forward the first non-ASCII char or ASCII letter in range
+             * [first, first + 26), in blocks of vector size, starting at index i.
+             */
+            template<class V, class T>
+            gint indexOfCaseChange(const T *src, gint length, gint first, gint &i) {
+                static CORE_FAST gint N = V::SIZE / (gint) sizeof(T);
+                for (; i + N <= length; i += N) {
+                    typename V::Vec const x = V::load(src + i);
+                    glong const mask = V::mask(V::bitOr(V::nonAscii(src, x), V::between(src, x, first, first + 25)));
+                    if (mask != 0)
+                        return i + lowestBit(mask) / (gint) sizeof(T);
+                }
+                return -1;
+            }
+
+            /**
+             * Flip the case of ASCII letters in range [first, first + 26), in blocks
+             * of vector size, starting at index i.
+             */
+            template<class V, class T>
+            void convertCase(const T *src, T *dst, gint count, gint first, gint &i) {
+                static CORE_FAST gint N = V::SIZE / (gint) sizeof(T);
+                typename V::Vec const bit = V::broadcast(src, CASE_BIT);
+                for (; i + N <= count; i += N) {
+                    typename V::Vec const x = V::load(src + i);
+                    V::store(dst + i, V::bitXor(x, V::bitAnd(V::between(src, x, first, first + 25), bit)));
+                }
+            }
+
+            /**
+             * Search forward the first mismatch char ignoring the case of ASCII letters,
+             * in blocks of vector size, starting at index i.
+             */
+            template<class V, class T>
+            gint mismatchIgnoreCase(const T *a, const T *b, gint length, gint &i) {
+                static CORE_FAST gint N = V::SIZE / (gint) sizeof(T);
+                static CORE_FAST glong ALL = (1LL << V::SIZE) - 1;
+                typename V::Vec const bit = V::broadcast(a, CASE_BIT);
+                for (; i + N <= length; i += N) {
+                    typename V::Vec x = V::load(a + i);
+                    typename V::Vec y = V::load(b + i);
+                    x = V::bitOr(x, V::bitAnd(V::between(a, x, 'A', 'Z'), bit));
+                    y = V::bitOr(y, V::bitAnd(V::between(b, y, 'A', 'Z'), bit));
+                    glong const mask = V::mask(V::equal(a, x, y)) ^ ALL;
+                    if (mask != 0)
+                        return i + lowestBit(mask) / (gint) sizeof(T);
+                }
+                return -1;
+            }
+
+            template<class T>
+            gint indexOfNonAsciiOf(const T *src, gint length) {
+                gint i = 0;
+                gint index = -1;
+#if defined(CORE_XCOMPILER_AVX2)
+                if ((index = indexOfNonAscii<Vector256>(src, length, i)) >= 0)
+                    return index;
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                if ((index = indexOfNonAscii<Vector128>(src, length, i)) >= 0)
+                    return index;
+#endif
+                for (; i < length; ++i) {
+                    if (U(src[i]) > 0x7F)
+                        return i;
+                }
+                return index;
+            }
+
+            template<class T>
+            gint indexOfCaseChangeOf(const T *src, gint length, gint first) {
+                gint i = 0;
+                gint index = -1;
+#if defined(CORE_XCOMPILER_AVX2)
+                if ((index = indexOfCaseChange<Vector256>(src, length, first, i)) >= 0)
+                    return index;
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                if ((index = indexOfCaseChange<Vector128>(src, length, first, i)) >= 0)
+                    return index;
+#endif
+                for (; i < length; ++i) {
+                    gint const ch = U(src[i]);
+                    if (ch > 0x7F || (GENERIC_UINT32) (ch - first) < 26U)
+                        return i;
+                }
+                return index;
+            }
+
+            template<class T>
+            void convertCaseOf(const T *src, T *dst, gint count, gint first) {
+                gint i = 0;
+#if defined(CORE_XCOMPILER_AVX2)
+                convertCase<Vector256>(src, dst, count, first, i);
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                convertCase<Vector128>(src, dst, count, first, i);
+#endif
+                for (; i < count; ++i) {
+                    gint const ch = U(src[i]);
+                    dst[i] = (T) ((GENERIC_UINT32) (ch - first) < 26U ? ch ^ CASE_BIT : ch);
+                }
+            }
+
+            template<class A, class B>
+            gint mismatchIgnoreCaseOf(const A *a, const B *b, gint length) {
+                for (gint i = 0; i < length; ++i) {
+                    if (toLowerAscii(U(a[i])) != toLowerAscii(U(b[i])))
+                        return i;
+                }
+                return -1;
+            }
+
+            template<class T>
+            gint mismatchIgnoreCaseOf(const T *a, const T *b, gint length) {
+                gint i = 0;
+                gint index = -1;
+#if defined(CORE_XCOMPILER_AVX2)
+                if ((index = mismatchIgnoreCase<Vector256>(a, b, length, i)) >= 0)
+                    return index;
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                if ((index = mismatchIgnoreCase<Vector128>(a, b, length, i)) >= 0)
+                    return index;
+#endif
+                for (; i < length; ++i) {
+                    if (toLowerAscii(U(a[i])) != toLowerAscii(U(b[i])))
+                        return i;
+                }
+                return index;
+            }
+
+            CORE_ALIAS(UINT32, GENERIC_UINT32);
+            CORE_ALIAS(UINT64, GENERIC_UINT64);
+
+            /**
+             * The powers of 31 (modulo 2^32) used by the polynomial hash.
+             */
+            CORE_FAST UINT32 P1 = 31U;
+            CORE_FAST UINT32 P2 = P1 * P1;
+            CORE_FAST UINT32 P3 = P2 * P1;
+            CORE_FAST UINT32 P4 = P3 * P1;
+            CORE_FAST UINT32 P5 = P4 * P1;
+            CORE_FAST UINT32 P6 = P5 * P1;
+            CORE_FAST UINT32 P7 = P6 * P1;
+            CORE_FAST UINT32 P8 = P7 * P1;
+
+            /**
+             * Compute s[0]*31^(n-1) + s[1]*31^(n-2) + ... + s[n-1] on 8 chars per
+             * step (h = h*31^8 + s[i]*31^7 + ... + s[i+7]). The products of each step
+             * are independent, so they are computed in parallel (or with vector
+             * instructions) instead of one long chain of multiplications.
+             */
+            template<class T>
+            gint hashOf(const T *src, gint length) {
+                UINT32 h = 0;
+                gint i = 0;
+                for (; i + 8 <= length; i += 8) {
+                    h = h * P8
+                        + (UINT32) U(src[i + 0]) * P7 + (UINT32) U(src[i + 1]) * P6
+                        + (UINT32) U(src[i + 2]) * P5 + (UINT32) U(src[i + 3]) * P4
+                        + (UINT32) U(src[i + 4]) * P3 + (UINT32) U(src[i + 5]) * P2
+                        + (UINT32) U(src[i + 6]) * P1 + (UINT32) U(src[i + 7]);
+                }
+                for (; i < length; ++i)
+                    h = h * P1 + (UINT32) U(src[i]);
+                return (gint) h;
+            }
+
+            /**
+             * The primes of 64-bit xxHash algorithm
+             */
+            CORE_FAST UINT64 PRIME1 = 0x9E3779B185EBCA87ULL;
+            CORE_FAST UINT64 PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+            CORE_FAST UINT64 PRIME3 = 0x165667B19E3779F9ULL;
+            CORE_FAST UINT64 PRIME4 = 0x85EBCA77C2B2AE63ULL;
+            CORE_FAST UINT64 PRIME5 = 0x27D4EB2F165667C5ULL;
+
+            CORE_ALWAYS_INLINE UINT64 rotateLeft(UINT64 x, gint n) { return (x << n) | (x >> (64 - n)); }
+
+            CORE_ALWAYS_INLINE UINT64 read64(PCBYTE p) {
+                // little-endian read, the compiler use one load for this pattern
+                return ((UINT64) (p[0] & 0xFF)) | ((UINT64) (p[1] & 0xFF) << 8)
+                       | ((UINT64) (p[2] & 0xFF) << 16) | ((UINT64) (p[3] & 0xFF) << 24)
+                       | ((UINT64) (p[4] & 0xFF) << 32) | ((UINT64) (p[5] & 0xFF) << 40)
+                       | ((UINT64) (p[6] & 0xFF) << 48) | ((UINT64) (p[7] & 0xFF) << 56);
+            }
+
+            CORE_ALWAYS_INLINE UINT64 read32(PCBYTE p) {
+                return ((UINT64) (p[0] & 0xFF)) | ((UINT64) (p[1] & 0xFF) << 8)
+                       | ((UINT64) (p[2] & 0xFF) << 16) | ((UINT64) (p[3] & 0xFF) << 24);
+            }
+
+            CORE_ALWAYS_INLINE UINT64 round(UINT64 acc, UINT64 input) {
+                return rotateLeft(acc + input * PRIME2, 31) * PRIME1;
+            }
+
+            CORE_ALWAYS_INLINE UINT64 merge(UINT64 acc, UINT64 value) {
+                return (acc ^ round(0, value)) * PRIME1 + PRIME4;
+            }
+
+            /**
+             * The 64-bit xxHash of the given bytes.
+             */
+            UINT64 hash64Of(PCBYTE p, glong length, UINT64 seed) {
+                PCBYTE const end = p + length;
+                UINT64 h = 0;
+                if (length >= 32) {
+                    UINT64 v1 = seed + PRIME1 + PRIME2;
+                    UINT64 v2 = seed + PRIME2;
+                    UINT64 v3 = seed;
+                    UINT64 v4 = seed - PRIME1;
+                    for (; p + 32 <= end; p += 32) {
+                        v1 = round(v1, read64(p));
+                        v2 = round(v2, read64(p + 8));
+                        v3 = round(v3, read64(p + 16));
+                        v4 = round(v4, read64(p + 24));
+                    }
+                    h = rotateLeft(v1, 1) + rotateLeft(v2, 7) + rotateLeft(v3, 12) + rotateLeft(v4, 18);
+                    h = merge(h, v1);
+                    h = merge(h, v2);
+                    h = merge(h, v3);
+                    h = merge(h, v4);
+                } else {
+                    h = seed + PRIME5;
+                }
+                h += (UINT64) length;
+                for (; p + 8 <= end; p += 8)
+                    h = rotateLeft(h ^ round(0, read64(p)), 27) * PRIME1 + PRIME4;
+                if (p + 4 <= end) {
+                    h = rotateLeft(h ^ (read32(p) * PRIME1), 23) * PRIME2 + PRIME3;
+                    p += 4;
+                }
+                for (; p < end; ++p)
+                    h = rotateLeft(h ^ ((UINT64) (*p & 0xFF) * PRIME5), 11) * PRIME1;
+                // final avalanche
+                h ^= h >> 33;
+                h *= PRIME2;
+                h ^= h >> 29;
+                h *= PRIME3;
+                h ^= h >> 32;
+                return h;
+            }
+
+            /**
+             * Skip the blocks of ASCII chars (of vector size), starting at index i.
+             */
+            template<class V, class T>
+            void skipAscii(const T *src, glong count, glong &i) {
+                static CORE_FAST gint N = V::SIZE / (gint) sizeof(T);
+                for (; i + N <= count; i += N) {
+                    if (V::mask(V::nonAscii(src, V::load(src + i))) != 0)
+                        return;
+                }
+            }
+
+            /**
+             * Count the non-ASCII bytes in blocks of vector size, starting at index i.
+             */
+            template<class V>
+            glong countNonAscii(const gbyte *src, glong count, glong &i) {
+                glong n = 0;
+                for (; i + V::SIZE <= count; i += V::SIZE)
+                    n += bitCount(V::mask(V::nonAscii(src, V::load(src + i))));
+                return n;
+            }
+
+            /**
+             * Copy the blocks of ASCII chars (of vector size) from index i of source to index j
+             * of destination. The copy stops at the first block that contains a non-ASCII char.
+             */
+            template<class V>
+            void copyAscii(const gbyte *src, glong count, glong &i, gbyte *dst, glong &j) {
+                for (; i + V::SIZE <= count; i += V::SIZE, j += V::SIZE) {
+                    typename V::Vec const x = V::load(src + i);
+                    if (V::mask(V::nonAscii(src, x)) != 0)
+                        return;
+                    V::store(dst + j, x);
+                }
+            }
+
+            template<class V>
+            void copyAscii(const gbyte *src, glong count, glong &i, gchar *dst, glong &j) {
+                for (; i + V::SIZE <= count; i += V::SIZE, j += V::SIZE) {
+                    typename V::Vec const x = V::load(src + i);
+                    if (V::mask(V::nonAscii(src, x)) != 0)
+                        return;
+                    V::inflate(dst + j, x);
+                }
+            }
+
+            template<class V>
+            void copyAscii(const gchar *src, glong count, glong &i, gbyte *dst, glong &j) {
+                static CORE_FAST gint N = V::SIZE / 2;
+                for (; i + N <= count; i += N, j += N) {
+                    typename V::Vec const x = V::load(src + i);
+                    if (V::mask(V::nonAscii(src, x)) != 0)
+                        return;
+                    V::compress(dst + j, x);
+                }
+            }
+
+            template<class T>
+            CORE_ALWAYS_INLINE void skipAsciiOf(const T *src, glong count, glong &i) {
+#if defined(CORE_XCOMPILER_AVX2)
+                skipAscii<Vector256>(src, count, i);
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                skipAscii<Vector128>(src, count, i);
+#endif
+                while (i < count && U(src[i]) <= 0x7F)
+                    i += 1;
+            }
+
+            template<class S, class D>
+            CORE_ALWAYS_INLINE void copyAsciiOf(const S *src, glong count, glong &i, D *dst, glong &j) {
+#if defined(CORE_XCOMPILER_AVX2)
+                copyAscii<Vector256>(src, count, i, dst, j);
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                copyAscii<Vector128>(src, count, i, dst, j);
+#endif
+                for (; i < count && U(src[i]) <= 0x7F; ++i, ++j)
+                    dst[j] = (D) U(src[i]);
+            }
+
+            /**
+             * The properties of the UTF-8 sequences by first byte: the length of sequence
+             * (bits 0-7, zero for the bytes that never start a sequence), and the range of
+             * the second byte (bits 8-15 and 16-23). The ranges of second byte exclude the
+             * overlong sequences, the surrogates and the code points above U+10FFFF.
+             */
+            CORE_FAST UINT32 UTF8_INFO[256] = {
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+                    0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+                    0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+                    0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+                    0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+                    0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+                    0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+                    0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+                    0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+                    0x000000, 0x000000, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002,
+                    0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002,
+                    0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002,
+                    0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002, 0xBF8002,
+                    0xBFA003, 0xBF8003, 0xBF8003, 0xBF8003, 0xBF8003, 0xBF8003, 0xBF8003, 0xBF8003,
+                    0xBF8003, 0xBF8003, 0xBF8003, 0xBF8003, 0xBF8003, 0x9F8003, 0xBF8003, 0xBF8003,
+                    0xBF9004, 0xBF8004, 0xBF8004, 0xBF8004, 0x8F8004, 0x000000, 0x000000, 0x000000,
+                    0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000,
+            };
+
+            /**
+             * Decode the UTF-8 sequence at index i (its first byte is not ASCII). Return the
+             * number of bytes of this sequence and set the decoded code point. The malformed
+             * sequences are decoded as '?' (only their longest valid prefix is consumed).
+             */
+            CORE_ALWAYS_INLINE gint decodeSequence(const gbyte *src, glong count, glong i, gint &codePoint) {
+                UINT32 const info = UTF8_INFO[U(src[i])];
+                gint const n = (gint) (info & 0xFF);
+                codePoint = '?';
+                if (n < 2 || i + 1 >= count)
+                    return 1;
+                gint const b2 = U(src[i + 1]);
+                if (b2 < (gint) ((info >> 8) & 0xFF) || b2 > (gint) ((info >> 16) & 0xFF))
+                    return 1;
+                gint ch = ((U(src[i]) & (0x7F >> n)) << 6) | (b2 & 0x3F);
+                for (gint k = 2; k < n; ++k) {
+                    if (i + k >= count || (U(src[i + k]) & 0xC0) != 0x80)
+                        return k;
+                    ch = (ch << 6) | (U(src[i + k]) & 0x3F);
+                }
+                codePoint = ch;
+                return n;
+            }
+
+            glong decodedLengthOf(const gbyte *src, glong count, gbool &latin1) {
+                glong length = 0;
+                glong i = 0;
+                while (i < count) {
+                    glong const start = i;
+                    skipAsciiOf(src, count, i);
+                    length += i - start;
+                    if (i >= count)
+                        break;
+                    gint codePoint = 0;
+                    i += decodeSequence(src, count, i, codePoint);
+                    if (codePoint > 0xFF)
+                        latin1 = false;
+                    length += codePoint > 0xFFFF ? 2 : 1;
+                }
+                return length;
+            }
+
+            CORE_ALWAYS_INLINE void putCodePoint(gbyte *dst, glong &j, gint codePoint) {
+                dst[j++] = (gbyte) codePoint;
+            }
+
+            CORE_ALWAYS_INLINE void putCodePoint(gchar *dst, glong &j, gint codePoint) {
+                if (codePoint > 0xFFFF) {
+                    // surrogate pair
+                    dst[j++] = (gchar) (0xD800 + ((codePoint - 0x10000) >> 10));
+                    dst[j++] = (gchar) (0xDC00 + (codePoint & 0x3FF));
+                } else
+                    dst[j++] = (gchar) codePoint;
+            }
+
+            template<class T>
+            void decodeUtf8Of(const gbyte *src, glong count, T *dst) {
+                glong i = 0;
+                glong j = 0;
+                while (i < count) {
+                    copyAsciiOf(src, count, i, dst, j);
+                    if (i >= count)
+                        break;
+                    gint codePoint = 0;
+                    i += decodeSequence(src, count, i, codePoint);
+                    putCodePoint(dst, j, codePoint);
+                }
+            }
+
+            CORE_ALWAYS_INLINE gbool isHighSurrogate(gchar ch) { return (ch & 0xFC00) == 0xD800; }
+
+            CORE_ALWAYS_INLINE gbool isLowSurrogate(gchar ch) { return (ch & 0xFC00) == 0xDC00; }
+
+            glong encodedLengthOf(const gbyte *src, glong count) {
+                glong i = 0;
+                glong n = 0;
+#if defined(CORE_XCOMPILER_AVX2)
+                n += countNonAscii<Vector256>(src, count, i);
+#endif
+#if defined(CORE_XCOMPILER_SSE2)
+                n += countNonAscii<Vector128>(src, count, i);
+#endif
+                for (; i < count; ++i) {
+                    if (U(src[i]) > 0x7F)
+                        n += 1;
+                }
+                // the latin1 chars above U+007F are encoded with 2 bytes
+                return count + n;
+            }
+
+            glong encodedLengthOf(const gchar *src, glong count) {
+                glong length = 0;
+                glong i = 0;
+                while (i < count) {
+                    glong const start = i;
+                    skipAsciiOf(src, count, i);
+                    length += i - start;
+                    if (i >= count)
+                        break;
+                    gchar const ch = src[i++];
+                    if (ch < 0x800)
+                        length += 2;
+                    else if (isHighSurrogate(ch) && i < count && isLowSurrogate(src[i])) {
+                        length += 4;
+                        i += 1;
+                    } else if (isHighSurrogate(ch) || isLowSurrogate(ch))
+                        // the lone surrogates are encoded as '?'
+                        length += 1;
+                    else
+                        length += 3;
+                }
+                return length;
+            }
+
+            void encodeUtf8Of(const gbyte *src, glong count, gbyte *dst) {
+                glong i = 0;
+                glong j = 0;
+                while (i < count) {
+                    copyAsciiOf(src, count, i, dst, j);
+                    if (i >= count)
+                        break;
+                    gint const b = U(src[i++]);
+                    dst[j++] = (gbyte) (0xC0 | (b >> 6));
+                    dst[j++] = (gbyte) (0x80 | (b & 0x3F));
+                }
+            }
+
+            void encodeUtf8Of(const gchar *src, glong count, gbyte *dst) {
+                glong i = 0;
+                glong j = 0;
+                while (i < count) {
+                    copyAsciiOf(src, count, i, dst, j);
+                    if (i >= count)
+                        break;
+                    gint ch = src[i++];
+                    if (ch < 0x800) {
+                        dst[j++] = (gbyte) (0xC0 | (ch >> 6));
+                        dst[j++] = (gbyte) (0x80 | (ch & 0x3F));
+                    } else if (isHighSurrogate((gchar) ch) && i < count && isLowSurrogate(src[i])) {
+                        ch = ((ch - 0xD800) << 10) + (src[i++] - 0xDC00) + 0x10000;
+                        dst[j++] = (gbyte) (0xF0 | (ch >> 18));
+                        dst[j++] = (gbyte) (0x80 | ((ch >> 12) & 0x3F));
+                        dst[j++] = (gbyte) (0x80 | ((ch >> 6) & 0x3F));
+                        dst[j++] = (gbyte) (0x80 | (ch & 0x3F));
+                    } else if (isHighSurrogate((gchar) ch) || isLowSurrogate((gchar) ch)) {
+                        dst[j++] = '?';
+                    } else {
+                        dst[j++] = (gbyte) (0xE0 | (ch >> 12));
+                        dst[j++] = (gbyte) (0x80 | ((ch >> 6) & 0x3F));
+                        dst[j++] = (gbyte) (0x80 | (ch & 0x3F));
+                    }
+                }
+            }
+        }
+
+        gint StringCoding::compress(glong src, glong dst, gint count) {
+            PCCHAR s = (PCCHAR) src;
+            PBYTE d = (PBYTE) dst;
+            for (gint i = 0; i < count; ++i) {
+                gchar const ch = s[i];
+                if (!canEncode(ch))
+                    return i;
+                d[i] = (gbyte) ch;
+            }
+            return count;
+        }
+
+        void StringCoding::inflate(glong src, glong dst, gint count) {
+            PCBYTE s = (PCBYTE) src;
+            PCHAR d = (PCHAR) dst;
+            // from the end, to support the inflation of storage in place
+            for (gint i = count - 1; i >= 0; --i) {
+                d[i] = (gchar) U(s[i]);
+            }
+        }
+
+        void StringCoding::copy(glong src, gbyte srcCoder, gint srcIndex, glong dst, gbyte dstCoder, gint dstIndex,
+                                gint count) {
+            if (count <= 0 || src == 0 || dst == 0)
+                return;
+            if (srcCoder == dstCoder) {
+                glong const shift = srcCoder;
+                PCBYTE s = (PCBYTE) (src + ((glong) srcIndex << shift));
+                PBYTE d = (PBYTE) (dst + ((glong) dstIndex << shift));
+                glong const n = (glong) count << shift;
+                if (d == s)
+                    return;
+                if (d < s || d >= s + n)
+                    for (glong i = 0; i < n; ++i) d[i] = s[i];
+                else
+                    for (glong i = n - 1; i >= 0; --i) d[i] = s[i];
+            } else if (srcCoder == LATIN1) {
+                inflate(src + srcIndex, dst + ((glong) dstIndex << 1), count);
+            } else {
+                compress(src + ((glong) srcIndex << 1), dst + dstIndex, count);
+            }
+        }
+
+        gint StringCoding::indexOfNonLatin1(glong src, gint count) {
+            PCCHAR s = (PCCHAR) src;
+            for (gint i = 0; i < count; ++i) {
+                if (!canEncode(s[i]))
+                    return i;
+            }
+            return -1;
+        }
+
+        gint StringCoding::indexOf(glong src, gbyte coder, gint length, gint ch, gint fromIndex) {
+            if (fromIndex < 0)
+                fromIndex = 0;
+            if (fromIndex >= length)
+                return -1;
+            if (coder == LATIN1)
+                return canEncode(ch) ? indexOfChar((PCBYTE) src, length, ch, fromIndex) : -1;
+            if (ch > 0xFFFF) {
+                if (ch > 0x10FFFF)
+                    return -1;
+                // supplementary character: search the surrogate pair
+                gchar const pair[2] = {(gchar) ((ch >> 10) + (0xD800 - (0x010000 >> 10))),
+                                       (gchar) ((ch & 0x3FF) + 0xDC00)};
+                return fromIndex <= length - 2 ? indexOfString((PCCHAR) src, length, pair, 2, fromIndex) : -1;
+            }
+            return ch < 0 ? -1 : indexOfChar((PCCHAR) src, length, ch, fromIndex);
+        }
+
+        gint StringCoding::lastIndexOf(glong src, gbyte coder, gint length, gint ch, gint fromIndex) {
+            if (fromIndex >= length)
+                fromIndex = length - 1;
+            if (fromIndex < 0)
+                return -1;
+            if (coder == LATIN1)
+                return canEncode(ch) ? lastIndexOfChar((PCBYTE) src, ch, fromIndex) : -1;
+            if (ch > 0xFFFF) {
+                if (ch > 0x10FFFF)
+                    return -1;
+                gchar const pair[2] = {(gchar) ((ch >> 10) + (0xD800 - (0x010000 >> 10))),
+                                       (gchar) ((ch & 0x3FF) + 0xDC00)};
+                if (fromIndex == length - 1)
+                    fromIndex -= 1;
+                return fromIndex >= 0 ? lastIndexOfString((PCCHAR) src, pair, 2, fromIndex) : -1;
+            }
+            return ch < 0 ? -1 : lastIndexOfChar((PCCHAR) src, ch, fromIndex);
+        }
+
+        gint StringCoding::count(glong src, gbyte coder, gint length, gint ch) {
+            if (length <= 0 || ch < 0 || ch > 0xFFFF)
+                return 0;
+            if (coder == LATIN1)
+                return canEncode(ch) ? countChar((PCBYTE) src, length, ch) : 0;
+            return countChar((PCCHAR) src, length, ch);
+        }
+
+        gint StringCoding::indexOf(glong src, gbyte coder, gint length,
+                                   glong str, gbyte strCoder, gint strLength, gint fromIndex) {
+            if (fromIndex < 0)
+                fromIndex = 0;
+            if (strLength == 0)
+                return fromIndex <= length ? fromIndex : -1;
+            if (fromIndex > length - strLength)
+                return -1;
+            if (coder == LATIN1) {
+                // a UTF16 string always contains at least one char that is not encodable
+                return strCoder == LATIN1 ? indexOfString((PCBYTE) src, length, (PCBYTE) str, strLength, fromIndex)
+                                          : -1;
+            }
+            return strCoder == LATIN1 ? indexOfString((PCCHAR) src, length, (PCBYTE) str, strLength, fromIndex)
+                                      : indexOfString((PCCHAR) src, length, (PCCHAR) str, strLength, fromIndex);
+        }
+
+        gint StringCoding::lastIndexOf(glong src, gbyte coder, gint length,
+                                       glong str, gbyte strCoder, gint strLength, gint fromIndex) {
+            if (fromIndex > length - strLength)
+                fromIndex = length - strLength;
+            if (fromIndex < 0)
+                return -1;
+            if (strLength == 0)
+                return fromIndex;
+            if (coder == LATIN1) {
+                return strCoder == LATIN1 ? lastIndexOfString((PCBYTE) src, (PCBYTE) str, strLength, fromIndex) : -1;
+            }
+            return strCoder == LATIN1 ? lastIndexOfString((PCCHAR) src, (PCBYTE) str, strLength, fromIndex)
+                                      : lastIndexOfString((PCCHAR) src, (PCCHAR) str, strLength, fromIndex);
+        }
+
+        gint StringCoding::mismatch(glong a, gbyte aCoder, glong b, gbyte bCoder, gint length) {
+            if (length <= 0)
+                return -1;
+            if (aCoder == LATIN1)
+                return bCoder == LATIN1 ? mismatchOf((PCBYTE) a, (PCBYTE) b, length)
+                                        : mismatchOf((PCBYTE) a, (PCCHAR) b, length);
+            return bCoder == LATIN1 ? mismatchOf((PCCHAR) a, (PCBYTE) b, length)
+                                    : mismatchOf((PCCHAR) a, (PCCHAR) b, length);
+        }
+
+        gint StringCoding::indexOfNonAscii(glong src, gbyte coder, gint length) {
+            if (length <= 0)
+                return -1;
+            return coder == LATIN1 ? indexOfNonAsciiOf((PCBYTE) src, length) : indexOfNonAsciiOf((PCCHAR) src, length);
+        }
+
+        gint StringCoding::indexOfCaseChange(glong src, gbyte coder, gint length, gbool upper) {
+            if (length <= 0)
+                return -1;
+            gint const first = firstLetter(upper);
+            return coder == LATIN1 ? indexOfCaseChangeOf((PCBYTE) src, length, first)
+                                   : indexOfCaseChangeOf((PCCHAR) src, length, first);
+        }
+
+        void StringCoding::convertCase(glong src, gbyte srcCoder, glong dst, gbyte dstCoder, gint count, gbool upper) {
+            if (count <= 0)
+                return;
+            if (srcCoder != dstCoder) {
+                // the chars are copied first, then converted in place
+                copy(src, srcCoder, 0, dst, dstCoder, 0, count);
+                src = dst;
+            }
+            gint const first = firstLetter(upper);
+            if (dstCoder == LATIN1)
+                convertCaseOf((PCBYTE) src, (PBYTE) dst, count, first);
+            else
+                convertCaseOf((PCCHAR) src, (PCHAR) dst, count, first);
+        }
+
+        gint StringCoding::mismatchIgnoreCase(glong a, gbyte aCoder, glong b, gbyte bCoder, gint length) {
+            if (length <= 0)
+                return -1;
+            if (aCoder == LATIN1)
+                return bCoder == LATIN1 ? mismatchIgnoreCaseOf((PCBYTE) a, (PCBYTE) b, length)
+                                        : mismatchIgnoreCaseOf((PCBYTE) a, (PCCHAR) b, length);
+            return bCoder == LATIN1 ? mismatchIgnoreCaseOf((PCCHAR) a, (PCBYTE) b, length)
+                                    : mismatchIgnoreCaseOf((PCCHAR) a, (PCCHAR) b, length);
+        }
+
+        gint StringCoding::hash(glong src, gbyte coder, gint length) {
+            if (length <= 0)
+                return 0;
+            return coder == LATIN1 ? hashOf((PCBYTE) src, length) : hashOf((PCCHAR) src, length);
+        }
+
+        glong StringCoding::decodedUtf8Length(glong src, glong count, gbool &latin1) {
+            if (count <= 0)
+                return 0;
+            return decodedLengthOf((PCBYTE) src, count, latin1);
+        }
+
+        void StringCoding::decodeUtf8(glong src, glong count, glong dst, gbyte dstCoder) {
+            if (count <= 0)
+                return;
+            if (dstCoder == LATIN1)
+                decodeUtf8Of((PCBYTE) src, count, (PBYTE) dst);
+            else
+                decodeUtf8Of((PCBYTE) src, count, (PCHAR) dst);
+        }
+
+        glong StringCoding::encodedUtf8Length(glong src, gbyte coder, gint count) {
+            if (count <= 0)
+                return 0;
+            return coder == LATIN1 ? encodedLengthOf((PCBYTE) src, count) : encodedLengthOf((PCCHAR) src, count);
+        }
+
+        void StringCoding::encodeUtf8(glong src, gbyte coder, gint count, glong dst) {
+            if (count <= 0)
+                return;
+            if (coder == LATIN1)
+                encodeUtf8Of((PCBYTE) src, count, (PBYTE) dst);
+            else
+                encodeUtf8Of((PCCHAR) src, count, (PBYTE) dst);
+        }
+
+        glong StringCoding::hash64(glong src, gbyte coder, gint length, glong seed) {
+            // the coder is part of the hashed data: two equal strings always have the same coder
+            return (glong) hash64Of((PCBYTE) src, (glong) (length < 0 ? 0 : length) << coder,
+                                    (UINT64) seed + coder);
+        }
+
+    } // native
+
+} // core
@@ -0,0 +1,208 @@
+//
+// Created by T.N.Brunshweeck on 15/10/2026.
+//
+
+#ifndef CORE23_STRINGCODING_H
+#define CORE23_STRINGCODING_H
+
+#include <core/Object.h>
+
+namespace core {
+
+    namespace native {
+
+        /**
+         * Utility methods to work with the storage of the strings (String and StringBuffer).
+         *
+         * <p>The characters of a string are stored with one of two encodings (named coder):
+         * <ul>
+         * <li><b style="color: orange;"> LATIN1</b>: each char is stored on one byte. This
+         *     encoding is only used when all chars of the string are in range [U+0000, U+00FF].
+         * <li><b style="color: orange;"> UTF16</b>: each char is stored on two bytes, in the
+         *     native byte order.
+         * </ul>
+         *
+         * <p>All methods of this class take the native address of first char (index 0) of the storage.
+         * None of them perform bounds checks. It is the responsibility of the caller to
+         * perform such checks before calling these methods.
+         *
+         * <p>The searches use the vector instructions when they are enabled at compile
+         * time (<b style="color: orange;"> SSE2</b> or <b style="color: orange;"> AVX2</b>),
+         * and scalar loops otherwise.
+         *
+         * @author Brunshweeck Tazeussong
+         */
+        class StringCoding CORE_FINAL : public Object {
+        private:
+            StringCoding() = default;
+
+        public:
+
+            /**
+             * The coder of storage using one byte per char
+             */
+            static CORE_FAST gbyte LATIN1 = 0;
+
+            /**
+             * The coder of storage using two bytes per char
+             */
+            static CORE_FAST gbyte UTF16 = 1;
+
+            /**
+             * Return true if the given char can be stored with LATIN1 coder.
+             */
+            static CORE_FAST gbool canEncode(gint ch) { return (ch >> 8) == 0; }
+
+            /**
+             * Return the char at the given index of storage.
+             */
+            static gchar getChar(glong src, gbyte coder, glong index) {
+                return coder == LATIN1 ? (gchar) (((gbyte *) src)[index] & 0xFF) : ((gchar *) src)[index];
+            }
+
+            /**
+             * Set the char at the given index of storage. If the coder is LATIN1,
+             * the given char must be encodable (see canEncode).
+             */
+            static void putChar(glong dst, gbyte coder, glong index, gchar ch) {
+                if (coder == LATIN1)
+                    ((gbyte *) dst)[index] = (gbyte) ch;
+                else
+                    ((gchar *) dst)[index] = ch;
+            }
+
+            /**
+             * Copy the given UTF16 chars in LATIN1 storage, while these chars are encodable.
+             *
+             * @return the number of copied chars (equals to count if all chars has been copied)
+             */
+            static gint compress(glong src, glong dst, gint count);
+
+            /**
+             * Copy the given LATIN1 chars in UTF16 storage.
+             */
+            static void inflate(glong src, glong dst, gint count);
+
+            /**
+             * Copy the given chars from storage to another. If the destination coder is LATIN1,
+             * all copied chars must be encodable.
+             *
+             * <p>The source and destination ranges may overlap only when the two coders are same.
+             */
+            static void copy(glong src, gbyte srcCoder, gint srcIndex, glong dst, gbyte dstCoder, gint dstIndex,
+                             gint count);
+
+            /**
+             * Return the index of first char that is not encodable with LATIN1 coder in given
+             * UTF16 storage, or -1 if all chars are encodable.
+             */
+            static gint indexOfNonLatin1(glong src, gint count);
+
+            /**
+             * Return the index of first occurrence of the given char (in range [fromIndex, length)),
+             * or -1 if not found.
+             */
+            static gint indexOf(glong src, gbyte coder, gint length, gint ch, gint fromIndex);
+
+            /**
+             * Return the index of last occurrence of the given char (in range [0, fromIndex]),
+             * or -1 if not found.
+             */
+            static gint lastIndexOf(glong src, gbyte coder, gint length, gint ch, gint fromIndex);
+
+            /**
+             * Return the number of occurrences of the given char (in range [U+0000, U+FFFF]).
+             */
+            static gint count(glong src, gbyte coder, gint length, gint ch);
+
+            /**
+             * Return the index of first occurrence of the given sub-string starting at index
+             * greater than or equals to fromIndex, or -1 if not found.
+             */
+            static gint indexOf(glong src, gbyte coder, gint length,
+                                glong str, gbyte strCoder, gint strLength, gint fromIndex);
+
+            /**
+             * Return the index of last occurrence of the given sub-string starting at index
+             * less than or equals to fromIndex, or -1 if not found.
+             */
+            static gint lastIndexOf(glong src, gbyte coder, gint length,
+                                    glong str, gbyte strCoder, gint strLength, gint fromIndex);
+
+            /**
+             * Return the index of first mismatch char of the two given storages, or -1 if
+             * the length first chars are same.
+             */
+            static gint mismatch(glong a, gbyte aCoder, glong b, gbyte bCoder, gint length);
+
+            /**
+             * Return the index of first char that is not ASCII, or -1 if all chars are ASCII.
+             */
+            static gint indexOfNonAscii(glong src, gbyte coder, gint length);
+
+            /**
+             * Return the index of first char that may be changed by the conversion to
+             * upper case (if upper is true) or to lower case (otherwise), or -1 if none.
+             * This char is either an ASCII letter changed by the conversion, or a non-ASCII
+             * char (that must be converted with the Unicode tables).
+             */
+            static gint indexOfCaseChange(glong src, gbyte coder, gint length, gbool upper);
+
+            /**
+             * Copy the given ASCII chars from storage to another, converted to upper case
+             * (if upper is true) or to lower case (otherwise). The source and destination
+             * may be the same storage.
+             */
+            static void convertCase(glong src, gbyte srcCoder, glong dst, gbyte dstCoder, gint count, gbool upper);
+
+            /**
+             * Return the index of first mismatch char of the two given storages ignoring the
+             * case of ASCII letters, or -1 if the length first chars are same. The non-ASCII
+             * chars are compared exactly (the caller must compare them with the Unicode tables).
+             */
+            static gint mismatchIgnoreCase(glong a, gbyte aCoder, glong b, gbyte bCoder, gint length);
+
+            /**
+             * Return the number of chars decoded from the given UTF-8 bytes, and set latin1
+             * to false if one of these chars is not a latin1 char. The malformed sequences
+             * are decoded as '?'.
+             */
+            static glong decodedUtf8Length(glong src, glong count, gbool &latin1);
+
+            /**
+             * Decode the given UTF-8 bytes into the given storage (with the given coder).
+             * The storage must hold decodedUtf8Length chars, and the LATIN1 coder is allowed
+             * only if all decoded chars are latin1 chars.
+             */
+            static void decodeUtf8(glong src, glong count, glong dst, gbyte dstCoder);
+
+            /**
+             * Return the number of bytes of the given chars encoded in UTF-8. The lone
+             * surrogates are encoded as '?'.
+             */
+            static glong encodedUtf8Length(glong src, gbyte coder, gint count);
+
+            /**
+             * Encode the given chars in UTF-8 into the given storage, which must hold
+             * encodedUtf8Length bytes.
+             */
+            static void encodeUtf8(glong src, gbyte coder, gint count, glong dst);
+
+            /**
+             * Return the hash code of the given chars (the polynomial hash
+             * s[0]*31^(n-1) + s[1]*31^(n-2) + ... + s[n-1]).
+             */
+            static gint hash(glong src, gbyte coder, gint length);
+
+            /**
+             * Return the 64-bit hash code of the given chars, computed with the
+             * given seed (64-bit xxHash of the storage).
+             */
+            static glong hash64(glong src, gbyte coder, gint length, glong seed);
+        };
+
+    } // native
+
+} // core
+
+#endif //CORE23_STRINGCODING_H
@@ -0,0 +1,258 @@
+//
+// Created by T.N.Brunshweeck on 15/10/2026.
+//
+
+#include "StringTable.h"
+#include <core/private/StringCoding.h>
+#include <core/private/Unsafe.h>
+
+#if defined(CORE_COMPILER_MSVC) && !defined(CORE_COMPILER_GNU)
+#include <intrin.h>
+#endif
+
+namespace core {
+
+    namespace native {
+
+        namespace {
+
+            /**
+             * The entry of table. The chars of the interned string (and the null terminator)
+             * are stored just after the entry, in the same memory block.
+             */
+            interface Entry {
+                Entry *next;
+                glong hash;
+                gint length;
+                gbyte coder;
+            };
+
+            /**
+             * The segment of table. Each segment is a separate chained hash table, protected
+             * by its own lock.
+             */
+            interface Segment {
+                gint volatile lock;
+                gint capacity;
+                glong count;
+                Entry **entries;
+            };
+
+            /**
+             * The number of segments (must be power of two)
+             */
+            CORE_FAST gint SEGMENT_COUNT = 64;
+
+            /**
+             * The initial number of buckets of each segment (must be power of two)
+             */
+            CORE_FAST gint INITIAL_CAPACITY = 16;
+
+            /**
+             * The size (in bytes) of the header of each entry, rounded to keep the chars aligned
+             */
+            CORE_FAST glong ENTRY_SIZE = (sizeof(Entry) + 7) & ~7;
+
+            /**
+             * The segments of table (zero-initialized before any dynamic initialization).
+             */
+            Segment segments[SEGMENT_COUNT];
+
+            /**
+             * The association of string literal to its interned storage. The address of
+             * literal is published after the storage, such that the readers never need lock.
+             */
+            interface Literal {
+                glong volatile address;
+                glong storage;
+            };
+
+            /**
+             * The number of slots of literal cache (must be power of two)
+             */
+            CORE_FAST gint LITERAL_CACHE_SIZE = 1024;
+
+            /**
+             * The maximum number of slots visited to find a literal
+             */
+            CORE_FAST gint LITERAL_PROBES = 16;
+
+            Literal literals[LITERAL_CACHE_SIZE];
+
+            gint volatile literalsLock;
+
+            void lock(gint volatile &state) {
+#if defined(CORE_COMPILER_GNU)
+                while (__atomic_exchange_n(&state, 1, __ATOMIC_ACQUIRE) != 0) {
+                    while (__atomic_load_n(&state, __ATOMIC_RELAXED) != 0) {
+                        // spin until the lock is released
+                    }
+                }
+#elif defined(CORE_COMPILER_MSVC)
+                while (_InterlockedExchange((long volatile *) &state, 1) != 0) {
+                    while (state != 0) {
+                        // spin until the lock is released
+                    }
+                }
+#else
+                while (state != 0) {
+                    // spin until the lock is released
+                }
+                state = 1;
+#endif
+            }
+
+            void unlock(gint volatile &state) {
+#if defined(CORE_COMPILER_GNU)
+                __atomic_store_n(&state, 0, __ATOMIC_RELEASE);
+#elif defined(CORE_COMPILER_MSVC)
+                _InterlockedExchange((long volatile *) &state, 0);
+#else
+                state = 0;
+#endif
+            }
+
+            glong loadAcquire(glong volatile &address) {
+#if defined(CORE_COMPILER_GNU)
+                return __atomic_load_n(&address, __ATOMIC_ACQUIRE);
+#else
+                // the volatile accesses have acquire/release semantics on MSVC targets
+                return address;
+#endif
+            }
+
+            void storeRelease(glong volatile &address, glong value) {
+#if defined(CORE_COMPILER_GNU)
+                __atomic_store_n(&address, value, __ATOMIC_RELEASE);
+#else
+                address = value;
+#endif
+            }
+
+            glong charsOf(const Entry *entry) {
+                return (glong) entry + ENTRY_SIZE;
+            }
+
+            const Entry *entryOf(glong storage) {
+                return (const Entry *) (storage - ENTRY_SIZE);
+            }
+
+            gint slotOf(glong address) {
+                // the high bits of product depend on all bits of address
+                glong const h = (glong) ((GENERIC_UINT64) address * 0x9E3779B97F4A7C15ULL);
+                return (gint) (h >> 32) & (LITERAL_CACHE_SIZE - 1);
+            }
+
+            /**
+             * Double the number of buckets of given segment (the segment lock must be held).
+             */
+            void resize(Segment &segment) {
+                gint const newCapacity = segment.capacity == 0 ? INITIAL_CAPACITY : segment.capacity << 1;
+                Entry **const newEntries = (Entry **) Unsafe::allocateMemory(newCapacity * (glong) sizeof(Entry *));
+                for (gint i = 0; i < newCapacity; ++i)
+                    newEntries[i] = null;
+                for (gint i = 0; i < segment.capacity; ++i) {
+                    Entry *entry = segment.entries[i];
+                    while (entry != null) {
+                        Entry *const next = entry->next;
+                        gint const index = (gint) (entry->hash >> 32) & (newCapacity - 1);
+                        entry->next = newEntries[index];
+                        newEntries[index] = entry;
+                        entry = next;
+                    }
+                }
+                if (segment.entries != null)
+                    Unsafe::freeMemory((glong) segment.entries);
+                segment.entries = newEntries;
+                segment.capacity = newCapacity;
+            }
+        }
+
+        glong StringTable::intern(glong src, gbyte coder, gint length) {
+            // the hash is seeded with an address randomized by the address space layout
+            glong const hash = StringCoding::hash64(src, coder, length, (glong) segments);
+            Segment &segment = segments[(gint) hash & (SEGMENT_COUNT - 1)];
+            lock(segment.lock);
+            if (segment.capacity > 0) {
+                Entry *entry = segment.entries[(gint) (hash >> 32) & (segment.capacity - 1)];
+                for (; entry != null; entry = entry->next) {
+                    if (entry->hash == hash && entry->length == length && entry->coder == coder &&
+                        StringCoding::mismatch(charsOf(entry), coder, src, coder, length) < 0) {
+                        unlock(segment.lock);
+                        return charsOf(entry);
+                    }
+                }
+            }
+            Entry *entry = null;
+            try {
+                if (segment.count >= (segment.capacity >> 2) * 3)
+                    resize(segment);
+                glong const sizeInBytes = (length + 1LL) << coder;
+                entry = (Entry *) Unsafe::allocateMemory(ENTRY_SIZE + sizeInBytes);
+            } catch (const Throwable &thr) {
+                unlock(segment.lock);
+                thr.throws(__trace("core.private.StringTable"));
+            }
+            entry->hash = hash;
+            entry->length = length;
+            entry->coder = coder;
+            StringCoding::copy(src, coder, 0, charsOf(entry), coder, 0, length);
+            StringCoding::putChar(charsOf(entry), coder, length, 0);
+            gint const index = (gint) (hash >> 32) & (segment.capacity - 1);
+            entry->next = segment.entries[index];
+            segment.entries[index] = entry;
+            segment.count += 1;
+            unlock(segment.lock);
+            return charsOf(entry);
+        }
+
+        gint StringTable::lengthOf(glong storage) {
+            return entryOf(storage)->length;
+        }
+
+        gbyte StringTable::coderOf(glong storage) {
+            return entryOf(storage)->coder;
+        }
+
+        glong StringTable::literal(glong address) {
+            gint const slot = slotOf(address);
+            for (gint i = 0; i < LITERAL_PROBES; ++i) {
+                Literal &literal = literals[(slot + i) & (LITERAL_CACHE_SIZE - 1)];
+                glong const key = loadAcquire(literal.address);
+                if (key == address)
+                    return literal.storage;
+                if (key == 0)
+                    break;
+            }
+            return 0;
+        }
+
+        void StringTable::putLiteral(glong address, glong storage) {
+            gint const slot = slotOf(address);
+            lock(literalsLock);
+            for (gint i = 0; i < LITERAL_PROBES; ++i) {
+                Literal &literal = literals[(slot + i) & (LITERAL_CACHE_SIZE - 1)];
+                if (literal.address == address)
+                    break;
+                if (literal.address == 0) {
+                    literal.storage = storage;
+                    storeRelease(literal.address, address);
+                    break;
+                }
+            }
+            unlock(literalsLock);
+        }
+
+        glong StringTable::size() {
+            glong count = 0;
+            for (Segment &segment: segments) {
+                lock(segment.lock);
+                count += segment.count;
+                unlock(segment.lock);
+            }
+            return count;
+        }
+
+    } // native
+
+} // core
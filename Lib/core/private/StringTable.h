@@ -0,0 +1,75 @@
+//
+// Created by T.N.Brunshweeck on 15/10/2026.
+//
+
+#ifndef CORE23_STRINGTABLE_H
+#define CORE23_STRINGTABLE_H
+
+#include <core/Object.h>
+
+namespace core {
+
+    namespace native {
+
+        /**
+         * The pool of interned strings (see String.intern).
+         *
+         * <p>The table keeps one storage block for each distinct sequence of chars that has
+         * been interned. This storage is shared by all interned copies of the string, and it is
+         * never released (the interned strings live until the end of the process).
+         *
+         * <p>The table is split in segments, each one protected by its own lock and resized
+         * independently when it becomes too full, such that the concurrent interning of
+         * different strings rarely contends.
+         *
+         * <p>The table also caches the interned storage of the string literals that cannot be
+         * referenced directly (see operator ""_S), keyed by the address of these literals.
+         *
+         * @author Brunshweeck Tazeussong
+         */
+        class StringTable CORE_FINAL : public Object {
+        private:
+            StringTable() = default;
+
+        public:
+
+            /**
+             * Return the address of the shared storage of the given chars. The storage is
+             * added to the table if absent. The storage is null-terminated, and uses the given
+             * coder (that must be the most compact coder of these chars).
+             */
+            static glong intern(glong src, gbyte coder, gint length);
+
+            /**
+             * Return the number of strings interned in the table.
+             */
+            static glong size();
+
+            /**
+             * Return the number of chars of the given interned storage.
+             */
+            static gint lengthOf(glong storage);
+
+            /**
+             * Return the coder of the given interned storage.
+             */
+            static gbyte coderOf(glong storage);
+
+            /**
+             * Return the interned storage associated to the string literal at the given address,
+             * or zero if none. This lookup is lock-free.
+             */
+            static glong literal(glong address);
+
+            /**
+             * Associate the given interned storage to the string literal at the given address.
+             * The association is ignored if the cache of literals is full.
+             */
+            static void putLiteral(glong address, glong storage);
+        };
+
+    } // native
+
+} // core
+
+#endif //CORE23_STRINGTABLE_H
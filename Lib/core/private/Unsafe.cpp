@@ -584,150 +584,228 @@ namespace core {
         }
 
         namespace {
-            interface Heap {
-                glong address = 0;
-                Heap *next = null;
-                Heap *prev = null;
 
-                CORE_FAST Heap(glong address, Heap *prev, Heap *next) :
-                        address(address), prev(prev), next(next) {}
-            };
-
-            class Cache CORE_FINAL : public Object {
+            /**
+             * The Registry class represent the set of addresses of all instances created
+             * by Unsafe::allocateInstance. The set is split in independent shards (selected by
+             * the address hash) guarded by their own spin lock, and each shard is an open
+             * addressing table with linear probing. Insertion, lookup and removal run in
+             * constant time on average, whatever the number of living instances.
+             */
+            class Registry CORE_FINAL : public Object {
             private:
-                Heap *head = {};
-                Heap *tail = {};
-                gint count = 0;
-                enum CacheState : gbool {
-                    UNLOCKED,
-                    LOCKED,
-                } state = UNLOCKED;
+                /**
+                 * The number of shards (must be power of two)
+                 */
+                static CORE_FAST gint SHARD_COUNT = 64;
+
+                /**
+                 * The initial capacity of each shard (must be power of two)
+                 */
+                static CORE_FAST gint INITIAL_CAPACITY = 16;
+
+                /**
+                 * The marker of slot never used
+                 */
+                static CORE_FAST glong EMPTY = 0;
+
+                /**
+                 * The marker of slot previously used (never a valid instance address,
+                 * because all instances are aligned to heap word size)
+                 */
+                static CORE_FAST glong DELETED = 1;
+
+                interface Shard {
+                    glong *slots = null;
+                    gint capacity = 0;
+                    gint shift = 64; // 64 - log2(capacity)
+                    gint count = 0; // the number of living addresses
+                    gint used = 0; // the number of living and deleted addresses
+                    gint volatile state = 0;
+                };
+
+                Shard shards[SHARD_COUNT] = {};
+
+                static CORE_FAST glong mix(glong address) {
+                    // Fibonacci hashing of the address without alignment bits
+                    return (glong) (((unsigned long long) address >> 3) * 0x9E3779B97F4A7C15ULL);
+                }
 
-            public:
-                CORE_FAST Cache() = default;
+                Shard &shardOf(glong hash) {
+                    return shards[(gint) ((unsigned long long) hash >> 58) & (SHARD_COUNT - 1)];
+                }
 
-                CORE_FAST Cache(const Cache &) = default;
+                /**
+                 * Return the home slot of given hash in the table of (64 - shift) bits.
+                 * The low bits of Fibonacci hash are poorly mixed, the slot is taken from
+                 * the high bits that follow the 6 bits used by shardOf.
+                 */
+                static CORE_FAST gint slotOf(glong hash, gint shift) {
+                    return (gint) (((unsigned long long) hash << 6) >> shift);
+                }
 
-                CORE_FAST Cache(Cache &&) CORE_NOTHROW = default;
+                static void lock(Shard &shard) {
+                    while (CORE_EXPR(
+                            __sync_lock_test_and_set(&shard.state, 1),
+                            __atomic_exchange_n(&shard.state, 1, __ATOMIC_ACQUIRE),
+                            CORE_INTERLOCKED_FUNCTION(Exchange)((long volatile *) &shard.state, 1),
+                            [&]() -> gint {
+                                gint const oldState = shard.state;
+                                shard.state = 1;
+                                return oldState;
+                            }()) != 0) {
+                        while (shard.state != 0) {
+                            // spin until the shard is released
+                        }
+                    }
+                }
 
-                void add(glong address) {
-                    if (state == LOCKED) {
-                        // wait
-                    } else if (count == Integer::MAX_VALUE) {
-                        return;
+                static void unlock(Shard &shard) {
+                    CORE_EXPR(
+                            __sync_lock_release(&shard.state),
+                            __atomic_store_n(&shard.state, 0, __ATOMIC_RELEASE),
+                            CORE_INTERLOCKED_FUNCTION(Exchange)((long volatile *) &shard.state, 0),
+                            shard.state = 0
+                    );
+                }
+
+                /**
+                 * Return the index of slot containing the given address, or -1 if
+                 * this address is not registered.
+                 */
+                static gint find(const Shard &shard, glong address, glong hash) {
+                    if (shard.capacity == 0)
+                        return -1;
+                    gint const mask = shard.capacity - 1;
+                    gint i = slotOf(hash, shard.shift);
+                    for (;;) {
+                        glong const slot = shard.slots[i];
+                        if (slot == address)
+                            return i;
+                        if (slot == EMPTY)
+                            return -1;
+                        i = (i + 1) & mask;
                     }
-                    state = LOCKED;
-                    try {
-                        head = new Heap(address, null, head);
-                        (head->next != null ? head->next->prev : tail) = head;
-                        count += 1;
-                    } catch (const GENERIC_THROWABLE &) {}
-                    state = UNLOCKED;
                 }
 
-                gbool exists(glong address) {
-                    if (state == LOCKED) {
-                        // wait
+                /**
+                 * Rebuild the table of given shard with the given capacity,
+                 * discarding all deleted slots.
+                 */
+                static void rehash(Shard &shard, gint newCapacity) {
+                    glong *newSlots = (glong *) Unsafe::allocateMemory((glong) newCapacity * 8);
+                    Unsafe::setMemory((glong) newSlots, (glong) newCapacity * 8, 0);
+                    gint const mask = newCapacity - 1;
+                    gint newShift = 64;
+                    for (gint n = newCapacity; n > 1; n >>= 1)
+                        newShift -= 1;
+                    for (gint i = 0; i < shard.capacity; ++i) {
+                        glong const address = shard.slots[i];
+                        if (address != EMPTY && address != DELETED) {
+                            gint j = slotOf(mix(address), newShift);
+                            while (newSlots[j] != EMPTY)
+                                j = (j + 1) & mask;
+                            newSlots[j] = address;
+                        }
                     }
-                    state = LOCKED;
-                    Heap *first = head;
-                    Heap *last = tail;
-                    gint i = 0;
-                    while (i < count) {
-                        if (first->address == address) {
-                            state = UNLOCKED;
-                            return true;
+                    if (shard.slots != null)
+                        Unsafe::freeMemory((glong) shard.slots);
+                    shard.slots = newSlots;
+                    shard.capacity = newCapacity;
+                    shard.shift = newShift;
+                    shard.used = shard.count;
+                }
+
+            public:
+                CORE_FAST Registry() = default;
+
+                void add(glong address) {
+                    if (address == EMPTY || address == DELETED)
+                        return;
+                    glong const hash = mix(address);
+                    Shard &shard = shardOf(hash);
+                    lock(shard);
+                    try {
+                        // keep load factor (with deleted slots) under 3/4
+                        if ((shard.used + 1) * 4 > shard.capacity * 3) {
+                            gint newCapacity = shard.capacity == 0 ? INITIAL_CAPACITY : shard.capacity;
+                            while ((shard.count + 1) * 2 > newCapacity)
+                                newCapacity <<= 1;
+                            rehash(shard, newCapacity);
                         }
-                        if (last->address == address) {
-                            state = UNLOCKED;
-                            return true;
+                        if (find(shard, address, hash) < 0) {
+                            gint const mask = shard.capacity - 1;
+                            gint i = slotOf(hash, shard.shift);
+                            while (shard.slots[i] != EMPTY && shard.slots[i] != DELETED)
+                                i = (i + 1) & mask;
+                            if (shard.slots[i] == EMPTY)
+                                shard.used += 1;
+                            shard.slots[i] = address;
+                            shard.count += 1;
                         }
-                        i += 2;
-                        first = first->next;
-                        last = last->prev;
-                    }
-                    state = UNLOCKED;
-                    return false;
+                    } catch (...) {}
+                    unlock(shard);
+                }
+
+                gbool exists(glong address) {
+                    if (address == EMPTY || address == DELETED)
+                        return false;
+                    glong const hash = mix(address);
+                    Shard &shard = shardOf(hash);
+                    lock(shard);
+                    gbool const found = find(shard, address, hash) >= 0;
+                    unlock(shard);
+                    return found;
                 }
 
                 void remove(glong address) {
-                    if (state == LOCKED) {
-                        // wait
-                    }
-                    state = LOCKED;
-                    Heap *first = head;
-                    Heap *last = tail;
-                    gint i = 0;
-                    while (i < count) {
-                        if (first->address == address) {
-                            Heap *p = first->prev;
-                            Heap *n = first->next;
-                            if (first == head)
-                                head = n;
-                            if (first == tail)
-                                tail = p;
-                            if (p != null)
-                                p->next = n;
-                            if (n != null)
-                                n->prev = p;
-                            first->prev = first->next = null;
-                            delete first;
-                            state = UNLOCKED;
-                            return;
-                        }
-                        if (last->address == address) {
-                            Heap *p = last->prev;
-                            Heap *n = last->next;
-                            if (last == head)
-                                head = n;
-                            if (last == tail)
-                                tail = p;
-                            if (p != null)
-                                p->next = n;
-                            if (n != null)
-                                n->prev = p;
-                            last->prev = last->next = null;
-                            delete last;
-                            state = UNLOCKED;
-                            return;
+                    if (address == EMPTY || address == DELETED)
+                        return;
+                    glong const hash = mix(address);
+                    Shard &shard = shardOf(hash);
+                    lock(shard);
+                    gint const i = find(shard, address, hash);
+                    if (i >= 0) {
+                        gint const mask = shard.capacity - 1;
+                        if (shard.slots[(i + 1) & mask] == EMPTY) {
+                            // end of probe chain, the slot can be reused as empty
+                            shard.slots[i] = EMPTY;
+                            shard.used -= 1;
+                        } else {
+                            shard.slots[i] = DELETED;
                         }
-                        i += 2;
-                        first = first->next;
-                        last = last->prev;
+                        shard.count -= 1;
                     }
-                    state = UNLOCKED;
+                    unlock(shard);
                 }
 
-                ~Cache() override {
-                    if (state == LOCKED) {
-                        // wait
-                    }
-                    state = LOCKED;
+                ~Registry() override {
                     // clean all memory caches
-                    while (head != null) {
-                        Heap *heap = head;
-                        head = heap->next;
-                        if (head != null)
-                            head->prev = null;
-                        Unsafe::freeMemory(heap->address);
-                        heap->next = heap->prev = null;
-                        heap->address = 0;
-                        delete heap;
-                        count -= 1;
+                    for (Shard &shard: shards) {
+                        lock(shard);
+                        for (gint i = 0; i < shard.capacity; ++i) {
+                            glong const address = shard.slots[i];
+                            if (address != EMPTY && address != DELETED)
+                                Unsafe::freeMemory(address);
+                        }
+                        if (shard.slots != null)
+                            Unsafe::freeMemory((glong) shard.slots);
+                        shard.slots = null;
+                        shard.capacity = shard.count = shard.used = 0;
+                        shard.shift = 64;
+                        unlock(shard);
                     }
-                    tail = head = null;
-                    state = UNLOCKED;
                 }
             };
 
-            Cache cache = {};
+            Registry registry = {};
         }
 
-        gbool Unsafe::loadInstance(glong address) { return cache.exists(address); }
+        gbool Unsafe::loadInstance(glong address) { return registry.exists(address); }
 
-        void Unsafe::storeInstance(glong address) { cache.add(address); }
+        void Unsafe::storeInstance(glong address) { registry.add(address); }
 
-        void Unsafe::deleteInstance(glong address) { cache.remove(address); }
+        void Unsafe::deleteInstance(glong address) { registry.remove(address); }
 
         glong Unsafe::getLongUnaligned(const Object &o, glong offset) {
             if ((offset & 7) == 0) {
@@ -470,6 +470,42 @@ namespace core {
              */
             static void freeMemory(glong address);
 
+            /**
+             * Return the number of bytes currently reserved by the blocks obtained from
+             * <b style="color: orange;"> allocateMemory</b> or <b style="color: orange;"> reallocateMemory</b>
+             * and not yet disposed by <b style="color: orange;"> freeMemory</b>. The size of each block
+             * is its usable size (the requested size rounded up to its size class).
+             *
+             * <p>The statistics are gathered without stopping the other threads, the value
+             * returned is therefore a snapshot.
+             *
+             * @see allocatedMemoryBlocks
+             */
+            static glong allocatedMemorySize();
+
+            /**
+             * Return the number of blocks of given size class currently in use.
+             * The size classes are numbered from <b> 0</b> to <b> memorySizeClassCount()</b>,
+             * the last one containing all blocks larger than the greatest size class.
+             *
+             * @throws IllegalArgumentException if the size class is invalid
+             *
+             * @see memorySizeClassLimit
+             */
+            static glong allocatedMemoryBlocks(gint sizeClass);
+
+            /**
+             * Return the number of size classes used by the native allocator for small blocks.
+             */
+            static gint memorySizeClassCount();
+
+            /**
+             * Return the usable size (in bytes) of blocks of given size class.
+             *
+             * @throws IllegalArgumentException if the size class is invalid
+             */
+            static glong memorySizeClassLimit(gint sizeClass);
+
             CORE_WARNING_PUSH
             CORE_WARNING_DISABLE_INVALID_OFFSETOF
             CORE_WARNING_DISABLE_DEPRECATED
@@ -1462,6 +1498,34 @@ namespace core {
              */
             static void fullFence();
 
+            // ---------------------------- [threads] ------------------------
+
+            /**
+             * Return the number of processors available to this process (at least one).
+             */
+            static gint availableProcessors();
+
+            /**
+             * Start a new native thread executing <b> routine(argument)</b>, and
+             * return its handle, or <b> 0</b> if the thread could not be created.
+             *
+             * <p>Each started thread must be joined exactly once with
+             * <b> joinThread</b>, which releases its resources.
+             */
+            static glong startThread(void (*routine)(glong), glong argument);
+
+            /**
+             * Wait for the termination of the native thread with given handle
+             * (returned by <b> startThread</b>).
+             */
+            static void joinThread(glong thread);
+
+            /**
+             * Hint that the current thread is willing to yield its use of the
+             * processor to the other threads.
+             */
+            static void yieldThread();
+
         private:
 
             // Zero-extend an integer
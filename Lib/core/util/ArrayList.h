@@ -8,6 +8,7 @@
 #include <core/Math.h>
 #include <core/util/List.h>
 #include <core/private/ArraysSupport.h>
+#include <core/private/Arena.h>
 
 namespace core {
     namespace util {
@@ -102,6 +103,12 @@ namespace core {
              */
             gint capacity = {};
 
+            /**
+             * The arena in which the root and the elements are allocated
+             * (null if they are allocated on the heap)
+             */
+            native::Arena *arena = {};
+
             using List<E>::modNum;
 
         public:
@@ -127,6 +134,18 @@ namespace core {
                 data = (ARRAY) Unsafe::allocateMemory(L(capacity = DEFAULT_CAPACITY));
             }
 
+            /**
+             * Constructs an empty list with an initial capacity of ten, whose root and
+             * element copies are allocated in the specified arena. The memory is never
+             * released individually, it is released with the arena, therefore the list
+             * must not be used after the release of its arena.
+             *
+             * @param arena the arena used for all allocations of this list
+             */
+            CORE_EXPLICIT ArrayList(native::Arena &arena) : arena(&arena) {
+                data = (ARRAY) arena.allocateMemory(L(capacity = DEFAULT_CAPACITY));
+            }
+
             /**
              * Constructs a list containing the elements of the specified
              * collection, in the order they are returned by the collection's
@@ -189,6 +208,7 @@ namespace core {
                 Unsafe::swapValues(data, a.data);
                 Unsafe::swapValues(len, a.len);
                 Unsafe::swapValues(capacity, a.capacity);
+                Unsafe::swapValues(arena, a.arena);
             }
 
             /**
@@ -222,6 +242,7 @@ namespace core {
                     Unsafe::swapValues(data, a.data);
                     Unsafe::swapValues(len, a.len);
                     Unsafe::swapValues(capacity, a.capacity);
+                    Unsafe::swapValues(arena, a.arena);
                 }
                 return *this;
             }
@@ -243,9 +264,11 @@ namespace core {
                                          Math::max(DEFAULT_CAPACITY, minCapacity);
                 {
                     /* root copy */
-                    ARRAY newData = (ARRAY) Unsafe::allocateMemory(L(newCapacity));
+                    ARRAY newData = arena == null ? (ARRAY) Unsafe::allocateMemory(L(newCapacity)) :
+                                    (ARRAY) arena->allocateMemory(L(newCapacity));
                     arraycopy(data, 0, newData, 0, len);
-                    Unsafe::freeMemory((glong) data);
+                    if (arena == null)
+                        Unsafe::freeMemory((glong) data);
                     data = newData;
                 }
                 capacity = newCapacity;
@@ -256,6 +279,13 @@ namespace core {
              */
             static CORE_FAST glong L(gint capacity) { return 1LL * capacity * Unsafe::ARRAY_REFERENCE_INDEX_SCALE; }
 
+            /**
+             * Copy the given element (in the arena of this list if any).
+             */
+            E &copyElement(const E &e) {
+                return arena == null ? Unsafe::copyInstance(e, true) : arena->copyInstance(e);
+            }
+
             static E &elementAt(ARRAY es, gint i) { return *es[i]; }
 
         public:
@@ -394,7 +424,7 @@ namespace core {
                 try {
                     Preconditions::checkIndex(index, len);
                     E &oldValue = *data[index];
-                    data[index] = &Unsafe::copyInstance(element, true);
+                    data[index] = &copyElement(element);
                     return oldValue;
                 } catch (const IndexException &ie) { ie.throws(__trace("core.util.ArrayList")); }
             }
@@ -439,7 +469,7 @@ namespace core {
              */
             inline void add(const E &e, gint index) {
                 if (index == capacity) resize(len + 1);
-                data[index] = &Unsafe::copyInstance(e, true);
+                data[index] = &copyElement(e);
                 len += 1;
             }
 
@@ -983,7 +1013,7 @@ namespace core {
                         Preconditions::checkIndex(index, len);
                         This.checkModNum(modNum);
                         E &oldValue = elementAt(This.data, index + offset);
-                        This.data[index + offset] = &Unsafe::copyInstance(element, true);
+                        This.data[index + offset] = &This.copyElement(element);
                         return oldValue;
                     } catch (const ConcurrentException &cme) {
                         cme.throws(__trace("core.util.ArrayList.SubList"));
@@ -1374,7 +1404,7 @@ namespace core {
                 gint i = from;
                 gint const end = to;
                 for (; modNum == oldModNum && i < end; i++)
-                    es[i] = &Unsafe::copyInstance<E>(op.apply(elementAt(es, i)), true);
+                    es[i] = &copyElement(op.apply(elementAt(es, i)));
                 if (modNum != oldModNum)
                     ConcurrentException().throws(__trace("core.util.ArrayList"));
             }
@@ -1423,7 +1453,8 @@ namespace core {
 
             ~ArrayList() override {
                 len = capacity = 0;
-                Unsafe::freeMemory((glong) data);
+                if (arena == null)
+                    Unsafe::freeMemory((glong) data);
                 data = null;
             }
         };
@@ -11,112 +11,283 @@
 #include <core/native/FloatArray.h>
 #include <core/native/DoubleArray.h>
 #include <core/native/ObjectArray.h>
+#include <core/util/private/DualPivotQuicksort.h>
+#include <core/util/private/ForkJoinPool.h>
+#include <core/util/private/TimSort.h>
+#include <core/IllegalArgumentException.h>
+#include <core/IndexException.h>
 
 namespace core {
     namespace util {
-        //
-        void Arrays::sort(IntArray &a) {}
+        namespace {
+
+            /**
+             * The parallelism level set by Arrays::setParallelism (zero for default).
+             */
+            gint volatile PARALLELISM = 0;
+
+            /**
+             * The natural ordering of objects (see Comparable).
+             */
+            class NaturalOrder CORE_FINAL {
+            public:
+                gint compare(const Object &o1, const Object &o2) const {
+                    return native::AnyComparable::compare(o1, o2);
+                }
+            };
+        }
+
+        void Arrays::rangeCheck(gint arrayLength, gint fromIndex, gint toIndex) {
+            if (fromIndex > toIndex)
+                IllegalArgumentException("fromIndex(" + String::valueOf(fromIndex) + ") > toIndex("
+                                         + String::valueOf(toIndex) + ")").throws(__trace("core.util.Arrays"));
+            if (fromIndex < 0)
+                IndexException(fromIndex).throws(__trace("core.util.Arrays"));
+            if (toIndex > arrayLength)
+                IndexException(toIndex).throws(__trace("core.util.Arrays"));
+        }
 
-        void Arrays::sort(IntArray &a, gint fromIndex, gint toIndex) {}
+        void Arrays::sort(IntArray &a) {
+            DualPivotQuicksort::sort(a, 0, 0, a.length());
+        }
+
+        void Arrays::sort(IntArray &a, gint fromIndex, gint toIndex) {
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, 0, fromIndex, toIndex);
+        }
 
-        void Arrays::sort(LongArray &a) {}
+        void Arrays::sort(LongArray &a) {
+            DualPivotQuicksort::sort(a, 0, 0, a.length());
+        }
 
-        void Arrays::sort(LongArray &a, gint fromIndex, gint toIndex) {}
+        void Arrays::sort(LongArray &a, gint fromIndex, gint toIndex) {
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, 0, fromIndex, toIndex);
+        }
 
         void Arrays::sort(ShortArray &a) {
-            //
+            DualPivotQuicksort::sort(a, 0, a.length());
         }
 
         void Arrays::sort(ShortArray &a, gint fromIndex, gint toIndex) {
-
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, fromIndex, toIndex);
         }
 
         void Arrays::sort(CharArray &a) {
-
+            DualPivotQuicksort::sort(a, 0, a.length());
         }
 
         void Arrays::sort(CharArray &a, gint fromIndex, gint toIndex) {
-
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, fromIndex, toIndex);
         }
 
         void Arrays::sort(ByteArray &a) {
-
+            DualPivotQuicksort::sort(a, 0, a.length());
         }
 
         void Arrays::sort(ByteArray &a, gint fromIndex, gint toIndex) {
-
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, fromIndex, toIndex);
         }
 
         void Arrays::sort(FloatArray &a) {
-
+            DualPivotQuicksort::sort(a, 0, 0, a.length());
         }
 
         void Arrays::sort(FloatArray &a, gint fromIndex, gint toIndex) {
-
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, 0, fromIndex, toIndex);
         }
 
         void Arrays::sort(DoubleArray &a) {
-
+            DualPivotQuicksort::sort(a, 0, 0, a.length());
         }
 
         void Arrays::sort(DoubleArray &a, gint fromIndex, gint toIndex) {
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, 0, fromIndex, toIndex);
+        }
 
+        void Arrays::sort(ObjectArray &a) {
+            TimSort<Object, NaturalOrder>::sort(a, 0, a.length(), NaturalOrder());
         }
 
-        void Arrays::parallelSort(ByteArray &a) {
+        void Arrays::sort(ObjectArray &a, gint fromIndex, gint toIndex) {
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            TimSort<Object, NaturalOrder>::sort(a, fromIndex, toIndex, NaturalOrder());
+        }
 
+        void Arrays::parallelSort(ByteArray &a) {
+            DualPivotQuicksort::sort(a, 0, a.length());
         }
 
         void Arrays::parallelSort(ByteArray &a, gint fromIndex, gint toIndex) {
-
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, fromIndex, toIndex);
         }
 
         void Arrays::parallelSort(CharArray &a) {
-
+            DualPivotQuicksort::sort(a, 0, a.length());
         }
 
         void Arrays::parallelSort(CharArray &a, gint fromIndex, gint toIndex) {
-
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, fromIndex, toIndex);
         }
 
         void Arrays::parallelSort(ShortArray &a) {
-
+            DualPivotQuicksort::sort(a, 0, a.length());
         }
 
         void Arrays::parallelSort(ShortArray &a, gint fromIndex, gint toIndex) {
-
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, fromIndex, toIndex);
         }
 
         void Arrays::parallelSort(IntArray &a) {
-
+            DualPivotQuicksort::sort(a, parallelism(), 0, a.length());
         }
 
         void Arrays::parallelSort(IntArray &a, gint fromIndex, gint toIndex) {
-
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, parallelism(), fromIndex, toIndex);
         }
 
         void Arrays::parallelSort(LongArray &a) {
-
+            DualPivotQuicksort::sort(a, parallelism(), 0, a.length());
         }
 
         void Arrays::parallelSort(LongArray &a, gint fromIndex, gint toIndex) {
-
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, parallelism(), fromIndex, toIndex);
         }
 
         void Arrays::parallelSort(FloatArray &a) {
-
+            DualPivotQuicksort::sort(a, parallelism(), 0, a.length());
         }
 
         void Arrays::parallelSort(FloatArray &a, gint fromIndex, gint toIndex) {
-
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, parallelism(), fromIndex, toIndex);
         }
 
         void Arrays::parallelSort(DoubleArray &a) {
-
+            DualPivotQuicksort::sort(a, parallelism(), 0, a.length());
         }
 
         void Arrays::parallelSort(DoubleArray &a, gint fromIndex, gint toIndex) {
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            DualPivotQuicksort::sort(a, parallelism(), fromIndex, toIndex);
+        }
+
+        void Arrays::parallelPrefix(IntArray &array, const IntBinaryOperator &op) {
+            ArrayPrefixHelpers::cumulate(array, 0, array.length(), op);
+        }
+
+        void Arrays::parallelPrefix(IntArray &array, gint fromIndex, gint toIndex, const IntBinaryOperator &op) {
+            try {
+                rangeCheck(array.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            ArrayPrefixHelpers::cumulate(array, fromIndex, toIndex, op);
+        }
+
+        void Arrays::parallelPrefix(LongArray &array, const LongBinaryOperator &op) {
+            ArrayPrefixHelpers::cumulate(array, 0, array.length(), op);
+        }
+
+        void Arrays::parallelPrefix(LongArray &array, gint fromIndex, gint toIndex, const LongBinaryOperator &op) {
+            try {
+                rangeCheck(array.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            ArrayPrefixHelpers::cumulate(array, fromIndex, toIndex, op);
+        }
+
+        void Arrays::parallelPrefix(DoubleArray &array, const DoubleBinaryOperator &op) {
+            ArrayPrefixHelpers::cumulate(array, 0, array.length(), op);
+        }
+
+        void Arrays::parallelPrefix(DoubleArray &array, gint fromIndex, gint toIndex, const DoubleBinaryOperator &op) {
+            try {
+                rangeCheck(array.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            ArrayPrefixHelpers::cumulate(array, fromIndex, toIndex, op);
+        }
+
+        gint Arrays::parallelism() {
+            gint const parallelism = PARALLELISM;
+            return parallelism > 0 ? parallelism : ForkJoinPool::defaultParallelism();
+        }
 
+        void Arrays::setParallelism(gint parallelism) {
+            PARALLELISM = parallelism > 0 ? parallelism : 0;
         }
     } // util
 } // core
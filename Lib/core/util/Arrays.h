@@ -412,6 +412,8 @@ namespace core {
              * Vladimir Yaroslavskiy, Jon Bentley and Josh Bloch. This algorithm
              * offers O(n log(n)) performance on all data sets, and is typically
              * faster than traditional (one-pivot) Quicksort implementations.
+             * The range is split and sorted by <b style="color: orange;"> parallelism()</b>
+             * threads when it is large enough, the parts being merged in parallel.
              *
              * @param a the array to be sorted
              */
@@ -427,6 +429,8 @@ namespace core {
              * Vladimir Yaroslavskiy, Jon Bentley and Josh Bloch. This algorithm
              * offers O(n log(n)) performance on all data sets, and is typically
              * faster than traditional (one-pivot) Quicksort implementations.
+             * The range is split and sorted by <b style="color: orange;"> parallelism()</b>
+             * threads when it is large enough, the parts being merged in parallel.
              *
              * @param a the array to be sorted
              * @param fromIndex the index of the first element, inclusive, to be sorted
@@ -445,6 +449,8 @@ namespace core {
              * Vladimir Yaroslavskiy, Jon Bentley and Josh Bloch. This algorithm
              * offers O(n log(n)) performance on all data sets, and is typically
              * faster than traditional (one-pivot) Quicksort implementations.
+             * The range is split and sorted by <b style="color: orange;"> parallelism()</b>
+             * threads when it is large enough, the parts being merged in parallel.
              *
              * @param a the array to be sorted
              */
@@ -460,6 +466,8 @@ namespace core {
              * Vladimir Yaroslavskiy, Jon Bentley and Josh Bloch. This algorithm
              * offers O(n log(n)) performance on all data sets, and is typically
              * faster than traditional (one-pivot) Quicksort implementations.
+             * The range is split and sorted by <b style="color: orange;"> parallelism()</b>
+             * threads when it is large enough, the parts being merged in parallel.
              *
              * @param a the array to be sorted
              * @param fromIndex the index of the first element, inclusive, to be sorted
@@ -486,6 +494,8 @@ namespace core {
              * Vladimir Yaroslavskiy, Jon Bentley and Josh Bloch. This algorithm
              * offers O(n log(n)) performance on all data sets, and is typically
              * faster than traditional (one-pivot) Quicksort implementations.
+             * The range is split and sorted by <b style="color: orange;"> parallelism()</b>
+             * threads when it is large enough, the parts being merged in parallel.
              *
              * @param a the array to be sorted
              */
@@ -509,6 +519,8 @@ namespace core {
              * Vladimir Yaroslavskiy, Jon Bentley and Josh Bloch. This algorithm
              * offers O(n log(n)) performance on all data sets, and is typically
              * faster than traditional (one-pivot) Quicksort implementations.
+             * The range is split and sorted by <b style="color: orange;"> parallelism()</b>
+             * threads when it is large enough, the parts being merged in parallel.
              *
              * @param a the array to be sorted
              * @param fromIndex the index of the first element, inclusive, to be sorted
@@ -535,6 +547,8 @@ namespace core {
              * Vladimir Yaroslavskiy, Jon Bentley and Josh Bloch. This algorithm
              * offers O(n log(n)) performance on all data sets, and is typically
              * faster than traditional (one-pivot) Quicksort implementations.
+             * The range is split and sorted by <b style="color: orange;"> parallelism()</b>
+             * threads when it is large enough, the parts being merged in parallel.
              *
              * @param a the array to be sorted
              */
@@ -558,6 +572,8 @@ namespace core {
              * Vladimir Yaroslavskiy, Jon Bentley and Josh Bloch. This algorithm
              * offers O(n log(n)) performance on all data sets, and is typically
              * faster than traditional (one-pivot) Quicksort implementations.
+             * The range is split and sorted by <b style="color: orange;"> parallelism()</b>
+             * threads when it is large enough, the parts being merged in parallel.
              *
              * @param a the array to be sorted
              * @param fromIndex the index of the first element, inclusive, to be sorted
@@ -569,7 +585,30 @@ namespace core {
              */
             static void parallelSort(DoubleArray &a, gint fromIndex, gint toIndex);
 
+            /**
+             * Return the parallelism level of the parallel algorithms of this class
+             * (the number of threads used by <b style="color: orange;"> parallelSort</b>).
+             * By default, it is the number of available processors.
+             */
+            static gint parallelism();
+
+            /**
+             * Set the parallelism level of the parallel algorithms of this class.
+             * A parallelism level of one disables the multi-threading, and a negative
+             * or zero parallelism level restores the default parallelism level (the
+             * number of available processors).
+             *
+             * @param parallelism the new parallelism level
+             */
+            static void setParallelism(gint parallelism);
+
         private:
+            /**
+             * Checks that fromIndex and toIndex are in the range and throws an
+             * exception if they aren't.
+             */
+            static void rangeCheck(gint arrayLength, gint fromIndex, gint toIndex);
+
             /**
              * The minimum array length below which a parallel sorting
              * algorithm will not further partition the sorting task. Using
@@ -578,6 +617,8 @@ namespace core {
              */
             static CORE_FAST gint MIN_ARRAY_SORT_GRAN = 1 << 13;
 
+        public:
+
             /**
              * Sorts the specified array of objects into ascending order, according
              * to the <b style="color: green;"> natural ordering</b>  of its elements.
@@ -590,16 +631,12 @@ namespace core {
              * <p>This sort is guaranteed to be <i>stable</i>:  equal elements will
              * not be reordered as a result of the sort.
              *
-             * @implNote The sorting algorithm is a parallel sort-merge that breaks the
-             * array into sub-arrays that are themselves sorted and then merged. When
-             * the sub-array length reaches a minimum granularity, the sub-array is
-             * sorted using the appropriate <b style="color: orange;"> Arrays::sort</b> 
-             * method. If the length of the specified array is less than the minimum
-             * granularity, then it is sorted using the appropriate <b style="color: orange;"> 
-             * Arrays::sort</b>  method. The algorithm requires a
-             * working space no greater than the size of the original array. The
-             * <b style="color: orange;"> ForkJoin common pool</b>  is used to
-             * execute any parallel tasks.
+             * <p>Implementation note: This implementation is a stable, adaptive,
+             * iterative mergesort (TimSort) that requires far fewer than n lg(n)
+             * comparisons when the input array is partially sorted, while offering
+             * the performance of a traditional mergesort when the input array is
+             * randomly ordered.  Only the references of elements are moved, using
+             * temporary storage of at most n/2 references.
              *
              * @tparam T the class of the objects to be sorted
              * @param a the array to be sorted
@@ -610,7 +647,7 @@ namespace core {
              *         ordering of the array elements is found to violate the
              *         <b style="color: orange;"> Comparable</b>  contract
              */
-            template<class T, Class<gbool>::OnlyIf<Class<Comparable<T>>::isSuper<T>()> = true>
+            template<class T, Class<gbool>::OnlyIf<Class<Comparable<T>>::template isSuper<T>()> = true>
             static void sort(Array<T> &a);
 
             /**
@@ -654,7 +691,7 @@ namespace core {
              *         not <i>mutually comparable</i> (for example, strings and
              *         integers).
              */
-            template<class T, Class<gbool>::OnlyIf<Class<Comparable<T>>::isSuper<T>()> = true>
+            template<class T, Class<gbool>::OnlyIf<Class<Comparable<T>>::template isSuper<T>()> = true>
             static void parallelSort(Array<T> &a, gint fromIndex, gint toIndex);
 
             /**
@@ -770,6 +807,9 @@ namespace core {
              * Fourth Annual ACM-SIAM Symposium on Discrete Algorithms, pp 467-474,
              * January 1993.
              *
+             * <p>The elements are compared with the natural ordering of their class,
+             * that must implement <b style="color: orange;"> Comparable</b>.
+             *
              * @param a the array to be sorted
              * @throws ClassCastException if the array contains elements that are not
              *         <i>mutually comparable</i> (for example, strings and integers)
@@ -818,6 +858,9 @@ namespace core {
              * Fourth Annual ACM-SIAM Symposium on Discrete Algorithms, pp 467-474,
              * January 1993.
              *
+             * <p>The elements are compared with the natural ordering of their class
+             * (see <b style="color: orange;"> Arrays::sort(ObjectArray)</b>).
+             *
              * @param a the array to be sorted
              * @param fromIndex the index of the first element (inclusive) to be
              *        sorted
@@ -942,6 +985,13 @@ namespace core {
              * Parallel prefix computation is usually more efficient than
              * sequential loops for large arrays.
              *
+             * <p>The function must be associative: the range is split in blocks whose
+             * totals are computed and cumulated before the blocks themselves (in
+             * parallel), so the operands are grouped differently than in a sequential
+             * loop, but never reordered (the function is not required to be commutative).
+             * The small ranges are cumulated sequentially. Each cumulated
+             * element is a copy of the function result.
+             *
              * @tparam T the class of the objects in the array
              * @param array the array, which is modified in-place by this method
              * @param op a side-effect-free, associative function to perform the
@@ -974,10 +1024,15 @@ namespace core {
              * Parallel prefix computation is usually more efficient than
              * sequential loops for large arrays.
              *
+             * <p>The function must be associative: the range is split in blocks whose
+             * totals are computed and cumulated before the blocks themselves (in
+             * parallel), so the operands are grouped differently than in a sequential
+             * loop, but never reordered (the function is not required to be commutative).
+             * The small ranges are cumulated sequentially.
+             *
              * @param array the array, which is modified in-place by this method
              * @param op a side-effect-free, associative function to perform the
              * cumulation
-             * @throws NullPointerException if the specified array or function is null
              */
             static void parallelPrefix(LongArray &array, const LongBinaryOperator &op);
 
@@ -1006,7 +1061,11 @@ namespace core {
              *
              * <p> Because floating-point operations may not be strictly associative,
              * the returned result may not be identical to the value that would be
-             * obtained if the operation was performed sequentially.
+             * obtained if the operation was performed sequentially: the range is
+             * split in blocks whose totals are computed and cumulated before the
+             * blocks themselves (in parallel), so the operands are grouped
+             * differently than in a sequential loop (but never reordered).
+             * The small ranges are cumulated sequentially.
              *
              * @param array the array, which is modified in-place by this method
              * @param op a side-effect-free function to perform the cumulation
@@ -1026,7 +1085,11 @@ namespace core {
              * obtained if the operation was performed sequentially.
              *
              * @param array the array, which is modified in-place by this method
+             * @param fromIndex the index of the first element, inclusive
+             * @param toIndex the index of the last element, exclusive
              * @param op a side-effect-free function to perform the cumulation
+             * @throws IllegalArgumentException if <b> fromIndex > toIndex</b> 
+             * @throws IndexException if <b> fromIndex < 0</b>  or <b> toIndex > array.length</b> 
              */
             static void
             parallelPrefix(DoubleArray &array, gint fromIndex, gint toIndex, const DoubleBinaryOperator &op);
@@ -1039,6 +1102,12 @@ namespace core {
              * Parallel prefix computation is usually more efficient than
              * sequential loops for large arrays.
              *
+             * <p>The function must be associative: the range is split in blocks whose
+             * totals are computed and cumulated before the blocks themselves (in
+             * parallel), so the operands are grouped differently than in a sequential
+             * loop, but never reordered (the function is not required to be commutative).
+             * The small ranges are cumulated sequentially.
+             *
              * @param array the array, which is modified in-place by this method
              * @param op a side-effect-free, associative function to perform the
              * cumulation
@@ -5730,4 +5799,58 @@ namespace core {
     } // util
 } // core
 
+#include <core/util/private/ArrayPrefixHelpers.h>
+#include <core/util/private/TimSort.h>
+
+namespace core {
+    namespace util {
+
+        template<class T, Class<gbool>::OnlyIf<Class<Comparable<T>>::template isSuper<T>()>>
+        void Arrays::sort(Array<T> &a) {
+            /**
+             * The natural ordering of elements.
+             */
+            class NaturalOrder CORE_FINAL {
+            public:
+                gint compare(const T &o1, const T &o2) const {
+                    return o1.compareTo(o2);
+                }
+            };
+
+            TimSort<T, NaturalOrder>::sort(a, 0, a.length(), NaturalOrder());
+        }
+
+        template<class T, class U, Class<gbool>::OnlyIf<Class<U>::template isSuper<T>()>>
+        void Arrays::sort(Array<T> &a, const Comparator<U> &c) {
+            TimSort<U, Comparator<U>>::sort(a, 0, a.length(), c);
+        }
+
+        template<class T, class U, Class<gbool>::OnlyIf<Class<U>::template isSuper<T>()>>
+        void Arrays::sort(Array<T> &a, gint fromIndex, gint toIndex, const Comparator<U> &c) {
+            try {
+                rangeCheck(a.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            TimSort<U, Comparator<U>>::sort(a, fromIndex, toIndex, c);
+        }
+
+        template<class T>
+        void Arrays::parallelPrefix(Array<T> &array, const BinaryOperator<T> &op) {
+            ArrayPrefixHelpers::cumulate(array, 0, array.length(), op);
+        }
+
+        template<class T>
+        void Arrays::parallelPrefix(Array<T> &array, gint fromIndex, gint toIndex, const BinaryOperator<T> &op) {
+            try {
+                rangeCheck(array.length(), fromIndex, toIndex);
+            } catch (const Exception &ex) {
+                ex.throws(__trace("core.util.Arrays"));
+            }
+            ArrayPrefixHelpers::cumulate(array, fromIndex, toIndex, op);
+        }
+
+    } // util
+} // core
+
 #endif //CORE23_ARRAYS_H
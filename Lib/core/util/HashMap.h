@@ -7,6 +7,7 @@
 
 #include <core/Float.h>
 #include <core/private/ArraysSupport.h>
+#include <core/private/Arena.h>
 #include <core/util/Map.h>
 
 namespace core {
@@ -313,15 +314,61 @@ namespace core {
              * cheapest possible way to reduce systematic lossage, as well as
              * to incorporate impact of the highest bits that would otherwise
              * never be used in index calculations because of table bounds.
+             *
+             * <p>The String keys are hashed with their 64-bit seeded hash (see
+             * String.hash64), using a per-process seed. Their polynomial hash code
+             * is easy to invert, and a set of colliding keys can be built on purpose
+             * to make every operation of this map linear. The seeded hash is not
+             * memoized: it is computed once per operation, and the entries keep it.
              */
             static gint hash(const K &key) {
                 if (null == key)
                     return 0;
-                else {
+                else
+                    return KeyHash<K>::hash(key);
+            }
+
+            /**
+             * Return the seed used to hash the String keys. This seed is computed once per
+             * process, from the addresses chosen by the address space layout randomization
+             * (the repository has no other source of entropy).
+             */
+            static glong hashSeed() {
+                static const glong seed = []() -> glong {
+                    static gint anchor = 0;
+                    gint local = 0;
+                    CORE_ALIAS(U64, native::GENERIC_UINT64);
+                    U64 h = (U64) (glong) &anchor;
+                    h = h * 0x9E3779B97F4A7C15ULL ^ (U64) (glong) &local;
+                    h = h * 0x9E3779B97F4A7C15ULL ^ (U64) (glong) &HashMap::hashSeed;
+                    // final mix (from splitmix64)
+                    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+                    return (glong) (h ^ (h >> 31));
+                }();
+                return seed;
+            }
+
+            /**
+             * The hash function applied on the non-null keys.
+             */
+            template<class T, gbool = Class<typename Class<T>::NCVRef>::template isSimilar<String>()>
+            class KeyHash CORE_FINAL {
+            public:
+                static gint hash(const T &key) {
                     gint h = key.hash();
                     return h ^ (h >> 16);
                 }
-            }
+            };
+
+            template<class T>
+            class KeyHash<T, true> CORE_FINAL {
+            public:
+                static gint hash(const T &key) {
+                    glong const h = key.hash64(hashSeed());
+                    return (gint) (h ^ (h >> 32));
+                }
+            };
 
             /**
              * Returns k.compareTo(x) if x matches kc (k's screened comparable
@@ -393,6 +440,12 @@ namespace core {
              */
             gfloat factor;
 
+            /**
+             * The arena in which the table, the nodes and the mappings are allocated
+             * (null if they are allocated on the heap)
+             */
+            native::Arena *arena = {};
+
         public:
 
             /**
@@ -433,6 +486,19 @@ namespace core {
              */
             CORE_FAST HashMap() : HashMap(DEFAULT_CAPACITY, DEFAULT_FACTOR) {}
 
+            /**
+             * Constructs an empty <b> HashMap</b>  with the default initial capacity
+             * (16) and the default load factor (0.75), whose table, nodes and mappings
+             * are allocated in the specified arena. The memory is never released
+             * individually, it is released with the arena, therefore the map must not
+             * be used after the release of its arena.
+             *
+             * @param arena the arena used for all allocations of this map
+             */
+            CORE_EXPLICIT HashMap(native::Arena &arena) : HashMap(DEFAULT_CAPACITY, DEFAULT_FACTOR) {
+                this->arena = &arena;
+            }
+
             /**
              * Constructs a new <b> HashMap</b>  with the same mappings as the
              * specified <b> Map</b> .  The <b> HashMap</b>  is created with
@@ -479,6 +545,7 @@ namespace core {
                 Unsafe::swapValues(len, m.len);
                 Unsafe::swapValues(threshold, m.threshold);
                 Unsafe::swapValues(factor, m.factor);
+                Unsafe::swapValues(arena, m.arena);
                 m.modNum += 1;
             }
 
@@ -511,6 +578,7 @@ namespace core {
                     Unsafe::swapValues(len, m.len);
                     Unsafe::swapValues(threshold, m.threshold);
                     Unsafe::swapValues(factor, m.factor);
+                    Unsafe::swapValues(arena, m.arena);
                     modNum += 1;
                     m.modNum += 1;
                 }
@@ -734,7 +802,7 @@ namespace core {
                     if (e != null) { // existing mapping for a key
                         VALUE oldValue = e->v;
                         if (!addIfAbsent || oldValue == null) {
-                            e->v = &Unsafe::copyInstance(value, true);
+                            e->v = &copyElement(value);
                         }
                         afterNodeAccess(e);
                         return *oldValue;
@@ -787,7 +855,8 @@ namespace core {
                               (gint) ft : Integer::MAX_VALUE);
                 }
                 threshold = newThr;
-                ARRAY newTab = (ARRAY) Unsafe::allocateMemory(L(newCap));
+                ARRAY newTab = arena == null ? (ARRAY) Unsafe::allocateMemory(L(newCap)) :
+                               (ARRAY) arena->allocateMemory(L(newCap));
                 table = newTab;
                 capacity = newCap;
                 for (gint i = 0; i < newCap; ++i)
@@ -836,7 +905,8 @@ namespace core {
                         }
                     }
                 }
-                Unsafe::freeMemory((glong) oldTab);
+                if (arena == null)
+                    Unsafe::freeMemory((glong) oldTab);
                 return newTab;
             }
 
@@ -1346,7 +1416,7 @@ namespace core {
             gbool replace(const K &key, const V &oldValue, const V &newValue) override {
                 NODE e = null;
                 if ((e = entryOf(key)) != null && (valueOf(e).equals(oldValue))) {
-                    e->v = &Unsafe::copyInstance(newValue, true);
+                    e->v = &copyElement(newValue);
                     afterNodeAccess(e);
                     return true;
                 }
@@ -1357,7 +1427,7 @@ namespace core {
                 NODE e = null;
                 if ((e = entryOf(key)) != null) {
                     VALUE oldValue = e->v;
-                    e->v = &Unsafe::copyInstance(value, true);
+                    e->v = &copyElement(value);
                     afterNodeAccess(e);
                     return *oldValue;
                 }
@@ -1401,7 +1471,7 @@ namespace core {
                     for (gint i = 0; i < capacity; ++i) {
                         NODE e = tab[i];
                         for (; e != null; e = e->next) {
-                            e->v = &Unsafe::copyInstance(function.apply(keyOf(e), valueOf(e)), true);
+                            e->v = &copyElement(function.apply(keyOf(e), valueOf(e)));
                         }
                     }
                     if (modNum != mc)
@@ -1429,6 +1499,25 @@ namespace core {
                 return clone;
             }
 
+        protected:
+
+            /**
+             * Copy the given key or value (in the arena of this map if any).
+             */
+            template<class T>
+            T &copyElement(const T &o) {
+                return arena == null ? Unsafe::copyInstance(o, true) : arena->copyInstance(o);
+            }
+
+            /**
+             * Create new node (in the arena of this map if any).
+             */
+            template<class T, class...Params>
+            T &newInstance(Params &&...params) {
+                return arena == null ? Unsafe::allocateInstance<T>(Unsafe::forwardInstance<Params>(params)...) :
+                       arena->allocateInstance<T>(Unsafe::forwardInstance<Params>(params)...);
+            }
+
         private:
             template<class T>
             interface AbstractItr : public Iterator<T> {
@@ -1551,30 +1640,30 @@ namespace core {
 
             // Create a regular (non-tree) node
             virtual NODE newNode(gint hash, const K &key, const V &value, NODE next) {
-                K &keyCopy = Unsafe::copyInstance(key, true);
-                V &valueCopy = Unsafe::copyInstance(value, true);
-                return &Unsafe::allocateInstance<Node>(hash, keyCopy, valueCopy, next);
+                K &keyCopy = copyElement(key);
+                V &valueCopy = copyElement(value);
+                return &newInstance<Node>(hash, keyCopy, valueCopy, next);
             }
 
             // For conversion from TreeNodes to plain nodes
             virtual NODE replacementNode(NODE p, NODE next) {
                 K &keyCopy = (K &) keyOf(p);
                 V &valueCopy = (V &) valueOf(p);
-                return &Unsafe::allocateInstance<Node>(p->hash, keyCopy, valueCopy, next);
+                return &newInstance<Node>(p->hash, keyCopy, valueCopy, next);
             }
 
             // Create a tree bin node
             virtual TNODE newTNode(gint hash, const K &key, const V &value, NODE next) {
-                K &keyCopy = Unsafe::copyInstance(key, true);
-                V &valueCopy = Unsafe::copyInstance(value, true);
-                return &Unsafe::allocateInstance<TreeNode>(hash, keyCopy, valueCopy, next);
+                K &keyCopy = copyElement(key);
+                V &valueCopy = copyElement(value);
+                return &newInstance<TreeNode>(hash, keyCopy, valueCopy, next);
             }
 
             // For treeifyBin
             virtual TNODE replacementTNode(NODE p, NODE next) {
                 K &keyCopy = (K &) keyOf(p);
                 V &valueCopy = (V &) valueOf(p);
-                return &Unsafe::allocateInstance<TreeNode>(p->hash, keyCopy, valueCopy, next);
+                return &newInstance<TreeNode>(p->hash, keyCopy, valueCopy, next);
             }
 
             /**
@@ -2218,7 +2307,8 @@ namespace core {
                     len = 0;
                 }
                 capacity = 0;
-                Unsafe::freeMemory((glong) table);
+                if (arena == null)
+                    Unsafe::freeMemory((glong) table);
                 table = null;
             }
         };
@@ -210,16 +210,18 @@ namespace core {
             using typename HashMap<K, V>::NODE;
             using typename HashMap<K, V>::TNODE;
 
+            using HashMap<K, V>::copyElement;
+
             NODE newNode(gint hash, const K &key, const V &value, NODE next) override {
-                K &keyCopy = Unsafe::copyInstance(key, true);
-                V &valueCopy = Unsafe::copyInstance(value, true);
-                return Unsafe::allocateInstance<Entry>(hash, keyCopy, valueCopy, next);
+                K &keyCopy = copyElement(key);
+                V &valueCopy = copyElement(value);
+                return &this->template newInstance<Entry>(hash, keyCopy, valueCopy, next);
             }
 
             NODE replacementNode(NODE p, NODE next) override {
                 K &keyCopy = (K &) keyOf(p);
                 V &valueCopy = (V &) valueOf(p);
-                ENTRY t = &Unsafe::allocateInstance<Entry>(p->hash, keyCopy, valueCopy, next);
+                ENTRY t = &this->template newInstance<Entry>(p->hash, keyCopy, valueCopy, next);
                 transferLinks((ENTRY) p, t);
                 return t;
             }
@@ -227,9 +229,9 @@ namespace core {
             using typename HashMap<K, V>::TreeNode;
 
             TNODE newTNode(gint hash, const K &key, const V &value, NODE next) override {
-                K &keyCopy = Unsafe::copyInstance(key, true);
-                V &valueCopy = Unsafe::copyInstance(value, true);
-                TNODE p = &Unsafe::allocateInstance<TreeNode>(hash, keyCopy, valueCopy, next);
+                K &keyCopy = copyElement(key);
+                V &valueCopy = copyElement(value);
+                TNODE p = &this->template newInstance<TreeNode>(hash, keyCopy, valueCopy, next);
                 linkNodeLast(p);
                 return p;
             }
@@ -237,7 +239,7 @@ namespace core {
             TNODE replacementTNode(NODE p, NODE next) override {
                 K &keyCopy = (K &) keyOf(p);
                 V &valueCopy = (V &) valueOf(p);
-                ENTRY t = &Unsafe::allocateInstance<TreeNode>(p->hash, keyCopy, valueCopy, next);
+                ENTRY t = &this->template newInstance<TreeNode>(p->hash, keyCopy, valueCopy, next);
                 transferLinks((ENTRY) p, t);
                 return t;
             }
@@ -329,6 +331,15 @@ namespace core {
              */
             LinkedHashMap() : HashMap<K, V>(), accessOrder(false) {}
 
+            /**
+             * Constructs an empty insertion-ordered <b> LinkedHashMap</b> instance
+             * with the default initial capacity (16) and load factor (0.75), whose
+             * table, entries and mappings are allocated in the specified arena.
+             *
+             * @param arena the arena used for all allocations of this map
+             */
+            CORE_EXPLICIT LinkedHashMap(native::Arena &arena) : HashMap<K, V>(arena), accessOrder(false) {}
+
             /**
              * Constructs an insertion-ordered <b> LinkedHashMap</b> instance with
              * the same mappings as the specified map.  The <b> LinkedHashMap</b>
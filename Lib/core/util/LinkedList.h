@@ -6,6 +6,7 @@
 #define CORE23_LINKEDLIST_H
 
 #include <core/util/List.h>
+#include <core/private/Arena.h>
 
 namespace core {
     namespace util {
@@ -83,6 +84,12 @@ namespace core {
              */
             LnkNode last = {};
 
+            /**
+             * The arena in which the nodes and the elements are allocated
+             * (null if they are allocated on the heap)
+             */
+            native::Arena *arena = {};
+
             using List<E>::modNum;
 
         public:
@@ -92,6 +99,16 @@ namespace core {
              */
             CORE_FAST LinkedList() = default;
 
+            /**
+             * Constructs an empty list whose nodes and element copies are allocated
+             * in the specified arena. The nodes are never released individually, they are
+             * released with the arena, therefore the list must not be used after the
+             * release of its arena.
+             *
+             * @param arena the arena used for all allocations of this list
+             */
+            CORE_EXPLICIT LinkedList(native::Arena &arena) : arena(&arena) {}
+
             /**
              * Constructs a list containing the elements of the specified
              * collection, in the order they are returned by the collection's
@@ -121,6 +138,7 @@ namespace core {
                 Unsafe::swapValues(len, ll.len);
                 Unsafe::swapValues(first, ll.first);
                 Unsafe::swapValues(last, ll.last);
+                Unsafe::swapValues(arena, ll.arena);
             }
 
             /**
@@ -179,12 +197,37 @@ namespace core {
                     Unsafe::swapValues(len, ll.len);
                     Unsafe::swapValues(first, ll.first);
                     Unsafe::swapValues(last, ll.last);
+                    Unsafe::swapValues(arena, ll.arena);
                 }
                 return *this;
             }
 
         private:
 
+            /**
+             * Create new node (in the arena of this list if any).
+             */
+            LnkNode allocateNode(LnkNode prev, E &e, LnkNode next) {
+                if (arena == null)
+                    return new Node(prev, e, next);
+                return new((GENERIC_PTR) arena->allocateMemory(sizeof(Node))) Node(prev, e, next);
+            }
+
+            /**
+             * Destroy the given node (the nodes allocated in arena are released with the arena).
+             */
+            void destroyNode(LnkNode x) {
+                if (arena == null)
+                    delete x;
+            }
+
+            /**
+             * Copy the given element (in the arena of this list if any).
+             */
+            E &copyElement(const E &e) {
+                return arena == null ? Unsafe::copyInstance(e, true) : arena->copyInstance(e);
+            }
+
             /**
              * Links e as first element.
              */
@@ -193,7 +236,7 @@ namespace core {
                 ({
 
                      LnkNode f = first;
-                     LnkNode newNode = new Node(null, e, f);
+                     LnkNode newNode = allocateNode(null, e, f);
                      first = newNode;
                      (f == null ? last : f->prev) = newNode;
                      len += 1;
@@ -210,7 +253,7 @@ namespace core {
                 CORE_TRY_ONLY_EX
                 ({
                      LnkNode l = last;
-                     LnkNode newNode = new Node(l, e, null);
+                     LnkNode newNode = allocateNode(l, e, null);
                      last = newNode;
                      (l == null ? first : l->next) = newNode;
                      len += 1;
@@ -228,7 +271,7 @@ namespace core {
                 CORE_TRY_ONLY_EX
                 ({
                      LnkNode pred = succ->prev;
-                     LnkNode newNode = new Node(pred, e, succ);
+                     LnkNode newNode = allocateNode(pred, e, succ);
                      succ->prev = newNode;
                      (pred == null ? first : pred->next) = newNode;
                      len += 1;
@@ -251,7 +294,7 @@ namespace core {
                 (next == null ? last : next->prev) = null;
                 len -= 1;
                 modNum += 1;
-                delete f;
+                destroyNode(f);
                 return element;
             }
 
@@ -268,7 +311,7 @@ namespace core {
                 (prev == null ? first : prev->next) = null;
                 len -= 1;
                 modNum += 1;
-                delete l;
+                destroyNode(l);
                 return element;
             }
 
@@ -295,7 +338,7 @@ namespace core {
                 x->item = null;
                 len -= 1;
                 modNum += 1;
-                delete x;
+                destroyNode(x);
                 return element;
             }
 
@@ -328,7 +371,7 @@ namespace core {
              * @return <b>true</b> (as specified by <b style="color:orange;">Collection::add</b>)
              */
             gbool add(const E &e) override {
-                linkLast(Unsafe::copyInstance(e, true));
+                linkLast(copyElement(e));
                 return true;
             }
 
@@ -403,7 +446,7 @@ namespace core {
                 ({
                      // fail if and only if new operator fails
                      for (E &e: a) {
-                         LnkNode newNode = new Node(pred, e, null);
+                         LnkNode newNode = allocateNode(pred, e, null);
                          (pred == null ? first : pred->next) = newNode;
                          pred = newNode;
                          success += 1;
@@ -441,7 +484,7 @@ namespace core {
                     LnkNode next = x->next;
                     x->item = null;
                     x->next = x->prev = null;
-                    delete x;
+                    destroyNode(x);
                     x = next;
                 }
             }
@@ -488,7 +531,7 @@ namespace core {
                     Preconditions::checkIndex(index, len);
                     LnkNode x = nodeAt(index);
                     E &oldValue = *x->item;
-                    x->item = &Unsafe::copyInstance(element, true);
+                    x->item = &copyElement(element);
                     return oldValue;
                 } catch (const IndexException &ie) { ie.throws(__trace("core.util.LinkedList")); }
             }
@@ -505,8 +548,8 @@ namespace core {
             void add(gint index, const E &element) override {
                 try {
                     Preconditions::checkIndexForAdding(index, len);
-                    if (index == len) linkLast(Unsafe::copyInstance(element, true));
-                    else linkBefore(Unsafe::copyInstance(element, true), nodeAt(index));
+                    if (index == len) linkLast(copyElement(element));
+                    else linkBefore(copyElement(element), nodeAt(index));
                 } catch (const IndexException &ie) { ie.throws(__trace("core.util.LinkedList")); }
             }
 
@@ -709,7 +752,7 @@ namespace core {
                         IllegalStateException().throws(__trace("core.util.LinkedList.ListItr"));
                     if (modNum != root.modNum)
                         ConcurrentException().throws(__trace("core.util.LinkedList.ListItr"));
-                    last->item = &Unsafe::copyInstance(e, true);
+                    last->item = &root.copyElement(e);
                 }
 
                 void add(const T &e) override {
@@ -717,9 +760,9 @@ namespace core {
                         ConcurrentException().throws(__trace("core.util.LinkedList.ListItr"));
                     last = null;
                     if (cursor == null)
-                        root.linkLast(Unsafe::copyInstance(e, true));
+                        root.linkLast(root.copyElement(e));
                     else
-                        root.linkBefore(Unsafe::copyInstance(e, true), cursor);
+                        root.linkBefore(root.copyElement(e), cursor);
                     index += 1;
                     modNum = root.modNum;
                 }
@@ -54,6 +54,13 @@ namespace core {
 
         gint StringTokenizer::skipDelimiter(gint startPos) const {
             gint position = startPos;
+            if (!retDelims && !hasSurrogates && delimiters.length() == 1) {
+                // single delimiter
+                gchar const delimiter = delimiters.charAt(0);
+                while (position < limit && str.charAt(position) == delimiter)
+                    position++;
+                return position;
+            }
             while (!retDelims && position < limit) {
                 if (!hasSurrogates) {
                     gchar const c = str.charAt(position);
@@ -73,6 +80,11 @@ namespace core {
 
         gint StringTokenizer::scanToken(gint startPos) const {
             gint position = startPos;
+            if (!hasSurrogates && delimiters.length() == 1) {
+                // single delimiter: vectorized search (see String.indexOf)
+                gint const index = str.indexOf(delimiters.charAt(0), position);
+                position = index < 0 || index > limit ? limit : index;
+            }
             while (position < limit) {
                 if (!hasSurrogates) {
                     gchar const c = str.charAt(position);
@@ -120,6 +132,10 @@ namespace core {
         }
 
         String StringTokenizer::nextToken() {
+            return nextTokenView().toString();
+        }
+
+        StringView StringTokenizer::nextTokenView() {
             /*
              * If next position already computed in hasMore() and
              * delimiters have changed between the computation and this invocation,
@@ -136,7 +152,7 @@ namespace core {
                 NoSuchElementException().throws(__trace("core.util.StringTokenizer"));
             gint const start = cursor;
             cursor = scanToken(cursor);
-            return str.subString(start, cursor);
+            return StringView(str, start, cursor - start);
         }
 
         String StringTokenizer::nextToken(const String &delim) {
@@ -5,7 +5,7 @@
 #ifndef CORE23_STRINGTOKENIZER_H
 #define CORE23_STRINGTOKENIZER_H
 
-#include <core/String.h>
+#include <core/StringView.h>
 #include <core/Character.h>
 #include <core/native/IntArray.h>
 
@@ -220,6 +220,18 @@ namespace core {
              */
             virtual String nextToken();
 
+            /**
+             * Returns the next token from this string tokenizer, as a view of the
+             * tokenized string. Unlike nextToken, this method never allocates memory.
+             * The returned view remains valid while this tokenizer exists.
+             *
+             * @return     the view of next token from this string tokenizer.
+             * @throws     NoSuchElementException  if there are no more tokens in this
+             *               tokenizer's string.
+             * @see        StringView.toString
+             */
+            virtual StringView nextTokenView();
+
             /**
              * Returns the next token in this string tokenizer's string. First,
              * the setValue of characters considered to be delimiters by this
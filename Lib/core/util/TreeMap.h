@@ -6,6 +6,7 @@
 #define CORE23_TREEMAP_H
 
 #include <core/util/Map.h>
+#include <core/private/Arena.h>
 
 namespace core {
     namespace util {
@@ -115,6 +116,29 @@ namespace core {
              */
             gint modNum = {};
 
+            /**
+             * The arena in which the entries and the mappings are allocated
+             * (null if they are allocated on the heap)
+             */
+            native::Arena *arena = {};
+
+            /**
+             * Copy the given key or value (in the arena of this map if any).
+             */
+            template<class T>
+            T &copyElement(const T &o) {
+                return arena == null ? Unsafe::copyInstance(o, true) : arena->copyInstance(o);
+            }
+
+            /**
+             * Create new entry (in the arena of this map if any).
+             */
+            template<class...Params>
+            ENTRY newEntry(Params &&...params) {
+                return arena == null ? &Unsafe::allocateInstance<Entry>(Unsafe::forwardInstance<Params>(params)...) :
+                       &arena->allocateInstance<Entry>(Unsafe::forwardInstance<Params>(params)...);
+            }
+
         public:
 
             /**
@@ -149,6 +173,28 @@ namespace core {
                 }
             }
 
+            /**
+             * Constructs a new, empty tree map, using the natural ordering of its
+             * keys, whose entries and mappings are allocated in the specified arena.
+             * The memory is never released individually, it is released with the
+             * arena, therefore the map must not be used after the release of its arena.
+             *
+             * @param arena the arena used for all allocations of this map
+             */
+            CORE_EXPLICIT TreeMap(native::Arena &arena) : cmp(null), arena(&arena) {}
+
+            /**
+             * Constructs a new, empty tree map, ordered according to the given
+             * comparator, whose entries and mappings are allocated in the specified
+             * arena.
+             *
+             * @param comparator the comparator that will be used to order this map.
+             * @param arena the arena used for all allocations of this map
+             */
+            CORE_EXPLICIT TreeMap(const KeyComparator &comparator, native::Arena &arena) : TreeMap(comparator) {
+                this->arena = &arena;
+            }
+
             /**
              * Constructs a new tree map containing the same mappings as the given
              * map, ordered according to the <em>natural ordering</em> of its keys.
@@ -197,6 +243,7 @@ namespace core {
                 Unsafe::swapValues(root, m.root);
                 Unsafe::swapValues(len, m.len);
                 Unsafe::swapValues(cmp, m.cmp);
+                Unsafe::swapValues(arena, m.arena);
             }
 
             TreeMap<K, V> &operator=(const TreeMap &m) {
@@ -213,6 +260,7 @@ namespace core {
                     Unsafe::swapValues(root, m.root);
                     Unsafe::swapValues(len, m.len);
                     Unsafe::swapValues(cmp, m.cmp);
+                    Unsafe::swapValues(arena, m.arena);
                     modNum += 1;
                     m.modNum += 1;
                 }
@@ -409,7 +457,7 @@ namespace core {
 
         private:
             void addEntry(K &key, V &value, ENTRY parent, gbool addToLeft) {
-                ENTRY e = &Unsafe::allocateInstance<Entry>(key, value, parent);
+                ENTRY e = newEntry(key, value, parent);
                 (addToLeft ? parent->left : parent->right) = e;
                 len += 1;
                 modNum += 1;
@@ -419,9 +467,9 @@ namespace core {
                 ENTRY t = root;
                 if (t == null) {
                     // add to an empty map
-                    K &k = Unsafe::copyInstance(key, true);
-                    V &v = Unsafe::copyInstance(value, true);
-                    root = &Unsafe::allocateInstance<Entry>(k, v, null);
+                    K &k = copyElement(key);
+                    V &v = copyElement(value);
+                    root = newEntry(k, v, null);
                     len = 1;
                     modNum += 1;
                     return root->value();
@@ -441,8 +489,8 @@ namespace core {
                         return replaceOld ? (t->set(value)) : (t->value());
                     }
                 } while (t != null);
-                K &k = Unsafe::copyInstance(key, true);
-                V &v = Unsafe::copyInstance(value, true);
+                K &k = copyElement(key);
+                V &v = copyElement(value);
                 addEntry(k, v, parent, ret < 0);
                 return v;
             }
@@ -1093,7 +1141,7 @@ namespace core {
                     value = (VALUE) &defaultVal;
                 }
 
-                ENTRY middle = &Unsafe::allocateInstance<Entry>(key[0], value[0], null);
+                ENTRY middle = newEntry(key[0], value[0], null);
 
                 // color nodes in non-full bottommost level red
                 if (level == redLevel)
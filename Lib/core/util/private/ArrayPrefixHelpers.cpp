@@ -0,0 +1,199 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "ArrayPrefixHelpers.h"
+#include "ForkJoinPool.h"
+#include <core/util/Arrays.h>
+#include <core/native/IntArray.h>
+#include <core/native/LongArray.h>
+#include <core/native/DoubleArray.h>
+#include <core/function/IntBinaryOperator.h>
+#include <core/function/LongBinaryOperator.h>
+#include <core/function/DoubleBinaryOperator.h>
+#include <core/private/Unsafe.h>
+
+namespace core {
+    namespace util {
+
+        using namespace native;
+
+        namespace {
+
+            /**
+             * The task applying one pass of cumulation on the blocks in range
+             * [lo, hi), forking the right half of the range until one block remains.
+             */
+            class BlockTask CORE_FINAL : public ForkJoinPool::Task {
+            public:
+                static CORE_FAST gint REDUCE = 0;
+                static CORE_FAST gint SCAN = 1;
+
+                ArrayPrefixHelpers::Cumulator &cumulator;
+                gint const pass;
+                gint const fromIndex;
+                glong const size;
+                gint const blocks;
+                gint lo;
+                gint hi;
+
+                BlockTask(BlockTask *parent, ArrayPrefixHelpers::Cumulator &cumulator, gint pass, gint fromIndex,
+                          glong size, gint blocks, gint lo, gint hi) :
+                        Task(parent), cumulator(cumulator), pass(pass), fromIndex(fromIndex), size(size),
+                        blocks(blocks), lo(lo), hi(hi) {}
+
+                void compute() override {
+                    while (hi - lo > 1) {
+                        gint const mi = (gint) ((GENERIC_UINT32) (lo + hi) >> 1);
+                        addToPendingCount(1);
+                        (new BlockTask(this, cumulator, pass, fromIndex, size, blocks, mi, hi))->fork();
+                        hi = mi;
+                    }
+                    gint const from = fromIndex + (gint) (size * lo / blocks);
+                    gint const to = fromIndex + (gint) (size * (lo + 1) / blocks);
+                    if (pass == REDUCE)
+                        cumulator.reduce(lo, from, to);
+                    else
+                        cumulator.scan(lo, from, to);
+                    tryComplete();
+                }
+            };
+
+            /**
+             * The task applying the three passes of cumulation.
+             */
+            class PrefixTask CORE_FINAL : public ForkJoinPool::Task {
+            public:
+                ArrayPrefixHelpers::Cumulator &cumulator;
+                gint const fromIndex;
+                gint const toIndex;
+                gint const blocks;
+
+                PrefixTask(ArrayPrefixHelpers::Cumulator &cumulator, gint fromIndex, gint toIndex, gint blocks) :
+                        Task(null), cumulator(cumulator), fromIndex(fromIndex), toIndex(toIndex), blocks(blocks) {}
+
+                void compute() override {
+                    glong const size = (glong) toIndex - fromIndex;
+
+                    // the total of last block is not used
+                    BlockTask reduce(null, cumulator, BlockTask::REDUCE, fromIndex, size, blocks, 0, blocks - 1);
+                    reduce.invoke();
+
+                    for (gint k = 1; k < blocks - 1; ++k)
+                        cumulator.combine(k);
+
+                    BlockTask scan(null, cumulator, BlockTask::SCAN, fromIndex, size, blocks, 0, blocks);
+                    scan.invoke();
+
+                    complete();
+                }
+            };
+
+            /**
+             * The cumulation of primitive array, F is the adapter of function.
+             */
+            template<class T, class F>
+            class PrimitiveCumulator CORE_FINAL : public ArrayPrefixHelpers::Cumulator {
+            private:
+                T *const a;
+                F const f;
+                T *const totals;
+
+            public:
+                PrimitiveCumulator(T *a, F f, gint blocks) :
+                        a(a), f(f), totals(blocks > 1 ? (T *) Unsafe::allocateMemory(blocks * (glong) sizeof(T)) : null) {}
+
+                void reduce(gint block, gint from, gint to) override {
+                    T total = a[from];
+                    for (gint i = from + 1; i < to; ++i)
+                        total = f(total, a[i]);
+                    totals[block] = total;
+                }
+
+                void combine(gint block) override {
+                    totals[block] = f(totals[block - 1], totals[block]);
+                }
+
+                void scan(gint block, gint from, gint to) override {
+                    if (from == to)
+                        return;
+                    T value = a[from];
+                    if (block > 0)
+                        a[from] = value = f(totals[block - 1], value);
+                    for (gint i = from + 1; i < to; ++i)
+                        a[i] = value = f(value, a[i]);
+                }
+
+                ~PrimitiveCumulator() override {
+                    if (totals != null)
+                        Unsafe::freeMemory((glong) totals);
+                }
+            };
+
+            struct IntOperation {
+                IntBinaryOperator const &op;
+
+                gint operator()(gint x, gint y) const { return op.applyAsInt(x, y); }
+            };
+
+            struct LongOperation {
+                LongBinaryOperator const &op;
+
+                glong operator()(glong x, glong y) const { return op.applyAsLong(x, y); }
+            };
+
+            struct DoubleOperation {
+                DoubleBinaryOperator const &op;
+
+                gdouble operator()(gdouble x, gdouble y) const { return op.applyAsDouble(x, y); }
+            };
+
+            template<class T, class F>
+            void cumulatePrimitives(T *a, gint fromIndex, gint toIndex, F f) {
+                gint const count = ArrayPrefixHelpers::blocks(toIndex - fromIndex);
+                PrimitiveCumulator<T, F> cumulator(a, f, count);
+                ArrayPrefixHelpers::cumulate(cumulator, fromIndex, toIndex, count);
+            }
+        }
+
+        gint ArrayPrefixHelpers::blocks(gint size) {
+            gint const parallelism = Arrays::parallelism();
+            if (parallelism <= 1 || size < MIN_BLOCK_SIZE << 1)
+                return 1;
+            // a few blocks per thread balance the irregular progress of threads
+            glong const count = size / MIN_BLOCK_SIZE;
+            glong const limit = (glong) parallelism << 2;
+            return (gint) (count < limit ? count : limit);
+        }
+
+        void ArrayPrefixHelpers::cumulate(Cumulator &cumulator, gint fromIndex, gint toIndex, gint blocks) {
+            if (toIndex - fromIndex < 2)
+                return;
+            if (blocks <= 1) {
+                cumulator.scan(0, fromIndex, toIndex);
+                return;
+            }
+            gint const parallelism = Arrays::parallelism();
+            ForkJoinPool pool(parallelism < blocks ? parallelism : blocks);
+            PrefixTask task(cumulator, fromIndex, toIndex, blocks);
+            pool.invoke(task);
+        }
+
+        void ArrayPrefixHelpers::cumulate(IntArray &array, gint fromIndex, gint toIndex, const IntBinaryOperator &op) {
+            if (toIndex - fromIndex > 1)
+                cumulatePrimitives(&array[0], fromIndex, toIndex, IntOperation{op});
+        }
+
+        void ArrayPrefixHelpers::cumulate(LongArray &array, gint fromIndex, gint toIndex, const LongBinaryOperator &op) {
+            if (toIndex - fromIndex > 1)
+                cumulatePrimitives(&array[0], fromIndex, toIndex, LongOperation{op});
+        }
+
+        void ArrayPrefixHelpers::cumulate(DoubleArray &array, gint fromIndex, gint toIndex,
+                                          const DoubleBinaryOperator &op) {
+            if (toIndex - fromIndex > 1)
+                cumulatePrimitives(&array[0], fromIndex, toIndex, DoubleOperation{op});
+        }
+
+    } // util
+} // core
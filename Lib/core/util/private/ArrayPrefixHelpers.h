@@ -0,0 +1,151 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#ifndef CORE23_ARRAYPREFIXHELPERS_H
+#define CORE23_ARRAYPREFIXHELPERS_H
+
+#include <core/Object.h>
+
+namespace core {
+    namespace util {
+
+        /**
+         * Parallel prefix (aka cumulate, scan) support for Arrays::parallelPrefix.
+         *
+         * <p>The range to cumulate is split in blocks of same size, processed in
+         * three passes (blocked two-pass scan):
+         * <ol>
+         * <li> the total of each block (except the last one) is computed in parallel;
+         * <li> the totals are cumulated sequentially, the cumulated total of block
+         *      <b> k - 1</b> being the seed of block <b> k</b>;
+         * <li> each block is cumulated in place in parallel, starting with its seed.
+         * </ol>
+         * The small ranges (or with parallelism one) are cumulated sequentially in
+         * a single block.
+         *
+         * <p>The operands are never reordered (the function is not required to be
+         * commutative), but they are grouped differently than in the sequential
+         * loop: the function must be associative, and the results of the functions
+         * that are not strictly associative (such as the floating-point addition)
+         * may differ from the sequential ones.
+         *
+         * @author Brunshweeck Tazeussong
+         */
+        class ArrayPrefixHelpers CORE_FINAL : public Object {
+        private:
+            ArrayPrefixHelpers() = default;
+
+            /**
+             * Min number of elements of block cumulated in parallel.
+             */
+            static CORE_FAST gint MIN_BLOCK_SIZE = 1 << 13;
+
+        public:
+
+            /**
+             * The cumulation of the blocks of an array range.
+             */
+            class Cumulator : public Object {
+            public:
+
+                /**
+                 * Set the total of given block with the cumulation of the elements in
+                 * range [from, to).
+                 */
+                virtual void reduce(gint block, gint from, gint to) = 0;
+
+                /**
+                 * Cumulate the total of the previous block into the total of given block.
+                 */
+                virtual void combine(gint block) = 0;
+
+                /**
+                 * Cumulate in place the elements in range [from, to) of given block,
+                 * starting with the total of the previous block (if block > 0).
+                 */
+                virtual void scan(gint block, gint from, gint to) = 0;
+            };
+
+            /**
+             * Return the number of blocks used to cumulate a range of given size:
+             * one if the range must be cumulated sequentially.
+             */
+            static gint blocks(gint size);
+
+            /**
+             * Cumulate the given range split in the given number of blocks with
+             * the given cumulator, in parallel if there are several blocks.
+             */
+            static void cumulate(Cumulator &cumulator, gint fromIndex, gint toIndex, gint blocks);
+
+            /**
+             * Cumulate the given range of array with the given function.
+             * The range is not checked.
+             */
+            static void cumulate(IntArray &array, gint fromIndex, gint toIndex, const IntBinaryOperator &op);
+
+            /**
+             * Cumulate the given range of array with the given function.
+             * The range is not checked.
+             */
+            static void cumulate(LongArray &array, gint fromIndex, gint toIndex, const LongBinaryOperator &op);
+
+            /**
+             * Cumulate the given range of array with the given function.
+             * The range is not checked.
+             */
+            static void cumulate(DoubleArray &array, gint fromIndex, gint toIndex, const DoubleBinaryOperator &op);
+
+            /**
+             * Cumulate the given range of array with the given function (each
+             * cumulated value is a copy of the function result).
+             * The range is not checked.
+             */
+            template<class T>
+            static void cumulate(Array<T> &array, gint fromIndex, gint toIndex, const BinaryOperator<T> &op) {
+                class ObjectCumulator CORE_FINAL : public Cumulator {
+                private:
+                    Array<T> &array;
+                    BinaryOperator<T> const &op;
+                    Array<T> totals;
+
+                public:
+                    ObjectCumulator(Array<T> &array, const BinaryOperator<T> &op, gint blocks) :
+                            array(array), op(op), totals(blocks) {}
+
+                    void reduce(gint block, gint from, gint to) override {
+                        totals.set(block, (T const &) array.get(from));
+                        for (gint i = from + 1; i < to; ++i) {
+                            T const &total = op.apply(totals.get(block), array.get(i));
+                            totals.set(block, total);
+                        }
+                    }
+
+                    void combine(gint block) override {
+                        T const &total = op.apply(totals.get(block - 1), totals.get(block));
+                        totals.set(block, total);
+                    }
+
+                    void scan(gint block, gint from, gint to) override {
+                        if (block > 0) {
+                            T const &first = op.apply(totals.get(block - 1), array.get(from));
+                            array.set(from, first);
+                        }
+                        for (gint i = from + 1; i < to; ++i) {
+                            T const &next = op.apply(array.get(i - 1), array.get(i));
+                            array.set(i, next);
+                        }
+                    }
+                };
+
+                gint const count = blocks(toIndex - fromIndex);
+                ObjectCumulator cumulator(array, op, count);
+                cumulate(cumulator, fromIndex, toIndex, count);
+            }
+        };
+
+    } // util
+} // core
+
+#endif //CORE23_ARRAYPREFIXHELPERS_H
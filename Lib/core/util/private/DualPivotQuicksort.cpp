@@ -3,9 +3,201 @@
 //
 
 #include "DualPivotQuicksort.h"
+#include "ForkJoinPool.h"
+#include <core/native/ByteArray.h>
+#include <core/native/ShortArray.h>
+#include <core/native/CharArray.h>
+#include <core/native/IntArray.h>
+#include <core/native/LongArray.h>
+#include <core/native/FloatArray.h>
+#include <core/native/DoubleArray.h>
+#include <core/private/Unsafe.h>
+#include <core/private/Null.h>
+#include <core/Float.h>
+#include <core/Double.h>
 
 namespace core {
     namespace util {
+
+        using namespace native;
+
+        namespace {
+
+            /**
+             * Return true if the given value is -0.0.
+             */
+            gbool isNegativeZero(gfloat f) { return f == 0 && Float::toIntBits(f) < 0; }
+
+            gbool isNegativeZero(gdouble d) { return d == 0 && Double::toLongBits(d) < 0; }
+
+            /**
+             * Allocate the storage of the given number of elements (temporary buffers).
+             */
+            template<class T>
+            T *allocate(gint count) {
+                return (T *) Unsafe::allocateMemory((glong) count * (glong) sizeof(T));
+            }
+
+            void release(void *address) {
+                Unsafe::freeMemory((glong) address);
+            }
+
+            /**
+             * The radix sort keys of the elements of type T, computed from the
+             * bits of elements (Bits) so that their unsigned order is the order
+             * of elements.
+             */
+            template<class T>
+            class RadixKey;
+
+            template<>
+            class RadixKey<gint> {
+            public:
+                CORE_ALIAS(Bits, GENERIC_UINT32);
+
+                static Bits of(Bits bits) { return bits ^ 0x80000000U; }
+            };
+
+            template<>
+            class RadixKey<glong> {
+            public:
+                CORE_ALIAS(Bits, GENERIC_UINT64);
+
+                static Bits of(Bits bits) { return bits ^ 0x8000000000000000ULL; }
+            };
+
+            template<>
+            class RadixKey<gfloat> {
+            public:
+                CORE_ALIAS(Bits, GENERIC_UINT32);
+
+                static Bits of(Bits bits) { return bits ^ ((Bits) ((gint) bits >> 31) | 0x80000000U); }
+            };
+
+            template<>
+            class RadixKey<gdouble> {
+            public:
+                CORE_ALIAS(Bits, GENERIC_UINT64);
+
+                static Bits of(Bits bits) { return bits ^ ((Bits) ((glong) bits >> 63) | 0x8000000000000000ULL); }
+            };
+        }
+
+        /**
+         * The task of parallel sorting: the range is split into two halves
+         * sorted in parallel then merged (if depth < 0), or sorted with the
+         * Dual-Pivot Quicksort forking the large partitions.
+         */
+        template<class T>
+        class DualPivotQuicksort::Sorter CORE_FINAL : public ForkJoinPool::Task {
+        public:
+            T *const a;
+            T *const b;
+            gint const low;
+            gint const size;
+            gint const offset;
+            gint const depth;
+
+            Sorter(Sorter *parent, T *a, T *b, gint low, gint size, gint offset, gint depth) :
+                    Task(parent), a(a), b(b), low(low), size(size), offset(offset), depth(depth) {}
+
+            void compute() override {
+                if (depth < 0) {
+                    setPendingCount(2);
+                    gint const half = size >> 1;
+                    (new Sorter(this, b, a, low, half, offset, depth + 1))->fork();
+                    (new Sorter(this, b, a, low + half, size - half, offset, depth + 1))->compute();
+                } else {
+                    sort(this, a, depth, low, low + size);
+                }
+                tryComplete();
+            }
+
+            void onCompletion(Task &) override {
+                if (depth < 0) {
+                    gint const mi = low + (size >> 1);
+                    gbool const src = (depth & 1) == 0;
+
+                    Merger<T> merger(null,
+                                     a,
+                                     src ? low : low - offset,
+                                     b,
+                                     src ? low - offset : low,
+                                     src ? mi - offset : mi,
+                                     b,
+                                     src ? mi - offset : mi,
+                                     src ? low + size - offset : low + size);
+                    merger.invoke();
+                }
+            }
+
+            void forkSorter(gint depth, gint low, gint high) {
+                addToPendingCount(1);
+                (new Sorter(this, a, b, low, high - low, offset, depth))->fork();
+            }
+        };
+
+        /**
+         * The task of parallel merging of two sorted parts, the largest part
+         * is split at its median and the right sub-parts are merged by a
+         * forked merger.
+         */
+        template<class T>
+        class DualPivotQuicksort::Merger CORE_FINAL : public ForkJoinPool::Task {
+        public:
+            T *const dst;
+            gint const k;
+            T *const a1;
+            gint const lo1;
+            gint const hi1;
+            T *const a2;
+            gint const lo2;
+            gint const hi2;
+
+            Merger(Merger *parent, T *dst, gint k, T *a1, gint lo1, gint hi1, T *a2, gint lo2, gint hi2) :
+                    Task(parent), dst(dst), k(k), a1(a1), lo1(lo1), hi1(hi1), a2(a2), lo2(lo2), hi2(hi2) {}
+
+            void compute() override {
+                mergeParts(this, dst, k, a1, lo1, hi1, a2, lo2, hi2);
+                propagateCompletion();
+            }
+
+            void forkMerger(T *dst, gint k, T *a1, gint lo1, gint hi1, T *a2, gint lo2, gint hi2) {
+                addToPendingCount(1);
+                (new Merger(this, dst, k, a1, lo1, hi1, a2, lo2, hi2))->fork();
+            }
+        };
+
+        /**
+         * The task of parallel merging of runs (the right half of the runs,
+         * joined by the task merging the left half).
+         */
+        template<class T>
+        class DualPivotQuicksort::RunMerger CORE_FINAL : public ForkJoinPool::Task {
+        public:
+            T *const a;
+            T *const b;
+            gint const offset;
+            gint const aim;
+            gint *const run;
+            gint const lo;
+            gint const hi;
+            T *result;
+
+            RunMerger(T *a, T *b, gint offset, gint aim, gint *run, gint lo, gint hi) :
+                    Task(null), a(a), b(b), offset(offset), aim(aim), run(run), lo(lo), hi(hi), result(null) {}
+
+            void compute() override {
+                result = mergeRuns(a, b, offset, aim, true, run, lo, hi);
+                complete();
+            }
+
+            T *destination() {
+                join();
+                return result;
+            }
+        };
+
         gint DualPivotQuicksort::depth(gint parallelism, gint size) {
             gint depth = 0;
 
@@ -15,6 +207,919 @@ namespace core {
             return depth;
         }
 
-        gint DualPivotQuicksort::sort(IntArray &a, gint parallelism, gint low, gint high) {}
+        void DualPivotQuicksort::sort(IntArray &a, gint parallelism, gint low, gint high) {
+            if (high - low > 1)
+                sort(&a[0], parallelism, low, high);
+        }
+
+        void DualPivotQuicksort::sort(LongArray &a, gint parallelism, gint low, gint high) {
+            if (high - low > 1)
+                sort(&a[0], parallelism, low, high);
+        }
+
+        void DualPivotQuicksort::sort(FloatArray &a, gint parallelism, gint low, gint high) {
+            if (high - low > 1)
+                sortFloating(&a[0], parallelism, low, high);
+        }
+
+        void DualPivotQuicksort::sort(DoubleArray &a, gint parallelism, gint low, gint high) {
+            if (high - low > 1)
+                sortFloating(&a[0], parallelism, low, high);
+        }
+
+        void DualPivotQuicksort::sort(ByteArray &a, gint low, gint high) {
+            if (high - low > MIN_BYTE_COUNTING_SORT_SIZE)
+                countingSort(&a[0], low, high);
+            else if (high - low > 1)
+                sort((Sorter<gbyte> *) null, &a[0], 0, low, high);
+        }
+
+        void DualPivotQuicksort::sort(CharArray &a, gint low, gint high) {
+            if (high - low > MIN_SHORT_OR_CHAR_COUNTING_SORT_SIZE)
+                countingSort(&a[0], low, high);
+            else if (high - low > 1)
+                sort((Sorter<gchar> *) null, &a[0], 0, low, high);
+        }
+
+        void DualPivotQuicksort::sort(ShortArray &a, gint low, gint high) {
+            if (high - low > MIN_SHORT_OR_CHAR_COUNTING_SORT_SIZE)
+                countingSort(&a[0], low, high);
+            else if (high - low > 1)
+                sort((Sorter<gshort> *) null, &a[0], 0, low, high);
+        }
+
+        template<class T>
+        void DualPivotQuicksort::sort(T *a, gint parallelism, gint low, gint high) {
+            gint const size = high - low;
+
+            if (parallelism > 1 && size > MIN_PARALLEL_SORT_SIZE) {
+                gint const depth = DualPivotQuicksort::depth(parallelism, size >> 12);
+                T *const b = depth == 0 ? null : allocate<T>(size);
+                ForkJoinPool pool(parallelism);
+                Sorter<T> sorter(null, a, b, low, size, low, depth);
+                pool.invoke(sorter);
+                if (b != null) {
+                    release(b);
+                }
+            } else if (size < MIN_RADIX_SORT_SIZE * (gint) (sizeof(T) >> 2)) {
+                sort((Sorter<T> *) null, a, 0, low, high);
+            } else if (!tryMergeRuns((Sorter<T> *) null, a, low, size)) {
+                radixSort(a, low, high);
+            }
+        }
+
+        template<class T>
+        void DualPivotQuicksort::sortFloating(T *a, gint parallelism, gint low, gint high) {
+            /*
+             * Phase 1. Count the number of negative zero -0.0,
+             * turn them into positive zero, and move all NaNs
+             * to the end of the array.
+             */
+            gint numNegativeZero = 0;
+
+            for (gint k = high; k > low;) {
+                k -= 1;
+                T const ak = a[k];
+
+                if (isNegativeZero(ak)) {
+                    numNegativeZero += 1;
+                    a[k] = 0;
+                } else if (ak != ak) { // ak is NaN
+                    high -= 1;
+                    a[k] = a[high];
+                    a[high] = ak;
+                }
+            }
+
+            /*
+             * Phase 2. Sort everything except NaNs,
+             * which are already in place.
+             */
+            sort(a, parallelism, low, high);
+
+            /*
+             * Phase 3. Turn positive zero 0.0 back into negative zero -0.0.
+             */
+            if (numNegativeZero == 0)
+                return;
+
+            /*
+             * Find the position one less than
+             * the index of the first zero.
+             */
+            high -= 1;
+            while (low <= high) {
+                gint const middle = (gint) ((GENERIC_UINT32) (low + high) >> 1);
+
+                if (a[middle] < 0) {
+                    low = middle + 1;
+                } else {
+                    high = middle - 1;
+                }
+            }
+
+            /*
+             * Replace the required number of 0.0 by -0.0.
+             */
+            while (numNegativeZero-- > 0) {
+                a[++high] = -0.0;
+            }
+        }
+
+        template<class T>
+        void DualPivotQuicksort::sort(Sorter<T> *sorter, T *a, gint bits, gint low, gint high) {
+            while (true) {
+                gint end = high - 1;
+                gint const size = high - low;
+
+                /*
+                 * Run mixed insertion sort on small non-leftmost parts.
+                 */
+                if (size < MAX_MIXED_INSERTION_SORT_SIZE + bits && (bits & 1) > 0) {
+                    mixedInsertionSort(a, low, high - 3 * ((size >> 5) << 3), high);
+                    return;
+                }
+
+                /*
+                 * Invoke insertion sort on small leftmost part.
+                 */
+                if (size < MAX_INSERTION_SORT_SIZE) {
+                    insertionSort(a, low, high);
+                    return;
+                }
+
+                /*
+                 * Check if the whole array or large non-leftmost
+                 * parts are nearly sorted and then merge runs.
+                 */
+                if ((bits == 0 || (size > MIN_TRY_MERGE_SIZE && (bits & 1) > 0))
+                    && tryMergeRuns(sorter, a, low, size)) {
+                    return;
+                }
+
+                /*
+                 * Switch to heap sort if execution
+                 * time is becoming quadratic.
+                 */
+                if ((bits += DELTA) > MAX_RECURSION_DEPTH) {
+                    heapSort(a, low, high);
+                    return;
+                }
+
+                /*
+                 * Use an inexpensive approximation of the golden ratio
+                 * to select five sample elements and determine pivots.
+                 */
+                gint const step = (size >> 3) * 3 + 3;
+
+                /*
+                 * Five elements around (and including) the central element
+                 * will be used for pivot selection as described below. The
+                 * unequal choice of spacing these elements was empirically
+                 * determined to work well on a wide variety of inputs.
+                 */
+                gint const e1 = low + step;
+                gint const e5 = end - step;
+                gint const e3 = (gint) ((GENERIC_UINT32) (e1 + e5) >> 1);
+                gint const e2 = (gint) ((GENERIC_UINT32) (e1 + e3) >> 1);
+                gint const e4 = (gint) ((GENERIC_UINT32) (e3 + e5) >> 1);
+                T const a3 = a[e3];
+
+                /*
+                 * Sort these elements in place by the combination
+                 * of 4-element sorting network and insertion sort.
+                 *
+                 *    5 ------o-----------o------------
+                 *            |           |
+                 *    4 ------|-----o-----o-----o------
+                 *            |     |           |
+                 *    2 ------o-----|-----o-----o------
+                 *                  |     |
+                 *    1 ------------o-----o------------
+                 */
+                if (a[e5] < a[e2]) {
+                    T const t = a[e5];
+                    a[e5] = a[e2];
+                    a[e2] = t;
+                }
+                if (a[e4] < a[e1]) {
+                    T const t = a[e4];
+                    a[e4] = a[e1];
+                    a[e1] = t;
+                }
+                if (a[e5] < a[e4]) {
+                    T const t = a[e5];
+                    a[e5] = a[e4];
+                    a[e4] = t;
+                }
+                if (a[e2] < a[e1]) {
+                    T const t = a[e2];
+                    a[e2] = a[e1];
+                    a[e1] = t;
+                }
+                if (a[e4] < a[e2]) {
+                    T const t = a[e4];
+                    a[e4] = a[e2];
+                    a[e2] = t;
+                }
+
+                if (a3 < a[e2]) {
+                    if (a3 < a[e1]) {
+                        a[e3] = a[e2];
+                        a[e2] = a[e1];
+                        a[e1] = a3;
+                    } else {
+                        a[e3] = a[e2];
+                        a[e2] = a3;
+                    }
+                } else if (a3 > a[e4]) {
+                    if (a3 > a[e5]) {
+                        a[e3] = a[e4];
+                        a[e4] = a[e5];
+                        a[e5] = a3;
+                    } else {
+                        a[e3] = a[e4];
+                        a[e4] = a3;
+                    }
+                }
+
+                // Pointers
+                gint lower = low; // The index of the last element of the left part
+                gint upper = end; // The index of the first element of the right part
+
+                /*
+                 * Partitioning with 2 pivots in case of different elements.
+                 */
+                if (a[e1] < a[e2] && a[e2] < a[e3] && a[e3] < a[e4] && a[e4] < a[e5]) {
+
+                    /*
+                     * Use the first and fifth of the five sorted elements as
+                     * the pivots. These values are inexpensive approximation
+                     * of tertiles. Note, that pivot1 < pivot2.
+                     */
+                    T const pivot1 = a[e1];
+                    T const pivot2 = a[e5];
+
+                    /*
+                     * The first and the last elements to be sorted are moved
+                     * to the locations formerly occupied by the pivots. When
+                     * partitioning is completed, the pivots are swapped back
+                     * into their final positions, and excluded from the next
+                     * subsequent sorting.
+                     */
+                    a[e1] = a[lower];
+                    a[e5] = a[upper];
+
+                    /*
+                     * Skip elements, which are less or greater than the pivots.
+                     */
+                    while (a[++lower] < pivot1);
+                    while (a[--upper] > pivot2);
+
+                    /*
+                     * Backward 3-interval partitioning
+                     *
+                     *   left part                 central part          right part
+                     * +------------------------------------------------------------+
+                     * |  < pivot1  |   ?   |  pivot1 <= && <= pivot2  |  > pivot2  |
+                     * +------------------------------------------------------------+
+                     *             ^       ^                            ^
+                     *             |       |                            |
+                     *           lower     k                          upper
+                     *
+                     * Invariants:
+                     *
+                     *              all in (low, lower] < pivot1
+                     *    pivot1 <= all in (k, upper)  <= pivot2
+                     *              all in [upper, end) > pivot2
+                     *
+                     * Pointer k is the last index of ?-part
+                     */
+                    --lower;
+                    for (gint k = ++upper; --k > lower;) {
+                        T const ak = a[k];
+
+                        if (ak < pivot1) { // Move a[k] to the left side
+                            while (lower < k) {
+                                if (a[++lower] >= pivot1) {
+                                    if (a[lower] > pivot2) {
+                                        a[k] = a[--upper];
+                                        a[upper] = a[lower];
+                                    } else {
+                                        a[k] = a[lower];
+                                    }
+                                    a[lower] = ak;
+                                    break;
+                                }
+                            }
+                        } else if (ak > pivot2) { // Move a[k] to the right side
+                            a[k] = a[--upper];
+                            a[upper] = ak;
+                        }
+                    }
+
+                    /*
+                     * Swap the pivots into their final positions.
+                     */
+                    a[low] = a[lower];
+                    a[lower] = pivot1;
+                    a[end] = a[upper];
+                    a[upper] = pivot2;
+
+                    /*
+                     * Sort non-left parts recursively (possibly in parallel),
+                     * excluding known pivots.
+                     */
+                    if (size > MIN_PARALLEL_SORT_SIZE && sorter != null) {
+                        sorter->forkSorter(bits | 1, lower + 1, upper);
+                        sorter->forkSorter(bits | 1, upper + 1, high);
+                    } else {
+                        sort(sorter, a, bits | 1, lower + 1, upper);
+                        sort(sorter, a, bits | 1, upper + 1, high);
+                    }
+
+                } else { // Use single pivot in case of many equal elements
+
+                    /*
+                     * Use the third of the five sorted elements as the pivot.
+                     * This value is inexpensive approximation of the median.
+                     */
+                    T const pivot = a[e3];
+
+                    /*
+                     * The first element to be sorted is moved to the
+                     * location formerly occupied by the pivot. After
+                     * completion of partitioning the pivot is swapped
+                     * back into its final position, and excluded from
+                     * the next subsequent sorting.
+                     */
+                    a[e3] = a[lower];
+
+                    /*
+                     * Traditional 3-way (Dutch National Flag) partitioning
+                     *
+                     *   left part                 central part    right part
+                     * +------------------------------------------------------+
+                     * |   < pivot   |     ?     |   == pivot   |   > pivot   |
+                     * +------------------------------------------------------+
+                     *              ^           ^                ^
+                     *              |           |                |
+                     *            lower         k              upper
+                     *
+                     * Invariants:
+                     *
+                     *   all in (low, lower] < pivot
+                     *   all in (k, upper)  == pivot
+                     *   all in [upper, end] > pivot
+                     *
+                     * Pointer k is the last index of ?-part
+                     */
+                    for (gint k = ++upper; --k > lower;) {
+                        T const ak = a[k];
+
+                        if (ak != pivot) {
+                            a[k] = pivot;
+
+                            if (ak < pivot) { // Move a[k] to the left side
+                                while (a[++lower] < pivot);
+
+                                if (a[lower] > pivot) {
+                                    a[--upper] = a[lower];
+                                }
+                                a[lower] = ak;
+                            } else { // ak > pivot - Move a[k] to the right side
+                                a[--upper] = ak;
+                            }
+                        }
+                    }
+
+                    /*
+                     * Swap the pivot into its final position.
+                     */
+                    a[low] = a[lower];
+                    a[lower] = pivot;
+
+                    /*
+                     * Sort the right part (possibly in parallel), excluding
+                     * known pivot. All elements from the central part are
+                     * equal and therefore already sorted.
+                     */
+                    if (size > MIN_PARALLEL_SORT_SIZE && sorter != null) {
+                        sorter->forkSorter(bits | 1, upper, high);
+                    } else {
+                        sort(sorter, a, bits | 1, upper, high);
+                    }
+                }
+                high = lower; // Iterate along the left part
+            }
+        }
+
+        template<class T>
+        void DualPivotQuicksort::mixedInsertionSort(T *a, gint low, gint end, gint high) {
+            if (end == high) {
+
+                /*
+                 * Invoke simple insertion sort on tiny array.
+                 */
+                while (++low < end) {
+                    gint i = low;
+                    T const ai = a[i];
+
+                    while (ai < a[--i]) {
+                        a[i + 1] = a[i];
+                    }
+                    a[i + 1] = ai;
+                }
+            } else {
+
+                /*
+                 * Start with pin insertion sort on small part.
+                 *
+                 * Pin insertion sort is extended simple insertion sort.
+                 * The main idea of this sort is to put elements larger
+                 * than an element called pin to the end of array (the
+                 * proper area for such elements). It avoids expensive
+                 * movements of these elements through the whole array.
+                 */
+                T const pin = a[end];
+
+                for (gint p = high; ++low < end;) {
+                    gint i = low;
+                    T ai = a[i];
+
+                    if (ai < a[i - 1]) { // Small element
+
+                        /*
+                         * Insert small element into sorted part.
+                         */
+                        a[i] = a[i - 1];
+                        i -= 1;
+
+                        while (ai < a[--i]) {
+                            a[i + 1] = a[i];
+                        }
+                        a[i + 1] = ai;
+
+                    } else if (p > i && ai > pin) { // Large element
+
+                        /*
+                         * Find element smaller than pin.
+                         */
+                        while (a[--p] > pin);
+
+                        /*
+                         * Swap it with large element.
+                         */
+                        if (p > i) {
+                            ai = a[p];
+                            a[p] = a[i];
+                        }
+
+                        /*
+                         * Insert small element into sorted part.
+                         */
+                        while (ai < a[--i]) {
+                            a[i + 1] = a[i];
+                        }
+                        a[i + 1] = ai;
+                    }
+                }
+
+                /*
+                 * Continue with pair insertion sort on remain part.
+                 */
+                for (; low < high; ++low) {
+                    gint i = low;
+                    T const a1 = a[i];
+                    T const a2 = a[++low];
+
+                    /*
+                     * Insert two elements per iteration: at first, insert the
+                     * larger element and then insert the smaller element, but
+                     * from the position where the larger element was inserted.
+                     */
+                    if (a1 > a2) {
+
+                        while (a1 < a[--i]) {
+                            a[i + 2] = a[i];
+                        }
+                        a[++i + 1] = a1;
+
+                        while (a2 < a[--i]) {
+                            a[i + 1] = a[i];
+                        }
+                        a[i + 1] = a2;
+
+                    } else if (a1 < a[i - 1]) {
+
+                        while (a2 < a[--i]) {
+                            a[i + 2] = a[i];
+                        }
+                        a[++i + 1] = a2;
+
+                        while (a1 < a[--i]) {
+                            a[i + 1] = a[i];
+                        }
+                        a[i + 1] = a1;
+                    }
+                }
+            }
+        }
+
+        template<class T>
+        void DualPivotQuicksort::countingSort(T *a, gint low, gint high) {
+            gint const range = 1 << (sizeof(T) << 3);
+            gint const min = (T) -1 < 0 ? -(range >> 1) : 0;
+            gint *const count = allocate<gint>(range);
+
+            /*
+             * Compute a histogram with the number of each values.
+             */
+            for (gint i = 0; i < range; ++i) {
+                count[i] = 0;
+            }
+            for (gint i = high; i > low; ++count[a[--i] - min]);
+
+            /*
+             * Place values on their final positions, from the greatest,
+             * skipping the missing values.
+             */
+            for (gint i = range, k = high; k > low;) {
+                while (count[--i] == 0);
+                T const value = (T) (i + min);
+                gint c = count[i];
+
+                do {
+                    a[--k] = value;
+                } while (--c > 0);
+            }
+            release(count);
+        }
+
+        template<class T>
+        void DualPivotQuicksort::radixSort(T *a, gint low, gint high) {
+            CORE_ALIAS(Key, RadixKey<T>);
+            CORE_ALIAS(Bits, typename Key::Bits);
+            gint const size = high - low;
+            gint const passes = sizeof(Bits);
+
+            /*
+             * Compute the histograms of all bytes of keys at once.
+             */
+            gint count[sizeof(Bits)][256] = {};
+            Bits *src = (Bits *) (a + low);
+
+            for (gint i = 0; i < size; ++i) {
+                Bits const key = Key::of(src[i]);
+                for (gint p = 0; p < passes; ++p) {
+                    count[p][(key >> (p << 3)) & 0xFF] += 1;
+                }
+            }
+
+            /*
+             * Distribute the elements from the least significant byte,
+             * alternating between the array and the buffer.
+             */
+            Bits *const buffer = allocate<Bits>(size);
+            Bits *dst = buffer;
+
+            for (gint p = 0; p < passes; ++p) {
+                gint *const offset = count[p];
+                gint const shift = p << 3;
+
+                if (offset[(Key::of(src[0]) >> shift) & 0xFF] == size) {
+                    // All keys have the same byte
+                    continue;
+                }
+                for (gint i = 0, sum = 0; i < 256; ++i) {
+                    gint const c = offset[i];
+                    offset[i] = sum;
+                    sum += c;
+                }
+                for (gint i = 0; i < size; ++i) {
+                    Bits const bits = src[i];
+                    dst[offset[(Key::of(bits) >> shift) & 0xFF]++] = bits;
+                }
+                Bits *const t = src;
+                src = dst;
+                dst = t;
+            }
+
+            /*
+             * Copy back the elements if the last pass wrote in the buffer.
+             */
+            if (src == buffer) {
+                Bits *const b = (Bits *) (a + low);
+                for (gint i = 0; i < size; ++i) {
+                    b[i] = buffer[i];
+                }
+            }
+            release(buffer);
+        }
+
+        template<class T>
+        void DualPivotQuicksort::insertionSort(T *a, gint low, gint high) {
+            for (gint k = low; ++k < high;) {
+                gint i = k;
+                T const ai = a[i];
+
+                if (ai < a[i - 1]) {
+                    while (--i >= low && ai < a[i]) {
+                        a[i + 1] = a[i];
+                    }
+                    a[i + 1] = ai;
+                }
+            }
+        }
+
+        template<class T>
+        void DualPivotQuicksort::heapSort(T *a, gint low, gint high) {
+            for (gint k = (gint) ((GENERIC_UINT32) (low + high) >> 1); k > low;) {
+                k -= 1;
+                pushDown(a, k, a[k], low, high);
+            }
+            while (--high > low) {
+                T const max = a[low];
+                pushDown(a, low, a[high], low, high);
+                a[high] = max;
+            }
+        }
+
+        template<class T>
+        void DualPivotQuicksort::pushDown(T *a, gint p, T value, gint low, gint high) {
+            while (true) {
+                gint k = (p << 1) - low + 2; // Index of the right child
+
+                if (k > high) {
+                    break;
+                }
+                if (k == high || a[k] < a[k - 1]) {
+                    --k;
+                }
+                if (a[k] <= value) {
+                    break;
+                }
+                a[p] = a[k];
+                p = k;
+            }
+            a[p] = value;
+        }
+
+        template<class T>
+        gbool DualPivotQuicksort::tryMergeRuns(Sorter<T> *sorter, T *a, gint low, gint size) {
+
+            /*
+             * The run array is constructed only if initial runs are
+             * long enough to continue, run[i] then holds start index
+             * of the i-th sequence of elements in non-descending order.
+             */
+            gint *run = null;
+            gint capacity = 0;
+            gint const high = low + size;
+            gint count = 1;
+            gint last = low;
+
+            /*
+             * Identify all possible runs.
+             */
+            for (gint k = low + 1; k < high;) {
+
+                /*
+                 * Find the end index of the current run.
+                 */
+                if (a[k - 1] < a[k]) {
+
+                    // Identify ascending sequence
+                    while (++k < high && a[k - 1] <= a[k]);
+
+                } else if (a[k - 1] > a[k]) {
+
+                    // Identify descending sequence
+                    while (++k < high && a[k - 1] >= a[k]);
+
+                    // Reverse into ascending order
+                    for (gint i = last - 1, j = k; ++i < --j && a[i] > a[j];) {
+                        T const ai = a[i];
+                        a[i] = a[j];
+                        a[j] = ai;
+                    }
+                } else { // Identify constant sequence
+                    for (T const ak = a[k]; ++k < high && ak == a[k];);
+
+                    if (k < high) {
+                        continue;
+                    }
+                }
+
+                /*
+                 * Check special cases.
+                 */
+                if (run == null) {
+                    if (k == high) {
+
+                        /*
+                         * The array is monotonous sequence,
+                         * and therefore already sorted.
+                         */
+                        return true;
+                    }
+
+                    if (k - low < MIN_FIRST_RUN_SIZE) {
+
+                        /*
+                         * The first run is too small
+                         * to proceed with scanning.
+                         */
+                        return false;
+                    }
+
+                    capacity = ((size >> 10) | 0x7F) & 0x3FF;
+                    run = allocate<gint>(capacity);
+                    run[0] = low;
+
+                } else if (a[last - 1] > a[last]) {
+
+                    if (count > (k - low) >> MIN_FIRST_RUNS_FACTOR) {
+
+                        /*
+                         * The first runs are not long
+                         * enough to continue scanning.
+                         */
+                        release(run);
+                        return false;
+                    }
+
+                    if (++count == MAX_RUN_CAPACITY) {
+
+                        /*
+                         * Array is not highly structured.
+                         */
+                        release(run);
+                        return false;
+                    }
+
+                    if (count == capacity) {
+
+                        /*
+                         * Increase capacity of index array.
+                         */
+                        capacity = count << 1;
+                        run = (gint *) Unsafe::reallocateMemory((glong) run, (glong) capacity * (glong) sizeof(gint));
+                    }
+                }
+                run[count] = (last = k);
+            }
+
+            /*
+             * Merge runs of highly structured array.
+             */
+            if (count > 1) {
+                T *b = null;
+                gint offset = low;
+
+                if (sorter == null || (b = sorter->b) == null) {
+                    b = allocate<T>(size);
+                    mergeRuns(a, b, offset, 1, sorter != null, run, 0, count);
+                    release(b);
+                } else {
+                    offset = sorter->offset;
+                    mergeRuns(a, b, offset, 1, true, run, 0, count);
+                }
+            }
+            release(run);
+            return true;
+        }
+
+        template<class T>
+        T *DualPivotQuicksort::mergeRuns(T *a, T *b, gint offset, gint aim, gbool parallel, gint *run, gint lo,
+                                         gint hi) {
+            if (hi - lo == 1) {
+                if (aim >= 0) {
+                    return a;
+                }
+                for (gint i = run[hi], j = i - offset, low = run[lo]; i > low;) {
+                    b[--j] = a[--i];
+                }
+                return b;
+            }
+
+            /*
+             * Split into approximately equal parts.
+             */
+            gint mi = lo;
+            gint const rmi = (gint) ((GENERIC_UINT32) (run[lo] + run[hi]) >> 1);
+            while (run[++mi + 1] <= rmi);
+
+            /*
+             * Merge the left and right parts.
+             */
+            T *a1 = null;
+            T *a2 = null;
+
+            if (parallel && hi - lo > MIN_RUN_COUNT) {
+                RunMerger<T> merger(a, b, offset, 0, run, mi, hi);
+                merger.fork();
+                a1 = mergeRuns(a, b, offset, -aim, true, run, lo, mi);
+                a2 = merger.destination();
+            } else {
+                a1 = mergeRuns(a, b, offset, -aim, false, run, lo, mi);
+                a2 = mergeRuns(a, b, offset, 0, false, run, mi, hi);
+            }
+
+            T *const dst = a1 == a ? b : a;
+
+            gint const k = a1 == a ? run[lo] - offset : run[lo];
+            gint const lo1 = a1 == b ? run[lo] - offset : run[lo];
+            gint const hi1 = a1 == b ? run[mi] - offset : run[mi];
+            gint const lo2 = a2 == b ? run[mi] - offset : run[mi];
+            gint const hi2 = a2 == b ? run[hi] - offset : run[hi];
+
+            if (parallel) {
+                Merger<T> merger(null, dst, k, a1, lo1, hi1, a2, lo2, hi2);
+                merger.invoke();
+            } else {
+                mergeParts((Merger<T> *) null, dst, k, a1, lo1, hi1, a2, lo2, hi2);
+            }
+            return dst;
+        }
+
+        template<class T>
+        void DualPivotQuicksort::mergeParts(Merger<T> *merger, T *dst, gint k, T *a1, gint lo1, gint hi1, T *a2,
+                                            gint lo2, gint hi2) {
+            if (merger != null && a1 == a2) {
+                while (true) {
+
+                    /*
+                     * The first part must be larger.
+                     */
+                    if (hi1 - lo1 < hi2 - lo2) {
+                        gint const lo = lo1;
+                        lo1 = lo2;
+                        lo2 = lo;
+                        gint const hi = hi1;
+                        hi1 = hi2;
+                        hi2 = hi;
+                    }
+
+                    /*
+                     * Small parts will be merged sequentially.
+                     */
+                    if (hi1 - lo1 < MIN_PARALLEL_MERGE_PARTS_SIZE) {
+                        break;
+                    }
+
+                    /*
+                     * Find the median of the larger part.
+                     */
+                    gint const mi1 = (gint) ((GENERIC_UINT32) (lo1 + hi1) >> 1);
+                    T const key = a1[mi1];
+                    gint mi2 = hi2;
+
+                    /*
+                     * Partition the smaller part.
+                     */
+                    for (gint loo = lo2; loo < mi2;) {
+                        gint const t = (gint) ((GENERIC_UINT32) (loo + mi2) >> 1);
+
+                        if (key > a2[t]) {
+                            loo = t + 1;
+                        } else {
+                            mi2 = t;
+                        }
+                    }
+
+                    gint const d = mi2 - lo2 + mi1 - lo1;
+
+                    /*
+                     * Merge the right sub-parts in parallel.
+                     */
+                    merger->forkMerger(dst, k + d, a1, mi1, hi1, a2, mi2, hi2);
+
+                    /*
+                     * Process the sub-left parts.
+                     */
+                    hi1 = mi1;
+                    hi2 = mi2;
+                }
+            }
+
+            /*
+             * Merge small parts sequentially.
+             */
+            while (lo1 < hi1 && lo2 < hi2) {
+                dst[k++] = a1[lo1] < a2[lo2] ? a1[lo1++] : a2[lo2++];
+            }
+            if (dst != a1 || k < lo1) {
+                while (lo1 < hi1) {
+                    dst[k++] = a1[lo1++];
+                }
+            }
+            if (dst != a2 || k < lo2) {
+                while (lo2 < hi2) {
+                    dst[k++] = a2[lo2++];
+                }
+            }
+        }
+
     } // util
 } // core
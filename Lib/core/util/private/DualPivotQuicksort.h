@@ -19,7 +19,7 @@ namespace core {
          *
          * There are also additional algorithms, invoked from the Dual-Pivot
          * Quicksort, such as mixed insertion sort, merging of runs and heap
-         * sort, counting sort and parallel merge sort.
+         * sort, counting sort, radix sort and parallel merge sort.
          *
          * @author Vladimir Yaroslavskiy
          * @author Jon Bentley
@@ -87,6 +87,12 @@ namespace core {
              */
             static CORE_FAST int MIN_SHORT_OR_CHAR_COUNTING_SORT_SIZE = 1750;
 
+            /**
+             * Min size of an int or float array to use radix sort (for
+             * sequential sorting), doubled for long and double arrays.
+             */
+            static CORE_FAST int MIN_RADIX_SORT_SIZE = 1 << 10;
+
             /**
              * Threshold of mixed insertion sort is incremented by this value.
              */
@@ -107,6 +113,8 @@ namespace core {
              */
             static gint depth(gint parallelism, gint size);
 
+        public:
+
             /**
              * Sorts the specified range of the array using parallel merge
              * sort and/or Dual-Pivot Quicksort.
@@ -122,25 +130,135 @@ namespace core {
              * @param low the index of the first element, inclusive, to be sorted
              * @param high the index of the last element, exclusive, to be sorted
              */
-            static gint sort(IntArray &a, gint parallelism, gint low, gint high);
+            static void sort(IntArray &a, gint parallelism, gint low, gint high);
 
-        public:
+            /**
+             * Sorts the specified range of the array using parallel merge
+             * sort and/or Dual-Pivot Quicksort.
+             *
+             * @param a the array to be sorted
+             * @param parallelism the parallelism level
+             * @param low the index of the first element, inclusive, to be sorted
+             * @param high the index of the last element, exclusive, to be sorted
+             */
+            static void sort(LongArray &a, gint parallelism, gint low, gint high);
+
+            /**
+             * Sorts the specified range of the array using parallel merge
+             * sort and/or Dual-Pivot Quicksort.
+             *
+             * The NaN values are moved to the end of the range, and the -0.0
+             * values are placed before the 0.0 values (the order of
+             * Float::compare).
+             *
+             * @param a the array to be sorted
+             * @param parallelism the parallelism level
+             * @param low the index of the first element, inclusive, to be sorted
+             * @param high the index of the last element, exclusive, to be sorted
+             */
+            static void sort(FloatArray &a, gint parallelism, gint low, gint high);
+
+            /**
+             * Sorts the specified range of the array using parallel merge
+             * sort and/or Dual-Pivot Quicksort.
+             *
+             * The NaN values are moved to the end of the range, and the -0.0
+             * values are placed before the 0.0 values (the order of
+             * Double::compare).
+             *
+             * @param a the array to be sorted
+             * @param parallelism the parallelism level
+             * @param low the index of the first element, inclusive, to be sorted
+             * @param high the index of the last element, exclusive, to be sorted
+             */
+            static void sort(DoubleArray &a, gint parallelism, gint low, gint high);
+
+            /**
+             * Sorts the specified range of the array using counting sort
+             * or Dual-Pivot Quicksort (for small ranges).
+             *
+             * @param a the array to be sorted
+             * @param low the index of the first element, inclusive, to be sorted
+             * @param high the index of the last element, exclusive, to be sorted
+             */
+            static void sort(ByteArray &a, gint low, gint high);
+
+            /**
+             * Sorts the specified range of the array using counting sort
+             * or Dual-Pivot Quicksort (for small ranges).
+             *
+             * @param a the array to be sorted
+             * @param low the index of the first element, inclusive, to be sorted
+             * @param high the index of the last element, exclusive, to be sorted
+             */
+            static void sort(CharArray &a, gint low, gint high);
+
+            /**
+             * Sorts the specified range of the array using counting sort
+             * or Dual-Pivot Quicksort (for small ranges).
+             *
+             * @param a the array to be sorted
+             * @param low the index of the first element, inclusive, to be sorted
+             * @param high the index of the last element, exclusive, to be sorted
+             */
+            static void sort(ShortArray &a, gint low, gint high);
+
+        private:
+
+            template<class T>
             class Sorter;
 
+            template<class T>
+            class Merger;
+
+            template<class T>
+            class RunMerger;
+
+            /**
+             * Sorts the specified range of the array using parallel merge
+             * sort and/or Dual-Pivot Quicksort: if the parallelism level and
+             * the size of the range are large enough, the sorting is executed
+             * on a fork/join pool of <b style="color: orange;"> parallelism</b>
+             * threads, otherwise it is executed sequentially, with radix sort
+             * for the large ranges that are not made of a few runs.
+             *
+             * @param a the array to be sorted
+             * @param parallelism the parallelism level
+             * @param low the index of the first element, inclusive, to be sorted
+             * @param high the index of the last element, exclusive, to be sorted
+             */
+            template<class T>
+            static void sort(T *a, gint parallelism, gint low, gint high);
+
             /**
              * Sorts the specified array using the Dual-Pivot Quicksort and/or
              * other sorts in special-cases, possibly with parallel partitions.
              *
-             * @param sorter parallel context
+             * The elements are accessed directly in the storage of the array
+             * (without bounds checks).
+             *
+             * @param sorter parallel context (null for sequential sorting)
              * @param a the array to be sorted
              * @param bits the combination of recursion depth and bit flag, where
              *        the right bit "0" indicates that array is the leftmost part
              * @param low the index of the first element, inclusive, to be sorted
              * @param high the index of the last element, exclusive, to be sorted
              */
-            static void sort(Sorter const &sorter, IntArray &a, gint bits, gint low, gint high);
+            template<class T>
+            static void sort(Sorter<T> *sorter, T *a, gint bits, gint low, gint high);
 
-        private:
+            /**
+             * Sorts the specified range of the floating-point array: the NaN values
+             * are moved to the end, the -0.0 values are replaced by 0.0 while the
+             * other values are sorted, then restored before them.
+             *
+             * @param a the array to be sorted
+             * @param parallelism the parallelism level
+             * @param low the index of the first element, inclusive, to be sorted
+             * @param high the index of the last element, exclusive, to be sorted
+             */
+            template<class T>
+            static void sortFloating(T *a, gint parallelism, gint low, gint high);
 
             /**
              * Sorts the specified range of the array using mixed insertion sort.
@@ -159,7 +277,33 @@ namespace core {
              * @param end the index of the last element for simple insertion sort
              * @param high the index of the last element, exclusive, to be sorted
              */
-            static void mixedInsertionSort(IntArray &a, int low, int end, int high);
+            template<class T>
+            static void mixedInsertionSort(T *a, gint low, gint end, gint high);
+
+            /**
+             * Sorts the specified range of the array using counting sort.
+             *
+             * @param a the array to be sorted
+             * @param low the index of the first element, inclusive, to be sorted
+             * @param high the index of the last element, exclusive, to be sorted
+             */
+            template<class T>
+            static void countingSort(T *a, gint low, gint high);
+
+            /**
+             * Sorts the specified range of the array using LSD radix sort on
+             * bytes of the keys: the bits of the elements with the sign bit
+             * flipped (and the other bits flipped too for the negative
+             * floating-point values), whose unsigned order is the order of
+             * elements. The passes on a byte common to all keys are skipped.
+             * The NaN values are not supported.
+             *
+             * @param a the array to be sorted
+             * @param low the index of the first element, inclusive, to be sorted
+             * @param high the index of the last element, exclusive, to be sorted
+             */
+            template<class T>
+            static void radixSort(T *a, gint low, gint high);
 
             /**
              * Sorts the specified range of the array using insertion sort.
@@ -168,7 +312,8 @@ namespace core {
              * @param low the index of the first element, inclusive, to be sorted
              * @param high the index of the last element, exclusive, to be sorted
              */
-            static void insertionSort(IntArray a, int low, int high);
+            template<class T>
+            static void insertionSort(T *a, gint low, gint high);
 
             /**
              * Sorts the specified range of the array using heap sort.
@@ -177,7 +322,8 @@ namespace core {
              * @param low the index of the first element, inclusive, to be sorted
              * @param high the index of the last element, exclusive, to be sorted
              */
-            static void heapSort(IntArray &a, int low, int high);
+            template<class T>
+            static void heapSort(T *a, gint low, gint high);
 
             /**
              * Pushes specified element down during heap sort.
@@ -188,7 +334,8 @@ namespace core {
              * @param low the index of the first element, inclusive, to be sorted
              * @param high the index of the last element, exclusive, to be sorted
              */
-            static void pushDown(IntArray &a, int p, int value, int low, int high);
+            template<class T>
+            static void pushDown(T *a, gint p, T value, gint low, gint high);
 
             /**
              * Tries to sort the specified range of the array.
@@ -199,7 +346,8 @@ namespace core {
              * @param size the array size
              * @return true if finally sorted, false otherwise
              */
-            static gbool tryMergeRuns(Sorter const &sorter, IntArray a, int low, int size);
+            template<class T>
+            static gbool tryMergeRuns(Sorter<T> *sorter, T *a, gint low, gint size);
 
             /**
              * Merges the specified runs.
@@ -214,10 +362,8 @@ namespace core {
              * @param hi the start index of the last run, inclusive
              * @return the destination where runs are merged
              */
-            static IntArray mergeRuns(IntArray &a, IntArray &b, int offset,
-                                      int aim, gbool parallel, IntArray &run, int lo, int hi);
-
-            class Merger;
+            template<class T>
+            static T *mergeRuns(T *a, T *b, gint offset, gint aim, gbool parallel, gint *run, gint lo, gint hi);
 
             /**
              * Merges the sorted parts.
@@ -232,8 +378,8 @@ namespace core {
              * @param lo2 the start index of the second part, inclusive
              * @param hi2 the end index of the second part, exclusive
              */
-            static void mergeParts(Merger merger, IntArray dst, int k,
-                                   IntArray a1, int lo1, int hi1, IntArray a2, int lo2, int hi2);
+            template<class T>
+            static void mergeParts(Merger<T> *merger, T *dst, gint k, T *a1, gint lo1, gint hi1, T *a2, gint lo2, gint hi2);
         };
 
     } // util
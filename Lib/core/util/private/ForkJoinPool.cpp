@@ -0,0 +1,305 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include "ForkJoinPool.h"
+#include <core/private/Unsafe.h>
+
+#ifdef CORE_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+namespace core {
+    namespace util {
+
+        using native::Unsafe;
+
+        namespace {
+
+            /*
+             * The atomic operations on the counters of pool (sequentially consistent).
+             */
+
+            gint load(gint const volatile &x) {
+#ifdef CORE_COMPILER_MSVC
+                return (gint) _InterlockedOr((long volatile *) &x, 0);
+#else
+                return __atomic_load_n(&x, __ATOMIC_SEQ_CST);
+#endif
+            }
+
+            void store(gint volatile &x, gint value) {
+#ifdef CORE_COMPILER_MSVC
+                _InterlockedExchange((long volatile *) &x, value);
+#else
+                __atomic_store_n(&x, value, __ATOMIC_SEQ_CST);
+#endif
+            }
+
+            gbool compareAndSet(gint volatile &x, gint expected, gint value) {
+#ifdef CORE_COMPILER_MSVC
+                return _InterlockedCompareExchange((long volatile *) &x, value, expected) == expected;
+#else
+                return __atomic_compare_exchange_n(&x, &expected, value, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif
+            }
+
+            gint getAndAdd(gint volatile &x, gint delta) {
+#ifdef CORE_COMPILER_MSVC
+                return (gint) _InterlockedExchangeAdd((long volatile *) &x, delta);
+#else
+                return __atomic_fetch_add(&x, delta, __ATOMIC_SEQ_CST);
+#endif
+            }
+        }
+
+        /**
+         * The deque of tasks of a worker, protected by a spin lock.
+         */
+        class ForkJoinPool::Worker CORE_FINAL {
+        public:
+            ForkJoinPool *pool = null;
+            gint index = 0;
+            glong thread = 0;
+            gint volatile lock = 0;
+
+            /**
+             * The number of tasks in deque (readable without lock).
+             */
+            gint volatile size = 0;
+
+            Task **tasks = null;
+            gint base = 0;
+            gint top = 0;
+            gint capacity = 0;
+
+            void acquire() {
+                while (!compareAndSet(lock, 0, 1))
+                    Unsafe::yieldThread();
+            }
+
+            void release() {
+                store(lock, 0);
+            }
+
+            void push(Task *task) {
+                acquire();
+                if (top == capacity) {
+                    if (base > 0) {
+                        // reuse the place of stolen tasks
+                        for (gint i = base; i < top; ++i)
+                            tasks[i - base] = tasks[i];
+                        top -= base;
+                        base = 0;
+                    } else {
+                        gint const newCapacity = capacity == 0 ? 64 : capacity << 1;
+                        Task **newTasks = new Task *[newCapacity];
+                        for (gint i = 0; i < top; ++i)
+                            newTasks[i] = tasks[i];
+                        delete[] tasks;
+                        tasks = newTasks;
+                        capacity = newCapacity;
+                    }
+                }
+                tasks[top++] = task;
+                store(size, top - base);
+                release();
+            }
+
+            /**
+             * Remove the newest task (from the owner).
+             */
+            Task *pop() {
+                if (load(size) == 0)
+                    return null;
+                Task *task = null;
+                acquire();
+                if (top > base) {
+                    task = tasks[--top];
+                    store(size, top - base);
+                }
+                release();
+                return task;
+            }
+
+            /**
+             * Remove the oldest task (from the thieves).
+             */
+            Task *poll() {
+                if (load(size) == 0)
+                    return null;
+                Task *task = null;
+                acquire();
+                if (top > base) {
+                    task = tasks[base++];
+                    store(size, top - base);
+                }
+                release();
+                return task;
+            }
+
+            ~Worker() {
+                delete[] tasks;
+            }
+        };
+
+        thread_local ForkJoinPool::Worker *ForkJoinPool::current = null;
+
+        ForkJoinPool::ForkJoinPool(gint parallelism) :
+                parallelism(parallelism < 1 ? 1 : parallelism), workers(null), active(0) {
+            workers = new Worker[this->parallelism];
+            for (gint i = 0; i < this->parallelism; ++i) {
+                workers[i].pool = this;
+                workers[i].index = i;
+            }
+        }
+
+        void ForkJoinPool::invoke(Task &task) {
+            gint const last = parallelism - 1;
+            store(active, 1);
+            for (gint i = 0; i < last; ++i)
+                workers[i].thread = Unsafe::startThread(&run, (glong) &workers[i]);
+            Worker *const previous = current;
+            current = &workers[last];
+            task.invoke();
+            current = previous;
+            store(active, 0);
+            for (gint i = 0; i < last; ++i) {
+                if (workers[i].thread != 0)
+                    Unsafe::joinThread(workers[i].thread);
+                workers[i].thread = 0;
+            }
+        }
+
+        gint ForkJoinPool::getParallelism() const {
+            return parallelism;
+        }
+
+        gint ForkJoinPool::defaultParallelism() {
+            return Unsafe::availableProcessors();
+        }
+
+        ForkJoinPool::Task *ForkJoinPool::scan(Worker &worker) {
+            Task *task = worker.pop();
+            for (gint i = 1; task == null && i < parallelism; ++i)
+                task = workers[(worker.index + i) % parallelism].poll();
+            return task;
+        }
+
+        void ForkJoinPool::run(glong worker) {
+            Worker &w = *(Worker *) worker;
+            ForkJoinPool &pool = *w.pool;
+            current = &w;
+            while (load(pool.active) > 0) {
+                Task *task = pool.scan(w);
+                if (task != null)
+                    task->compute();
+                else
+                    Unsafe::yieldThread();
+            }
+            current = null;
+        }
+
+        ForkJoinPool::~ForkJoinPool() {
+            delete[] workers;
+        }
+
+        ForkJoinPool::Task::Task(Task *completer) : completer(completer), pending(0), status(0) {}
+
+        void ForkJoinPool::Task::onCompletion(Task &) {}
+
+        void ForkJoinPool::Task::addToPendingCount(gint delta) {
+            getAndAdd(pending, delta);
+        }
+
+        void ForkJoinPool::Task::setPendingCount(gint count) {
+            store(pending, count);
+        }
+
+        void ForkJoinPool::Task::tryComplete() {
+            Task *a = this;
+            Task *s = a;
+            for (;;) {
+                gint const c = load(a->pending);
+                if (c == 0) {
+                    a->onCompletion(*s);
+                    if (s != a)
+                        delete s;
+                    s = a;
+                    a = a->completer;
+                    if (a == null) {
+                        // the root is owned by its creator, that may destroy it as soon as it is done
+                        store(s->status, 1);
+                        return;
+                    }
+                } else if (compareAndSet(a->pending, c, c - 1)) {
+                    if (s != a)
+                        delete s;
+                    return;
+                }
+            }
+        }
+
+        void ForkJoinPool::Task::propagateCompletion() {
+            Task *a = this;
+            Task *s = a;
+            for (;;) {
+                gint const c = load(a->pending);
+                if (c == 0) {
+                    if (s != a)
+                        delete s;
+                    s = a;
+                    a = a->completer;
+                    if (a == null) {
+                        store(s->status, 1);
+                        return;
+                    }
+                } else if (compareAndSet(a->pending, c, c - 1)) {
+                    if (s != a)
+                        delete s;
+                    return;
+                }
+            }
+        }
+
+        void ForkJoinPool::Task::complete() {
+            onCompletion(*this);
+            Task *const c = completer;
+            if (c == null) {
+                store(status, 1);
+                return;
+            }
+            delete this;
+            c->tryComplete();
+        }
+
+        void ForkJoinPool::Task::fork() {
+            Worker *const w = current;
+            if (w == null)
+                compute();
+            else
+                w->push(this);
+        }
+
+        void ForkJoinPool::Task::join() {
+            Worker *const w = current;
+            while (!isDone()) {
+                Task *task = w == null ? null : w->pool->scan(*w);
+                if (task != null)
+                    task->compute();
+                else
+                    Unsafe::yieldThread();
+            }
+        }
+
+        void ForkJoinPool::Task::invoke() {
+            compute();
+            join();
+        }
+
+        gbool ForkJoinPool::Task::isDone() const {
+            return load(status) > 0;
+        }
+
+    } // util
+} // core
@@ -0,0 +1,209 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#ifndef CORE23_FORKJOINPOOL_H
+#define CORE23_FORKJOINPOOL_H
+
+#include <core/Object.h>
+
+namespace core {
+    namespace util {
+
+        /**
+         * A minimal fork/join pool used by the parallel algorithms of class
+         * Arrays (parallelSort, parallelPrefix, ...).
+         *
+         * <p>The pool starts <b style="color: orange;"> parallelism - 1</b> worker
+         * threads for the duration of <b style="color: orange;"> invoke</b>, the
+         * calling thread being the last worker. Each worker owns a deque of tasks:
+         * the tasks forked by a worker are pushed on (and popped from) the top of
+         * its own deque, and the idle workers steal the oldest tasks from the
+         * bottom of the other deques. A worker waiting for a task executes the
+         * pending tasks instead of blocking.
+         *
+         * <p>The tasks follow the completion model of the Java CountedCompleter:
+         * each task has a completer (the task that forked it, or null for the
+         * root) and a count of pending child tasks. A task is completed when its
+         * own computation and all its pending children are terminated, which
+         * triggers its <b style="color: orange;"> onCompletion</b> and then the
+         * completion of its completer.
+         *
+         * @author Brunshweeck Tazeussong
+         */
+        class ForkJoinPool CORE_FINAL : public Object {
+        public:
+
+            class Task;
+
+        private:
+            class Worker;
+
+            /**
+             * The number of workers (including the invoking thread).
+             */
+            gint parallelism;
+
+            /**
+             * The workers of this pool.
+             */
+            Worker *workers;
+
+            /**
+             * The state of this pool: positive while the workers must run.
+             */
+            gint volatile active;
+
+            /**
+             * The worker executed by the current thread (null if none).
+             */
+            static thread_local Worker *current;
+
+            /**
+             * Take a task from the deque of given worker, or steal one from the others.
+             */
+            Task *scan(Worker &worker);
+
+            static void run(glong worker);
+
+        public:
+
+            /**
+             * Create new pool with given parallelism level (the number of threads
+             * executing the tasks, at least one).
+             */
+            CORE_EXPLICIT ForkJoinPool(gint parallelism);
+
+            /**
+             * Start the workers of this pool, execute the given root task on the
+             * current thread and wait for its completion (executing the other
+             * tasks meanwhile), then stop the workers.
+             *
+             * <p>If the workers can not be started, the tasks are executed by the
+             * current thread only.
+             */
+            void invoke(Task &task);
+
+            /**
+             * Return the parallelism level of this pool.
+             */
+            gint getParallelism() const;
+
+            /**
+             * Return the default parallelism level: the number of available processors.
+             */
+            static gint defaultParallelism();
+
+            ~ForkJoinPool() override;
+        };
+
+        /**
+         * A task executed by fork/join pool.
+         *
+         * <p>The method <b style="color: orange;"> compute</b> must be terminated
+         * by <b style="color: orange;"> tryComplete</b>, <b style="color: orange;">
+         * propagateCompletion</b> or <b style="color: orange;"> complete</b>, and
+         * must not access the task after that call: the tasks that have a
+         * completer are created with operator new, and are deleted by the pool
+         * once completed. The root tasks (without completer) are owned by their
+         * creator, that waits for their completion with <b style="color: orange;">
+         * invoke</b> or <b style="color: orange;"> join</b>.
+         */
+        class ForkJoinPool::Task : public Object {
+        private:
+            /**
+             * The task to complete after this one.
+             */
+            Task *completer;
+
+            /**
+             * The number of pending tasks before completion.
+             */
+            gint volatile pending;
+
+            /**
+             * The completion status: positive when this task is done.
+             */
+            gint volatile status;
+
+            friend ForkJoinPool;
+
+        protected:
+
+            /**
+             * Create new task with given completer (null for the root tasks).
+             */
+            CORE_EXPLICIT Task(Task *completer);
+
+        public:
+
+            /**
+             * The main computation performed by this task.
+             */
+            virtual void compute() = 0;
+
+            /**
+             * Perform an action when this task is completed, the caller is the
+             * last completed task (this task or one of its children).
+             */
+            virtual void onCompletion(Task &caller);
+
+            /**
+             * Add the given value to the number of pending tasks.
+             */
+            void addToPendingCount(gint delta);
+
+            /**
+             * Set the number of pending tasks.
+             */
+            void setPendingCount(gint count);
+
+            /**
+             * If the number of pending tasks is positive, decrement it, otherwise
+             * invoke <b style="color: orange;"> onCompletion</b> and try to complete
+             * the completer of this task in the same way.
+             */
+            void tryComplete();
+
+            /**
+             * Equivalent to <b style="color: orange;"> tryComplete</b> but does not
+             * invoke <b style="color: orange;"> onCompletion</b> along the completion path.
+             */
+            void propagateCompletion();
+
+            /**
+             * Complete this task regardless of the number of pending tasks, then try
+             * to complete its completer.
+             */
+            void complete();
+
+            /**
+             * Arrange to asynchronously execute this task in the pool of the current
+             * thread, or execute it immediately if the current thread is not a worker.
+             */
+            void fork();
+
+            /**
+             * Wait for the completion of this task, executing the pending tasks of
+             * the pool meanwhile.
+             */
+            void join();
+
+            /**
+             * Execute this task on the current thread and wait for its completion.
+             */
+            void invoke();
+
+            /**
+             * Return true if this task is completed.
+             */
+            gbool isDone() const;
+
+            ~Task() override = default;
+
+        };
+
+    } // util
+} // core
+
+#endif //CORE23_FORKJOINPOOL_H
@@ -0,0 +1,852 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#ifndef CORE23_TIMSORT_H
+#define CORE23_TIMSORT_H
+
+#include <core/native/ObjectArray.h>
+#include <core/IllegalArgumentException.h>
+#include <core/private/Unsafe.h>
+
+namespace core {
+    namespace util {
+
+        /**
+         * A stable, adaptive, iterative mergesort that requires far fewer than
+         * n lg(n) comparisons when running on partially sorted arrays, while
+         * offering performance comparable to a traditional mergesort when run
+         * on random arrays.  Like all proper mergesorts, this sort is stable and
+         * runs O(n log n) time (worst case).  In the worst case, this sort requires
+         * temporary storage space for n/2 object references; in the best case,
+         * it requires only a small constant amount of space.
+         *
+         * <p>This implementation was adapted from Tim Peters's list sort for
+         * Python, which is described in detail here:
+         *
+         *   http://svn.python.org/projects/python/trunk/Objects/listsort.txt
+         *
+         * <p>Tim's C code may be found here:
+         *
+         *   http://svn.python.org/projects/python/trunk/Objects/listobject.c
+         *
+         * <p>The underlying techniques are described in this paper (and may have
+         * even earlier origins):
+         *
+         *  "Optimistic Sorting and Information Theoretic Complexity"
+         *  Peter McIlroy
+         *  SODA (Fourth Annual ACM-SIAM Symposium on Discrete Algorithms),
+         *  pp 467-474, Austin, Texas, 25-27 January 1993.
+         *
+         * <p>Only the references of elements are moved (in the storage of the
+         * array and in the temporary buffer, reused by all merges of a sorting),
+         * the elements themselves are never copied.
+         *
+         * @tparam E the class of the elements compared
+         * @tparam C the class of the comparator, providing the method
+         *          <b> gint compare(const E &, const E &) const</b>
+         *
+         * @author Josh Bloch
+         */
+        template<class E, class C>
+        class TimSort CORE_FINAL : public Object {
+        private:
+            CORE_ALIAS(REF, typename Class<Object>::Pointer);
+            CORE_ALIAS(VALUE, typename Class<REF>::Pointer);
+
+            /**
+             * This is the minimum sized sequence that will be merged.  Shorter
+             * sequences will be lengthened by calling binarySort.  If the entire
+             * array is less than this length, no merges will be performed.
+             *
+             * This constant should be a power of two.  It was 64 in Tim Peter's C
+             * implementation, but 32 was empirically determined to work better in
+             * this implementation.
+             */
+            static CORE_FAST gint MIN_MERGE = 32;
+
+            /**
+             * This controls when we get *into* galloping mode.  It is initialized
+             * to MIN_GALLOP.  The mergeLo and mergeHi methods nudge it higher for
+             * random data, and lower for highly structured data.
+             */
+            static CORE_FAST gint MIN_GALLOP = 7;
+
+            /**
+             * Maximum initial size of tmp array, which is used for merging.  The
+             * array can grow to accommodate demand.
+             */
+            static CORE_FAST gint INITIAL_TMP_STORAGE_LENGTH = 256;
+
+            /**
+             * Maximum number of pending runs: enough for arrays of length
+             * Integer::MAX_VALUE, given the invariants on run lengths.
+             */
+            static CORE_FAST gint MAX_STACK_LENGTH = 49;
+
+            /**
+             * The storage of array being sorted.
+             */
+            VALUE const a;
+
+            /**
+             * The comparator for this sort.
+             */
+            C const &c;
+
+            /**
+             * The length of range being sorted.
+             */
+            gint const length;
+
+            /**
+             * The current galloping threshold.
+             */
+            gint minGallop;
+
+            /**
+             * Temp storage for merges, reused by all merges.
+             */
+            VALUE tmp;
+            gint tmpLen;
+
+            /**
+             * A stack of pending runs yet to be merged.  Run i starts at
+             * address base[i] and extends for len[i] elements.  It's always
+             * true (so long as the indices are in bounds) that:
+             *
+             *     runBase[i] + runLen[i] == runBase[i + 1]
+             */
+            gint stackSize;
+            gint runBase[MAX_STACK_LENGTH];
+            gint runLen[MAX_STACK_LENGTH];
+
+            /**
+             * Creates a TimSort instance to maintain the state of an ongoing sort.
+             *
+             * @param a the storage of array to be sorted
+             * @param c the comparator to determine the order of the sort
+             * @param length the length of range to be sorted
+             */
+            CORE_EXPLICIT TimSort(VALUE a, C const &c, gint length) :
+                    a(a), c(c), length(length), minGallop(MIN_GALLOP), tmp(null), tmpLen(0), stackSize(0) {
+                gint const tlen = length < 2 * INITIAL_TMP_STORAGE_LENGTH ? length >> 1 : INITIAL_TMP_STORAGE_LENGTH;
+                tmp = (VALUE) Unsafe::allocateMemory((glong) tlen * (glong) sizeof(REF));
+                tmpLen = tlen;
+            }
+
+        public:
+
+            /**
+             * Sorts the given range, moving only the references of elements.
+             * The range is not checked.
+             *
+             * @param array the array in which a range is to be sorted
+             * @param lo the index of the first element, inclusive, to be sorted
+             * @param hi the index of the last element, exclusive, to be sorted
+             * @param c the comparator to use
+             * @throws IllegalArgumentException if the comparator is found to
+             *         violate its contract
+             */
+            static void sort(ObjectArray &array, gint lo, gint hi, C const &c) {
+                gint nRemaining = hi - lo;
+                if (nRemaining < 2)
+                    return;  // Arrays of size 0 and 1 are always sorted
+
+                VALUE const a = array.value;
+
+                // If array is small, do a "mini-TimSort" with no merges
+                if (nRemaining < MIN_MERGE) {
+                    gint const initRunLen = countRunAndMakeAscending(a, lo, hi, c);
+                    binarySort(a, lo, hi, lo + initRunLen, c);
+                    return;
+                }
+
+                /*
+                 * March over the array once, left to right, finding natural runs,
+                 * extending short natural runs to minRun elements, and merging runs
+                 * to maintain stack invariant.
+                 */
+                TimSort ts(a, c, nRemaining);
+                gint const minRun = minRunLength(nRemaining);
+                do {
+                    // Identify next run
+                    gint runLen = countRunAndMakeAscending(a, lo, hi, c);
+
+                    // If run is short, extend to min(minRun, nRemaining)
+                    if (runLen < minRun) {
+                        gint const force = nRemaining <= minRun ? nRemaining : minRun;
+                        binarySort(a, lo, lo + force, lo + runLen, c);
+                        runLen = force;
+                    }
+
+                    // Push run onto pending-run stack, and maybe merge
+                    ts.pushRun(lo, runLen);
+                    ts.mergeCollapse();
+
+                    // Advance to find next run
+                    lo += runLen;
+                    nRemaining -= runLen;
+                } while (nRemaining != 0);
+
+                // Merge all remaining runs to complete sort
+                ts.mergeForceCollapse();
+            }
+
+            ~TimSort() override {
+                Unsafe::freeMemory((glong) tmp);
+            }
+
+        private:
+
+            /**
+             * Compares the elements of the given references.
+             */
+            static gint compare(C const &c, REF x, REF y) {
+                return c.compare(CORE_DYN_CAST(E const &, *x), CORE_DYN_CAST(E const &, *y));
+            }
+
+            /**
+             * Copies the given number of references, the ranges may overlap.
+             */
+            static void arraycopy(VALUE src, gint srcPos, VALUE dest, gint destPos, gint count) {
+                if (src == dest && srcPos < destPos) {
+                    for (gint i = count - 1; i >= 0; --i)
+                        dest[destPos + i] = src[srcPos + i];
+                } else {
+                    for (gint i = 0; i < count; ++i)
+                        dest[destPos + i] = src[srcPos + i];
+                }
+            }
+
+            /**
+             * Sorts the specified portion of the specified array using a binary
+             * insertion sort.  This is the best method for sorting small numbers
+             * of elements.  It requires O(n log n) compares, but O(n^2) data
+             * movement (worst case).
+             *
+             * If the initial part of the specified range is already sorted,
+             * this method can take advantage of it: the method assumes that the
+             * elements from index <b> lo</b>, inclusive, to <b> start</b>,
+             * exclusive are already sorted.
+             *
+             * @param a the array in which a range is to be sorted
+             * @param lo the index of the first element in the range to be sorted
+             * @param hi the index after the last element in the range to be sorted
+             * @param start the index of the first element in the range that is
+             *        not already known to be sorted (<b> lo <= start <= hi</b>)
+             * @param c comparator to used for the sort
+             */
+            static void binarySort(VALUE a, gint lo, gint hi, gint start, C const &c) {
+                if (start == lo)
+                    start++;
+                for (; start < hi; start++) {
+                    REF const pivot = a[start];
+
+                    // Set left (and right) to the index where a[start] (pivot) belongs
+                    gint left = lo;
+                    gint right = start;
+                    /*
+                     * Invariants:
+                     *   pivot >= all in [lo, left).
+                     *   pivot <  all in [right, start).
+                     */
+                    while (left < right) {
+                        gint const mid = (gint) ((GENERIC_UINT32) (left + right) >> 1);
+                        if (compare(c, pivot, a[mid]) < 0)
+                            right = mid;
+                        else
+                            left = mid + 1;
+                    }
+
+                    /*
+                     * The invariants still hold: pivot >= all in [lo, left) and
+                     * pivot < all in [left, start), so pivot belongs at left.  Note
+                     * that if there are elements equal to pivot, left points to the
+                     * first slot after them -- that's why this sort is stable.
+                     * Slide elements over to make room for pivot.
+                     */
+                    arraycopy(a, left, a, left + 1, start - left);
+                    a[left] = pivot;
+                }
+            }
+
+            /**
+             * Returns the length of the run beginning at the specified position in
+             * the specified array and reverses the run if it is descending (ensuring
+             * that the run will always be ascending when the method returns).
+             *
+             * A run is the longest ascending sequence with:
+             *
+             *    a[lo] <= a[lo + 1] <= a[lo + 2] <= ...
+             *
+             * or the longest descending sequence with:
+             *
+             *    a[lo] >  a[lo + 1] >  a[lo + 2] >  ...
+             *
+             * For its intended use in a stable mergesort, the strictness of the
+             * definition of "descending" is needed so that the call can safely
+             * reverse a descending sequence without violating stability.
+             *
+             * @param a the array in which a run is to be counted and possibly reversed
+             * @param lo index of the first element in the run
+             * @param hi index after the last element that may be contained in the run.
+             *        It is required that <b> lo < hi</b>.
+             * @param c the comparator to used for the sort
+             * @return  the length of the run beginning at the specified position in
+             *          the specified array
+             */
+            static gint countRunAndMakeAscending(VALUE a, gint lo, gint hi, C const &c) {
+                gint runHi = lo + 1;
+                if (runHi == hi)
+                    return 1;
+
+                // Find end of run, and reverse range if descending
+                if (compare(c, a[runHi++], a[lo]) < 0) { // Descending
+                    while (runHi < hi && compare(c, a[runHi], a[runHi - 1]) < 0)
+                        runHi++;
+                    reverseRange(a, lo, runHi);
+                } else {                              // Ascending
+                    while (runHi < hi && compare(c, a[runHi], a[runHi - 1]) >= 0)
+                        runHi++;
+                }
+
+                return runHi - lo;
+            }
+
+            /**
+             * Reverse the specified range of the specified array.
+             *
+             * @param a the array in which a range is to be reversed
+             * @param lo the index of the first element in the range to be reversed
+             * @param hi the index after the last element in the range to be reversed
+             */
+            static void reverseRange(VALUE a, gint lo, gint hi) {
+                hi--;
+                while (lo < hi) {
+                    REF const t = a[lo];
+                    a[lo++] = a[hi];
+                    a[hi--] = t;
+                }
+            }
+
+            /**
+             * Returns the minimum acceptable run length for an array of the specified
+             * length. Natural runs shorter than this will be extended with
+             * binarySort.
+             *
+             * Roughly speaking, the computation is:
+             *
+             *  If n < MIN_MERGE, return n (it's too small to bother with fancy stuff).
+             *  Else if n is an exact power of 2, return MIN_MERGE/2.
+             *  Else return an int k, MIN_MERGE/2 <= k <= MIN_MERGE, such that n/k
+             *   is close to, but strictly less than, an exact power of 2.
+             *
+             * @param n the length of the array to be sorted
+             * @return the length of the minimum run to be merged
+             */
+            static gint minRunLength(gint n) {
+                gint r = 0;      // Becomes 1 if any 1 bits are shifted off
+                while (n >= MIN_MERGE) {
+                    r |= (n & 1);
+                    n >>= 1;
+                }
+                return n + r;
+            }
+
+            /**
+             * Pushes the specified run onto the pending-run stack.
+             *
+             * @param base index of the first element in the run
+             * @param len  the number of elements in the run
+             */
+            void pushRun(gint base, gint len) {
+                runBase[stackSize] = base;
+                runLen[stackSize] = len;
+                stackSize++;
+            }
+
+            /**
+             * Examines the stack of runs waiting to be merged and merges adjacent runs
+             * until the stack invariants are reestablished:
+             *
+             *     1. runLen[i - 3] > runLen[i - 2] + runLen[i - 1]
+             *     2. runLen[i - 2] > runLen[i - 1]
+             *
+             * This method is called each time a new run is pushed onto the stack,
+             * so the invariants are guaranteed to hold for i < stackSize upon
+             * entry to the method.
+             */
+            void mergeCollapse() {
+                while (stackSize > 1) {
+                    gint n = stackSize - 2;
+                    if ((n > 0 && runLen[n - 1] <= runLen[n] + runLen[n + 1])
+                        || (n > 1 && runLen[n - 2] <= runLen[n] + runLen[n - 1])) {
+                        if (runLen[n - 1] < runLen[n + 1])
+                            n--;
+                    } else if (runLen[n] > runLen[n + 1]) {
+                        break; // Invariant is established
+                    }
+                    mergeAt(n);
+                }
+            }
+
+            /**
+             * Merges all runs on the stack until only one remains.  This method is
+             * called once, to complete the sort.
+             */
+            void mergeForceCollapse() {
+                while (stackSize > 1) {
+                    gint n = stackSize - 2;
+                    if (n > 0 && runLen[n - 1] < runLen[n + 1])
+                        n--;
+                    mergeAt(n);
+                }
+            }
+
+            /**
+             * Merges the two runs at stack indices i and i+1.  Run i must be
+             * the penultimate or antepenultimate run on the stack.  In other words,
+             * i must be equal to stackSize-2 or stackSize-3.
+             *
+             * @param i stack index of the first of the two runs to merge
+             */
+            void mergeAt(gint i) {
+                gint base1 = runBase[i];
+                gint len1 = runLen[i];
+                gint const base2 = runBase[i + 1];
+                gint len2 = runLen[i + 1];
+
+                /*
+                 * Record the length of the combined runs; if i is the 3rd-last
+                 * run now, also slide over the last run (which isn't involved
+                 * in this merge).  The current run (i+1) goes away in any case.
+                 */
+                runLen[i] = len1 + len2;
+                if (i == stackSize - 3) {
+                    runBase[i + 1] = runBase[i + 2];
+                    runLen[i + 1] = runLen[i + 2];
+                }
+                stackSize--;
+
+                /*
+                 * Find where the first element of run2 goes in run1. Prior elements
+                 * in run1 can be ignored (because they're already in place).
+                 */
+                gint const k = gallopRight(a[base2], a, base1, len1, 0);
+                base1 += k;
+                len1 -= k;
+                if (len1 == 0)
+                    return;
+
+                /*
+                 * Find where the last element of run1 goes in run2. Subsequent elements
+                 * in run2 can be ignored (because they're already in place).
+                 */
+                len2 = gallopLeft(a[base1 + len1 - 1], a, base2, len2, len2 - 1);
+                if (len2 == 0)
+                    return;
+
+                // Merge remaining runs, using tmp array with min(len1, len2) elements
+                if (len1 <= len2)
+                    mergeLo(base1, len1, base2, len2);
+                else
+                    mergeHi(base1, len1, base2, len2);
+            }
+
+            /**
+             * Locates the position at which to insert the specified key into the
+             * specified sorted range; if the range contains an element equal to key,
+             * returns the index of the leftmost equal element.
+             *
+             * @param key the key whose insertion point to search for
+             * @param a the array in which to search
+             * @param base the index of the first element in the range
+             * @param len the length of the range; must be > 0
+             * @param hint the index at which to begin the search, 0 <= hint < n.
+             *     The closer hint is to the result, the faster this method will run.
+             * @return the int k,  0 <= k <= n such that a[b + k - 1] < key <= a[b + k],
+             *    pretending that a[b - 1] is minus infinity and a[b + n] is infinity.
+             *    In other words, key belongs at index b + k; or in other words,
+             *    the first k elements of a should precede key, and the last n - k
+             *    should follow it.
+             */
+            gint gallopLeft(REF key, VALUE a, gint base, gint len, gint hint) const {
+                gint lastOfs = 0;
+                gint ofs = 1;
+                if (compare(c, key, a[base + hint]) > 0) {
+                    // Gallop right until a[base+hint+lastOfs] < key <= a[base+hint+ofs]
+                    gint const maxOfs = len - hint;
+                    while (ofs < maxOfs && compare(c, key, a[base + hint + ofs]) > 0) {
+                        lastOfs = ofs;
+                        ofs = (ofs << 1) + 1;
+                        if (ofs <= 0)   // gint overflow
+                            ofs = maxOfs;
+                    }
+                    if (ofs > maxOfs)
+                        ofs = maxOfs;
+
+                    // Make offsets relative to base
+                    lastOfs += hint;
+                    ofs += hint;
+                } else { // key <= a[base + hint]
+                    // Gallop left until a[base+hint-ofs] < key <= a[base+hint-lastOfs]
+                    gint const maxOfs = hint + 1;
+                    while (ofs < maxOfs && compare(c, key, a[base + hint - ofs]) <= 0) {
+                        lastOfs = ofs;
+                        ofs = (ofs << 1) + 1;
+                        if (ofs <= 0)   // gint overflow
+                            ofs = maxOfs;
+                    }
+                    if (ofs > maxOfs)
+                        ofs = maxOfs;
+
+                    // Make offsets relative to base
+                    gint const t = lastOfs;
+                    lastOfs = hint - ofs;
+                    ofs = hint - t;
+                }
+
+                /*
+                 * Now a[base+lastOfs] < key <= a[base+ofs], so key belongs somewhere
+                 * to the right of lastOfs but no farther right than ofs.  Do a binary
+                 * search, with invariant a[base + lastOfs - 1] < key <= a[base + ofs].
+                 */
+                lastOfs++;
+                while (lastOfs < ofs) {
+                    gint const m = lastOfs + (gint) ((GENERIC_UINT32) (ofs - lastOfs) >> 1);
+
+                    if (compare(c, key, a[base + m]) > 0)
+                        lastOfs = m + 1;  // a[base + m] < key
+                    else
+                        ofs = m;          // key <= a[base + m]
+                }
+                return ofs;  // so a[base + ofs - 1] < key <= a[base + ofs]
+            }
+
+            /**
+             * Like gallopLeft, except that if the range contains an element equal to
+             * key, gallopRight returns the index after the rightmost equal element.
+             *
+             * @param key the key whose insertion point to search for
+             * @param a the array in which to search
+             * @param base the index of the first element in the range
+             * @param len the length of the range; must be > 0
+             * @param hint the index at which to begin the search, 0 <= hint < n.
+             *     The closer hint is to the result, the faster this method will run.
+             * @return the int k,  0 <= k <= n such that a[b + k - 1] <= key < a[b + k]
+             */
+            gint gallopRight(REF key, VALUE a, gint base, gint len, gint hint) const {
+                gint ofs = 1;
+                gint lastOfs = 0;
+                if (compare(c, key, a[base + hint]) < 0) {
+                    // Gallop left until a[b+hint - ofs] <= key < a[b+hint - lastOfs]
+                    gint const maxOfs = hint + 1;
+                    while (ofs < maxOfs && compare(c, key, a[base + hint - ofs]) < 0) {
+                        lastOfs = ofs;
+                        ofs = (ofs << 1) + 1;
+                        if (ofs <= 0)   // gint overflow
+                            ofs = maxOfs;
+                    }
+                    if (ofs > maxOfs)
+                        ofs = maxOfs;
+
+                    // Make offsets relative to b
+                    gint const t = lastOfs;
+                    lastOfs = hint - ofs;
+                    ofs = hint - t;
+                } else { // a[b + hint] <= key
+                    // Gallop right until a[b+hint + lastOfs] <= key < a[b+hint + ofs]
+                    gint const maxOfs = len - hint;
+                    while (ofs < maxOfs && compare(c, key, a[base + hint + ofs]) >= 0) {
+                        lastOfs = ofs;
+                        ofs = (ofs << 1) + 1;
+                        if (ofs <= 0)   // gint overflow
+                            ofs = maxOfs;
+                    }
+                    if (ofs > maxOfs)
+                        ofs = maxOfs;
+
+                    // Make offsets relative to b
+                    lastOfs += hint;
+                    ofs += hint;
+                }
+
+                /*
+                 * Now a[b + lastOfs] <= key < a[b + ofs], so key belongs somewhere to
+                 * the right of lastOfs but no farther right than ofs.  Do a binary
+                 * search, with invariant a[b + lastOfs - 1] <= key < a[b + ofs].
+                 */
+                lastOfs++;
+                while (lastOfs < ofs) {
+                    gint const m = lastOfs + (gint) ((GENERIC_UINT32) (ofs - lastOfs) >> 1);
+
+                    if (compare(c, key, a[base + m]) < 0)
+                        ofs = m;          // key < a[b + m]
+                    else
+                        lastOfs = m + 1;  // a[b + m] <= key
+                }
+                return ofs;  // so a[b + ofs - 1] <= key < a[b + ofs]
+            }
+
+            /**
+             * Merges two adjacent runs in place, in a stable fashion.  The first
+             * element of the first run must be greater than the first element of the
+             * second run (a[base1] > a[base2]), and the last element of the first run
+             * (a[base1 + len1-1]) must be greater than all elements of the second run.
+             *
+             * For performance, this method should be called only when len1 <= len2;
+             * its twin, mergeHi should be called if len1 >= len2.  (Either method
+             * may be called if len1 == len2.)
+             *
+             * @param base1 index of first element in first run to be merged
+             * @param len1  length of first run to be merged (must be > 0)
+             * @param base2 index of first element in second run to be merged
+             *        (must be aBase + aLen)
+             * @param len2  length of second run to be merged (must be > 0)
+             */
+            void mergeLo(gint base1, gint len1, gint base2, gint len2) {
+                // Copy first run into temp array
+                VALUE const t = ensureCapacity(len1);
+                gint cursor1 = 0;       // Indexes into tmp array
+                gint cursor2 = base2;   // Indexes int a
+                gint dest = base1;      // Indexes int a
+                arraycopy(a, base1, t, cursor1, len1);
+
+                // Move first element of second run and deal with degenerate cases
+                a[dest++] = a[cursor2++];
+                if (--len2 == 0) {
+                    arraycopy(t, cursor1, a, dest, len1);
+                    return;
+                }
+                if (len1 == 1) {
+                    arraycopy(a, cursor2, a, dest, len2);
+                    a[dest + len2] = t[cursor1]; // Last elt of run 1 to end of merge
+                    return;
+                }
+
+                gint minGallop = this->minGallop;
+                while (true) {
+                    gint count1 = 0; // Number of times in a row that first run won
+                    gint count2 = 0; // Number of times in a row that second run won
+
+                    /*
+                     * Do the straightforward thing until (if ever) one run starts
+                     * winning consistently.
+                     */
+                    do {
+                        if (compare(c, a[cursor2], t[cursor1]) < 0) {
+                            a[dest++] = a[cursor2++];
+                            count2++;
+                            count1 = 0;
+                            if (--len2 == 0)
+                                goto outer;
+                        } else {
+                            a[dest++] = t[cursor1++];
+                            count1++;
+                            count2 = 0;
+                            if (--len1 == 1)
+                                goto outer;
+                        }
+                    } while ((count1 | count2) < minGallop);
+
+                    /*
+                     * One run is winning so consistently that galloping may be a
+                     * huge win. So try that, and continue galloping until (if ever)
+                     * neither run appears to be winning consistently anymore.
+                     */
+                    do {
+                        count1 = gallopRight(a[cursor2], t, cursor1, len1, 0);
+                        if (count1 != 0) {
+                            arraycopy(t, cursor1, a, dest, count1);
+                            dest += count1;
+                            cursor1 += count1;
+                            len1 -= count1;
+                            if (len1 <= 1) // len1 == 1 || len1 == 0
+                                goto outer;
+                        }
+                        a[dest++] = a[cursor2++];
+                        if (--len2 == 0)
+                            goto outer;
+
+                        count2 = gallopLeft(t[cursor1], a, cursor2, len2, 0);
+                        if (count2 != 0) {
+                            arraycopy(a, cursor2, a, dest, count2);
+                            dest += count2;
+                            cursor2 += count2;
+                            len2 -= count2;
+                            if (len2 == 0)
+                                goto outer;
+                        }
+                        a[dest++] = t[cursor1++];
+                        if (--len1 == 1)
+                            goto outer;
+                        minGallop--;
+                    } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+                    if (minGallop < 0)
+                        minGallop = 0;
+                    minGallop += 2;  // Penalize for leaving gallop mode
+                }  // End of "outer" loop
+                outer:
+                this->minGallop = minGallop < 1 ? 1 : minGallop;  // Write back to field
+
+                if (len1 == 1) {
+                    arraycopy(a, cursor2, a, dest, len2);
+                    a[dest + len2] = t[cursor1]; //  Last elt of run 1 to end of merge
+                } else if (len1 == 0) {
+                    IllegalArgumentException("Comparison method violates its general contract!")
+                            .throws(__trace("core.util.TimSort"));
+                } else {
+                    arraycopy(t, cursor1, a, dest, len1);
+                }
+            }
+
+            /**
+             * Like mergeLo, except that this method should be called only if
+             * len1 >= len2; mergeLo should be called if len1 <= len2.  (Either method
+             * may be called if len1 == len2.)
+             *
+             * @param base1 index of first element in first run to be merged
+             * @param len1  length of first run to be merged (must be > 0)
+             * @param base2 index of first element in second run to be merged
+             *        (must be aBase + aLen)
+             * @param len2  length of second run to be merged (must be > 0)
+             */
+            void mergeHi(gint base1, gint len1, gint base2, gint len2) {
+                // Copy second run into temp array
+                VALUE const t = ensureCapacity(len2);
+                arraycopy(a, base2, t, 0, len2);
+
+                gint cursor1 = base1 + len1 - 1;  // Indexes into a
+                gint cursor2 = len2 - 1;          // Indexes into tmp array
+                gint dest = base2 + len2 - 1;     // Indexes into a
+
+                // Move last element of first run and deal with degenerate cases
+                a[dest--] = a[cursor1--];
+                if (--len1 == 0) {
+                    arraycopy(t, 0, a, dest - (len2 - 1), len2);
+                    return;
+                }
+                if (len2 == 1) {
+                    dest -= len1;
+                    cursor1 -= len1;
+                    arraycopy(a, cursor1 + 1, a, dest + 1, len1);
+                    a[dest] = t[cursor2];
+                    return;
+                }
+
+                gint minGallop = this->minGallop;
+                while (true) {
+                    gint count1 = 0; // Number of times in a row that first run won
+                    gint count2 = 0; // Number of times in a row that second run won
+
+                    /*
+                     * Do the straightforward thing until (if ever) one run
+                     * appears to win consistently.
+                     */
+                    do {
+                        if (compare(c, t[cursor2], a[cursor1]) < 0) {
+                            a[dest--] = a[cursor1--];
+                            count1++;
+                            count2 = 0;
+                            if (--len1 == 0)
+                                goto outer;
+                        } else {
+                            a[dest--] = t[cursor2--];
+                            count2++;
+                            count1 = 0;
+                            if (--len2 == 1)
+                                goto outer;
+                        }
+                    } while ((count1 | count2) < minGallop);
+
+                    /*
+                     * One run is winning so consistently that galloping may be a
+                     * huge win. So try that, and continue galloping until (if ever)
+                     * neither run appears to be winning consistently anymore.
+                     */
+                    do {
+                        count1 = len1 - gallopRight(t[cursor2], a, base1, len1, len1 - 1);
+                        if (count1 != 0) {
+                            dest -= count1;
+                            cursor1 -= count1;
+                            len1 -= count1;
+                            arraycopy(a, cursor1 + 1, a, dest + 1, count1);
+                            if (len1 == 0)
+                                goto outer;
+                        }
+                        a[dest--] = t[cursor2--];
+                        if (--len2 == 1)
+                            goto outer;
+
+                        count2 = len2 - gallopLeft(a[cursor1], t, 0, len2, len2 - 1);
+                        if (count2 != 0) {
+                            dest -= count2;
+                            cursor2 -= count2;
+                            len2 -= count2;
+                            arraycopy(t, cursor2 + 1, a, dest + 1, count2);
+                            if (len2 <= 1)  // len2 == 1 || len2 == 0
+                                goto outer;
+                        }
+                        a[dest--] = a[cursor1--];
+                        if (--len1 == 0)
+                            goto outer;
+                        minGallop--;
+                    } while (count1 >= MIN_GALLOP || count2 >= MIN_GALLOP);
+                    if (minGallop < 0)
+                        minGallop = 0;
+                    minGallop += 2;  // Penalize for leaving gallop mode
+                }  // End of "outer" loop
+                outer:
+                this->minGallop = minGallop < 1 ? 1 : minGallop;  // Write back to field
+
+                if (len2 == 1) {
+                    dest -= len1;
+                    cursor1 -= len1;
+                    arraycopy(a, cursor1 + 1, a, dest + 1, len1);
+                    a[dest] = t[cursor2];  // Move first elt of run2 to front of merge
+                } else if (len2 == 0) {
+                    IllegalArgumentException("Comparison method violates its general contract!")
+                            .throws(__trace("core.util.TimSort"));
+                } else {
+                    arraycopy(t, 0, a, dest - (len2 - 1), len2);
+                }
+            }
+
+            /**
+             * Ensures that the external array tmp has at least the specified
+             * number of elements, increasing its size if necessary.  The size
+             * increases exponentially to ensure amortized linear time complexity.
+             *
+             * @param minCapacity the minimum required capacity of the tmp array
+             * @return tmp, whether or not it grew
+             */
+            VALUE ensureCapacity(gint minCapacity) {
+                if (tmpLen < minCapacity) {
+                    // Compute smallest power of 2 > minCapacity
+                    gint newSize = minCapacity;
+                    newSize |= newSize >> 1;
+                    newSize |= newSize >> 2;
+                    newSize |= newSize >> 4;
+                    newSize |= newSize >> 8;
+                    newSize |= newSize >> 16;
+                    newSize++;
+
+                    if (newSize < 0) // Not bloody likely!
+                        newSize = minCapacity;
+                    else if (newSize > (length >> 1))
+                        newSize = length >> 1;
+
+                    VALUE const newTmp = (VALUE) Unsafe::allocateMemory((glong) newSize * (glong) sizeof(REF));
+                    Unsafe::freeMemory((glong) tmp);
+                    tmp = newTmp;
+                    tmpLen = newSize;
+                }
+                return tmp;
+            }
+        };
+
+    } // util
+} // core
+
+#endif //CORE23_TIMSORT_H
@@ -17,9 +17,17 @@ using namespace foreign;
 
 template<class T>
 void println(T &&obj) {
-    String const str = String::valueOf(obj) + "\n"_S;
-    CharArray const ca = str.chars();
-    std::wcout << (wchar_t *) &ca[0];
+    String const str = String::valueOf(obj);
+    str.forEachChunk([](const gchar *chars, gint count) {
+        wchar_t buffer[256];
+        for (gint i = 0; i < count; i += 256) {
+            gint const n = count - i < 256 ? count - i : 256;
+            for (gint j = 0; j < n; ++j)
+                buffer[j] = (wchar_t) chars[i + j];
+            std::wcout.write(buffer, n);
+        }
+    });
+    std::wcout << L'\n';
     fflush(stdout);
 }
 
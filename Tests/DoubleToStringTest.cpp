@@ -0,0 +1,125 @@
+//
+// Created by T.N.Brunshweeck on 16/10/2026.
+//
+
+#include <core/Double.h>
+#include <core/Float.h>
+#include <core/native/CharArray.h>
+#include <core/private/Null.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace core;
+using namespace native;
+
+/**
+ * The round-trip checks of Double::toChars and Float::toChars (Schubfach): the
+ * written decimal must be parsed (by the C library) back to the same value.
+ * All the 2^32 floats are checked, and 10^8 doubles with random bits (pass a
+ * smaller count in argument for quick runs). These checks must be run with the
+ * optimized build (the undefined behaviours are often harmless without
+ * optimization).
+ */
+
+namespace {
+
+    gint failures = 0;
+
+    /**
+     * Copy the chars of value written by Double::toChars (or Float::toChars) in the C string.
+     */
+    template<class T>
+    gint toCString(T value, CharArray &chars, char *str) {
+        gint const count = sizeof(T) == 8
+                           ? Double::toChars((gdouble) value, chars, 0)
+                           : Float::toChars((gfloat) value, chars, 0);
+        for (gint i = 0; i < count; ++i)
+            str[i] = (char) chars[i];
+        str[count] = 0;
+        return count;
+    }
+
+    void checkString(gdouble d, const char *expected, CharArray &chars) {
+        char str[32];
+        toCString(d, chars, str);
+        if (std::strcmp(str, expected) != 0 && failures++ < 10)
+            std::printf("Double %.17g: \"%s\" written instead of \"%s\"\n", d, str, expected);
+    }
+
+    void checkString(gfloat f, const char *expected, CharArray &chars) {
+        char str[32];
+        toCString(f, chars, str);
+        if (std::strcmp(str, expected) != 0 && failures++ < 10)
+            std::printf("Float %.9g: \"%s\" written instead of \"%s\"\n", (gdouble) f, str, expected);
+    }
+
+    /**
+     * The xorshift generator of random bits (reproducible).
+     */
+    glong nextBits(glong &state) {
+        native::GENERIC_UINT64 x = (native::GENERIC_UINT64) state;
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        state = (glong) x;
+        return state;
+    }
+}
+
+gint main(gint argc, char **argv) {
+    glong const doubleCount = argc > 1 ? std::atoll(argv[1]) : 100000000LL;
+    glong const floatStep = argc > 1 ? 997 : 1;
+    CharArray chars = CharArray(32);
+    char str[32];
+
+    // the format of Double.toString
+    checkString(1.0, "1.0", chars);
+    checkString(-0.0, "-0.0", chars);
+    checkString(0.001, "0.001", chars);
+    checkString(1.0E-4, "1.0E-4", chars);
+    checkString(1234567.0, "1234567.0", chars);
+    checkString(1.0E7, "1.0E7", chars);
+    checkString(1.0E23, "1.0E23", chars);
+    checkString(2.0E-3, "0.002", chars);
+    checkString(4.6235885362637926E18, "4.623588536263793E18", chars);
+    checkString(Double::MIN_VALUE, "4.9E-324", chars);
+    checkString(Double::MAX_VALUE, "1.7976931348623157E308", chars);
+    checkString(Double::POSITIVE_INFINITY, "Infinity", chars);
+    checkString(Double::NEGATIVE_INFINITY, "-Infinity", chars);
+    checkString(Double::NaN, "NaN", chars);
+    checkString(1.0E10F, "1.0E10", chars);
+    checkString(Float::MIN_VALUE, "1.4E-45", chars);
+    checkString(Float::MAX_VALUE, "3.4028235E38", chars);
+
+    // all floats (the infinities and NaN are not decimals)
+    glong floatCount = 0;
+    for (glong i = 0; i < (1LL << 32); i += floatStep) {
+        gint const bits = (gint) i;
+        gfloat const f = Float::fromIntBits(bits);
+        if (Float::isNaN(f) || Float::isInfinite(f))
+            continue;
+        toCString(f, chars, str);
+        gfloat const parsed = std::strtof(str, null);
+        if (Float::toIntBits(parsed) != bits && failures++ < 10)
+            std::printf("Float %.9g: \"%s\" is parsed to %.9g\n", (gdouble) f, str, (gdouble) parsed);
+        floatCount += 1;
+    }
+
+    // random doubles
+    glong state = 0x2545F4914F6CDD1DLL;
+    for (glong i = 0; i < doubleCount; ++i) {
+        glong const bits = nextBits(state);
+        gdouble const d = Double::fromLongBits(bits);
+        if (Double::isNaN(d) || Double::isInfinite(d))
+            continue;
+        toCString(d, chars, str);
+        gdouble const parsed = std::strtod(str, null);
+        if (Double::toLongBits(parsed) != bits && failures++ < 10)
+            std::printf("Double %.17g: \"%s\" is parsed to %.17g\n", d, str, parsed);
+    }
+
+    std::printf("%lld floats and %lld doubles checked, %d failures\n",
+                (long long) floatCount, (long long) doubleCount, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -4,8 +4,13 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
 #include <core/private/Unsafe.h>
 #include <core/IllegalArgumentException.h>
+#include <core/Long.h>
 
 #ifdef CORE_COMPILER_GNU_ONLY
 // gcc, mingw, clang (unix)
@@ -40,25 +45,426 @@
 namespace core {
     namespace native {
 
+        namespace {
+
+            /**
+             * The native allocator used on Unix systems.
+             * <p>
+             * The small blocks (up to 32 KiB) are grouped in size classes: 16-bytes steps up to
+             * 128 bytes, then four classes by power of two. Each thread keeps a free list per
+             * size class, refilled from (and flushed to) a central free list by batches, so most of
+             * allocations and releases are served without synchronization. The central free lists
+             * carve new blocks from spans obtained directly from the system pages.
+             * <p>
+             * The large blocks are mapped directly from the system pages, and resized with
+             * <b>mremap</b> when it is available.
+             * <p>
+             * Each block is preceded by a header of 16 bytes containing its usable size and its
+             * size class, so the blocks remain aligned for all value types.
+             */
+            class Allocator CORE_FINAL {
+            public:
+                static CORE_FAST gint HEADER_SIZE = 16;
+
+                static CORE_FAST gint SIZE_CLASS_COUNT = 40;
+
+                static CORE_FAST gint LARGE_CLASS = SIZE_CLASS_COUNT;
+
+                static CORE_FAST glong MAX_SMALL_SIZE = 32768;
+
+                static CORE_FAST glong SPAN_SIZE = 65536;
+
+                interface Header {
+                    glong size; // the usable size of block
+                    glong sizeClass;
+                };
+
+                interface FreeBlock {
+                    FreeBlock *next;
+                };
+
+                interface ThreadCache {
+                    FreeBlock *heads[SIZE_CLASS_COUNT];
+                    gint counts[SIZE_CLASS_COUNT];
+                    glong allocatedBlocks[SIZE_CLASS_COUNT + 1];
+                    glong releasedBlocks[SIZE_CLASS_COUNT + 1];
+                    glong allocatedBytes;
+                    glong releasedBytes;
+                    ThreadCache *prev;
+                    ThreadCache *next;
+                    gbool registered;
+                };
+
+                interface Central {
+                    FreeBlock *head;
+                    gint count;
+                    gint volatile state;
+                };
+
+                /**
+                 * Return the size class of given request size (in bytes).
+                 */
+                static gint sizeClassOf(glong sizeInBytes) {
+                    if (sizeInBytes <= 128)
+                        return sizeInBytes <= 16 ? 0 : (gint) ((sizeInBytes - 1) >> 4);
+                    if (sizeInBytes > MAX_SMALL_SIZE)
+                        return LARGE_CLASS;
+                    // 2^shift < sizeInBytes <= 2^(shift + 1)
+                    gint const shift = CORE_EXPR(
+                            63 - __builtin_clzll((unsigned long long) sizeInBytes - 1),
+                            63 - __builtin_clzll((unsigned long long) sizeInBytes - 1),
+                            log2(sizeInBytes - 1),
+                            log2(sizeInBytes - 1)
+                    );
+                    return 8 + ((shift - 7) << 2) + (gint) (((sizeInBytes - 1) >> (shift - 2)) - 4);
+                }
+
+                /**
+                 * Return the usable size of blocks of given size class.
+                 */
+                static CORE_FAST glong sizeOf(gint sizeClass) {
+                    return sizeClass < 8 ? (glong) (sizeClass + 1) << 4 :
+                           (1LL << (7 + ((sizeClass - 8) >> 2))) +
+                           ((glong) (((sizeClass - 8) & 3) + 1) << (5 + ((sizeClass - 8) >> 2)));
+                }
+
+                /**
+                 * Return the number of blocks moved between thread cache and central
+                 * free list at a time.
+                 */
+                static CORE_FAST gint batchOf(gint sizeClass) {
+                    return sizeClass < 16 ? 32 : sizeClass < 28 ? 8 : 2;
+                }
+
+                static gint log2(glong x) {
+                    gint n = 0;
+                    while ((x >>= 1) != 0)
+                        n += 1;
+                    return n;
+                }
+
+                static void lock(gint volatile &state) {
+                    while (CORE_EXPR(
+                            __sync_lock_test_and_set(&state, 1),
+                            __atomic_exchange_n(&state, 1, __ATOMIC_ACQUIRE),
+                            0,
+                            [&]() -> gint {
+                                gint const oldState = state;
+                                state = 1;
+                                return oldState;
+                            }()) != 0) {
+                        while (state != 0) {
+                            // spin until the lock is released
+                        }
+                    }
+                }
+
+                static void unlock(gint volatile &state) {
+                    CORE_EXPR(
+                            __sync_lock_release(&state),
+                            __atomic_store_n(&state, 0, __ATOMIC_RELEASE),
+                            state = 0,
+                            state = 0
+                    );
+                }
+
+                static glong mapPages(glong sizeInBytes) {
+                    GENERIC_PTR const address = mmap(null, (size_t) sizeInBytes, PROT_READ | PROT_WRITE,
+                                                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                    return address == MAP_FAILED ? 0 : (glong) address;
+                }
+
+                static glong pageSize() {
+                    static glong size = 0;
+                    if (size == 0) {
+                        glong const n = sysconf(_SC_PAGESIZE);
+                        size = n > 0 ? n : 4096;
+                    }
+                    return size;
+                }
+
+                static glong roundToPages(glong sizeInBytes) {
+                    glong const page = pageSize();
+                    return (sizeInBytes + page - 1) & ~(page - 1);
+                }
+
+                static Header &headerOf(glong address) {
+                    return *(Header *) (address - HEADER_SIZE);
+                }
+
+                static ThreadCache &threadCache() {
+                    static __thread ThreadCache cache;
+                    if (!cache.registered)
+                        attach(cache);
+                    return cache;
+                }
+
+                static void attach(ThreadCache &cache);
+
+                static void detach(GENERIC_PTR cache);
+
+                /**
+                 * Move blocks from central free list (or a new span) to the thread cache.
+                 */
+                static gbool refill(ThreadCache &cache, gint sizeClass);
+
+                /**
+                 * Move a batch of blocks from the thread cache to the central free list.
+                 */
+                static void flush(ThreadCache &cache, gint sizeClass, gint count);
+
+                static glong allocate(glong sizeInBytes) {
+                    gint const sizeClass = sizeClassOf(sizeInBytes);
+                    ThreadCache &cache = threadCache();
+                    if (sizeClass == LARGE_CLASS) {
+                        glong const mapSize = roundToPages(sizeInBytes + HEADER_SIZE);
+                        glong const base = mapPages(mapSize);
+                        if (base == 0)
+                            return 0;
+                        Header &header = *(Header *) base;
+                        header.size = mapSize - HEADER_SIZE;
+                        header.sizeClass = LARGE_CLASS;
+                        cache.allocatedBlocks[LARGE_CLASS] += 1;
+                        cache.allocatedBytes += header.size;
+                        return base + HEADER_SIZE;
+                    }
+                    if (cache.heads[sizeClass] == null && !refill(cache, sizeClass))
+                        return 0;
+                    FreeBlock *block = cache.heads[sizeClass];
+                    cache.heads[sizeClass] = block->next;
+                    cache.counts[sizeClass] -= 1;
+                    cache.allocatedBlocks[sizeClass] += 1;
+                    cache.allocatedBytes += sizeOf(sizeClass);
+                    return (glong) block;
+                }
+
+                static void release(glong address) {
+                    Header const &header = headerOf(address);
+                    gint const sizeClass = (gint) header.sizeClass;
+                    ThreadCache &cache = threadCache();
+                    cache.releasedBlocks[sizeClass] += 1;
+                    cache.releasedBytes += header.size;
+                    if (sizeClass == LARGE_CLASS) {
+                        munmap((GENERIC_PTR) (address - HEADER_SIZE), (size_t) (header.size + HEADER_SIZE));
+                        return;
+                    }
+                    FreeBlock *block = (FreeBlock *) address;
+                    block->next = cache.heads[sizeClass];
+                    cache.heads[sizeClass] = block;
+                    cache.counts[sizeClass] += 1;
+                    if (cache.counts[sizeClass] > batchOf(sizeClass) << 1)
+                        flush(cache, sizeClass, batchOf(sizeClass));
+                }
+
+                static glong reallocate(glong address, glong sizeInBytes) {
+                    Header &header = headerOf(address);
+                    glong const oldSize = header.size;
+                    if (header.sizeClass == LARGE_CLASS && sizeInBytes > MAX_SMALL_SIZE) {
+                        glong const mapSize = roundToPages(sizeInBytes + HEADER_SIZE);
+                        if (mapSize == oldSize + HEADER_SIZE)
+                            return address;
+#ifdef MREMAP_MAYMOVE
+                        GENERIC_PTR const base = mremap((GENERIC_PTR) (address - HEADER_SIZE),
+                                                        (size_t) (oldSize + HEADER_SIZE), (size_t) mapSize,
+                                                        MREMAP_MAYMOVE);
+                        if (base == MAP_FAILED)
+                            return 0;
+                        ThreadCache &cache = threadCache();
+                        cache.allocatedBytes += mapSize - HEADER_SIZE - oldSize;
+                        ((Header *) base)->size = mapSize - HEADER_SIZE;
+                        return (glong) base + HEADER_SIZE;
+#else
+                        if (mapSize < oldSize + HEADER_SIZE) {
+                            // shrink in place, release the pages of tail
+                            munmap((GENERIC_PTR) (address - HEADER_SIZE + mapSize),
+                                   (size_t) (oldSize + HEADER_SIZE - mapSize));
+                            threadCache().releasedBytes += oldSize + HEADER_SIZE - mapSize;
+                            header.size = mapSize - HEADER_SIZE;
+                            return address;
+                        }
+#endif
+                    } else if (header.sizeClass != LARGE_CLASS && sizeInBytes <= oldSize &&
+                               (oldSize <= 128 || sizeInBytes > oldSize >> 1)) {
+                        // the block is large enough, and not too large
+                        return address;
+                    }
+                    glong const newAddress = allocate(sizeInBytes);
+                    if (newAddress == 0)
+                        return 0;
+                    memcpy((GENERIC_PTR) newAddress, (GENERIC_PTR) address,
+                           (size_t) (oldSize < sizeInBytes ? oldSize : sizeInBytes));
+                    release(address);
+                    return newAddress;
+                }
+
+                static Central centrals[SIZE_CLASS_COUNT];
+
+                static ThreadCache *threads;
+
+                static gint volatile threadsState;
+
+                static glong retiredBlocks[SIZE_CLASS_COUNT + 1];
+
+                static glong retiredBytes;
+
+                static pthread_key_t threadKey;
+
+                static pthread_once_t threadKeyOnce;
+
+                static void createThreadKey() {
+                    pthread_key_create(&threadKey, &detach);
+                }
+            };
+
+            Allocator::Central Allocator::centrals[SIZE_CLASS_COUNT] = {};
+
+            Allocator::ThreadCache *Allocator::threads = null;
+
+            gint volatile Allocator::threadsState = 0;
+
+            glong Allocator::retiredBlocks[SIZE_CLASS_COUNT + 1] = {};
+
+            glong Allocator::retiredBytes = 0;
+
+            pthread_key_t Allocator::threadKey = {};
+
+            pthread_once_t Allocator::threadKeyOnce = PTHREAD_ONCE_INIT;
+
+            void Allocator::attach(ThreadCache &cache) {
+                cache.registered = true;
+                lock(threadsState);
+                cache.prev = null;
+                cache.next = threads;
+                if (threads != null)
+                    threads->prev = &cache;
+                threads = &cache;
+                unlock(threadsState);
+                // the thread cache is returned to central free lists when the thread exits
+                pthread_once(&threadKeyOnce, &createThreadKey);
+                pthread_setspecific(threadKey, &cache);
+            }
+
+            void Allocator::detach(GENERIC_PTR address) {
+                ThreadCache &cache = *(ThreadCache *) address;
+                for (gint i = 0; i < SIZE_CLASS_COUNT; ++i) {
+                    if (cache.counts[i] > 0)
+                        flush(cache, i, cache.counts[i]);
+                }
+                lock(threadsState);
+                for (gint i = 0; i <= SIZE_CLASS_COUNT; ++i) {
+                    retiredBlocks[i] += cache.allocatedBlocks[i] - cache.releasedBlocks[i];
+                    cache.allocatedBlocks[i] = cache.releasedBlocks[i] = 0;
+                }
+                retiredBytes += cache.allocatedBytes - cache.releasedBytes;
+                cache.allocatedBytes = cache.releasedBytes = 0;
+                if (cache.prev != null)
+                    cache.prev->next = cache.next;
+                else
+                    threads = cache.next;
+                if (cache.next != null)
+                    cache.next->prev = cache.prev;
+                cache.prev = cache.next = null;
+                cache.registered = false;
+                unlock(threadsState);
+            }
+
+            gbool Allocator::refill(ThreadCache &cache, gint sizeClass) {
+                Central &central = centrals[sizeClass];
+                gint const batch = batchOf(sizeClass);
+                lock(central.state);
+                if (central.head == null) {
+                    // carve a new span
+                    glong const blockSize = sizeOf(sizeClass) + HEADER_SIZE;
+                    glong const spanSize = roundToPages(blockSize * batch > SPAN_SIZE ? blockSize * batch : SPAN_SIZE);
+                    glong const span = mapPages(spanSize);
+                    if (span == 0) {
+                        unlock(central.state);
+                        return false;
+                    }
+                    FreeBlock *head = null;
+                    for (glong block = span + spanSize - blockSize; block >= span; block -= blockSize) {
+                        Header &header = *(Header *) block;
+                        header.size = blockSize - HEADER_SIZE;
+                        header.sizeClass = sizeClass;
+                        FreeBlock *freeBlock = (FreeBlock *) (block + HEADER_SIZE);
+                        freeBlock->next = head;
+                        head = freeBlock;
+                        central.count += 1;
+                    }
+                    central.head = head;
+                }
+                FreeBlock *head = central.head;
+                FreeBlock *tail = head;
+                gint count = 1;
+                while (count < batch && tail->next != null) {
+                    tail = tail->next;
+                    count += 1;
+                }
+                central.head = tail->next;
+                central.count -= count;
+                unlock(central.state);
+                tail->next = cache.heads[sizeClass];
+                cache.heads[sizeClass] = head;
+                cache.counts[sizeClass] += count;
+                return true;
+            }
+
+            void Allocator::flush(ThreadCache &cache, gint sizeClass, gint count) {
+                FreeBlock *head = cache.heads[sizeClass];
+                FreeBlock *tail = head;
+                for (gint i = 1; i < count; ++i)
+                    tail = tail->next;
+                cache.heads[sizeClass] = tail->next;
+                cache.counts[sizeClass] -= count;
+                Central &central = centrals[sizeClass];
+                lock(central.state);
+                tail->next = central.head;
+                central.head = head;
+                central.count += count;
+                unlock(central.state);
+            }
+        }
 
         glong Unsafe::allocateMemoryImpl(glong sizeInBytes) {
-            try {
-                if (sizeInBytes % 8 == 0)
-                    return (glong) new glong[sizeInBytes >> 3];
-                if (sizeInBytes % 4 == 0)
-                    return (glong) new gint[sizeInBytes >> 2];
-                if (sizeInBytes % 2 == 0)
-                    return (glong) new gshort[sizeInBytes >> 1];
-                return (glong) new gbyte[sizeInBytes >> 0];
-            } catch (...) { return 0L; }
+            return Allocator::allocate(sizeInBytes);
         }
 
         glong Unsafe::reallocateMemoryImpl(glong address, glong sizeInBytes) {
-            return (glong) realloc((void *) address, sizeInBytes);
+            return Allocator::reallocate(address, sizeInBytes);
         }
 
         void Unsafe::freeMemoryImpl(glong address) {
-            delete[] (gbyte *) address;
+            Allocator::release(address);
+        }
+
+        glong Unsafe::allocatedMemorySize() {
+            Allocator::lock(Allocator::threadsState);
+            glong size = Allocator::retiredBytes;
+            for (Allocator::ThreadCache *cache = Allocator::threads; cache != null; cache = cache->next)
+                size += cache->allocatedBytes - cache->releasedBytes;
+            Allocator::unlock(Allocator::threadsState);
+            return size;
+        }
+
+        glong Unsafe::allocatedMemoryBlocks(gint sizeClass) {
+            if (sizeClass < 0 || sizeClass > Allocator::SIZE_CLASS_COUNT)
+                IllegalArgumentException("Invalid size class").throws(__trace("core.private.Unsafe"));
+            Allocator::lock(Allocator::threadsState);
+            glong count = Allocator::retiredBlocks[sizeClass];
+            for (Allocator::ThreadCache *cache = Allocator::threads; cache != null; cache = cache->next)
+                count += cache->allocatedBlocks[sizeClass] - cache->releasedBlocks[sizeClass];
+            Allocator::unlock(Allocator::threadsState);
+            return count;
+        }
+
+        gint Unsafe::memorySizeClassCount() {
+            return Allocator::SIZE_CLASS_COUNT;
+        }
+
+        glong Unsafe::memorySizeClassLimit(gint sizeClass) {
+            if (sizeClass < 0 || sizeClass > Allocator::SIZE_CLASS_COUNT)
+                IllegalArgumentException("Invalid size class").throws(__trace("core.private.Unsafe"));
+            return sizeClass == Allocator::LARGE_CLASS ? Long::MAX_VALUE : Allocator::sizeOf(sizeClass);
         }
 
         void Unsafe::setMemoryImpl(glong address, glong sizeInBytes, gbyte value) {
@@ -98,6 +504,47 @@ namespace core {
             );
         }
 
+        namespace {
+
+            /**
+             * The routine and argument of thread started with Unsafe::startThread.
+             */
+            struct ThreadStart {
+                void (*routine)(glong);
+                glong argument;
+            };
+
+            void *startRoutine(void *start) {
+                ThreadStart const s = *(ThreadStart *) start;
+                delete (ThreadStart *) start;
+                s.routine(s.argument);
+                return null;
+            }
+        }
+
+        gint Unsafe::availableProcessors() {
+            glong const n = sysconf(_SC_NPROCESSORS_ONLN);
+            return n < 1 ? 1 : n > Integer::MAX_VALUE ? Integer::MAX_VALUE : (gint) n;
+        }
+
+        glong Unsafe::startThread(void (*routine)(glong), glong argument) {
+            ThreadStart *start = new ThreadStart{routine, argument};
+            pthread_t thread = {};
+            if (pthread_create(&thread, null, &startRoutine, start) != 0) {
+                delete start;
+                return 0;
+            }
+            return (glong) thread;
+        }
+
+        void Unsafe::joinThread(glong thread) {
+            pthread_join((pthread_t) thread, null);
+        }
+
+        void Unsafe::yieldThread() {
+            sched_yield();
+        }
+
 
     }
 }
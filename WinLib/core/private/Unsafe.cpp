@@ -3,6 +3,7 @@
 //
 
 #include <core/private/Unsafe.h>
+#include <core/Long.h>
 #include <Windows.h>
 
 #ifdef CORE_COMPILER_GNU_ONLY
@@ -52,83 +53,98 @@ namespace core {
 
         namespace {
             HANDLE privateHeap[64] = {};
-        }
 
-        glong Unsafe::allocateMemoryImpl(glong sizeInBytes) {
-            if (sizeInBytes == 0)
-                return 0;
-//            HLOCAL handle = LocalAlloc(LMEM_ZEROINIT | LMEM_FIXED, (SIZE_T) sizeInBytes);
-//            if (handle != NULL) {
-//                return (glong) handle;
-//            }
-//            handle = LocalAlloc(LMEM_ZEROINIT | LMEM_MOVEABLE, (SIZE_T) sizeInBytes);
-//            if (handle != NULL) {
-//                glong const address = (glong) LocalLock(handle);
-//                if(address != 0) {
-//                    return address;
+            /**
+             * The number of blocks and bytes currently allocated
+             */
+            LONG64 volatile allocatedBlocks = 0;
+            LONG64 volatile allocatedBytes = 0;
+
+            glong allocateHeap(glong sizeInBytes) {
+                if (sizeInBytes == 0)
+                    return 0;
+//                HLOCAL handle = LocalAlloc(LMEM_ZEROINIT | LMEM_FIXED, (SIZE_T) sizeInBytes);
+//                if (handle != NULL) {
+//                    return (glong) handle;
 //                }
-//            }
-            HANDLE handle = NULL;
-            if (privateHeap[1] == NULL) {
-                // start with private heap
-                handle = privateHeap[1] = HeapCreate(HEAP_GENERATE_EXCEPTIONS, sizeInBytes, 0);
-                if (handle == NULL) {
-                    handle = privateHeap[1] = HeapCreate(HEAP_GENERATE_EXCEPTIONS, sizeInBytes,
-                                                         sizeInBytes + ADDRESS_SIZE);
+//                handle = LocalAlloc(LMEM_ZEROINIT | LMEM_MOVEABLE, (SIZE_T) sizeInBytes);
+//                if (handle != NULL) {
+//                    glong const address = (glong) LocalLock(handle);
+//                    if(address != 0) {
+//                        return address;
+//                    }
+//                }
+                HANDLE handle = NULL;
+                if (privateHeap[1] == NULL) {
+                    // start with private heap
+                    handle = privateHeap[1] = HeapCreate(HEAP_GENERATE_EXCEPTIONS, sizeInBytes, 0);
+                    if (handle == NULL) {
+                        handle = privateHeap[1] = HeapCreate(HEAP_GENERATE_EXCEPTIONS, sizeInBytes,
+                                                             sizeInBytes + Unsafe::ADDRESS_SIZE);
+                    }
                 }
-            }
-            else{
-                handle = privateHeap[1];
-            }
-            if (handle != NULL) {
-                HeapLock(handle);
-                LPVOID ptr = HeapAlloc(handle, HEAP_ZERO_MEMORY, sizeInBytes + 1ULL);
-                if (ptr != NULL) {
-                    HeapUnlock(handle);
-                    return (glong) ptr;
+                else{
+                    handle = privateHeap[1];
                 }
-                HeapUnlock(handle);
-            }
-            if (privateHeap[0] == NULL) {
-                handle = privateHeap[0] = GetProcessHeap();
-            }
-            if (handle != NULL) {
-                HeapLock(handle);
-                LPVOID ptr = HeapAlloc(handle, HEAP_ZERO_MEMORY, sizeInBytes + 1ULL);
-                if (ptr != NULL) {
-                    HeapUnlock(handle);
-                    return (glong) ptr;
-                }
-                HeapUnlock(handle);
-            }
-            for (HANDLE &heap: privateHeap) {
-                if (heap != NULL) {
-                    handle = heap;
-                    HeapLock(heap);
+                if (handle != NULL) {
+                    HeapLock(handle);
                     LPVOID ptr = HeapAlloc(handle, HEAP_ZERO_MEMORY, sizeInBytes + 1ULL);
                     if (ptr != NULL) {
-                        HeapUnlock(heap);
+                        HeapUnlock(handle);
                         return (glong) ptr;
                     }
-                    HeapUnlock(heap);
-                } else {
-                    handle = heap = HeapCreate(0, sizeInBytes, 0);
-                    if (handle == NULL) {
-                        handle = heap = HeapCreate(HEAP_GENERATE_EXCEPTIONS, sizeInBytes, sizeInBytes + ADDRESS_SIZE);
-                    }
-                    if (handle == NULL)
-                        return 0;
-                    HeapLock(heap);
+                    HeapUnlock(handle);
+                }
+                if (privateHeap[0] == NULL) {
+                    handle = privateHeap[0] = GetProcessHeap();
+                }
+                if (handle != NULL) {
+                    HeapLock(handle);
                     LPVOID ptr = HeapAlloc(handle, HEAP_ZERO_MEMORY, sizeInBytes + 1ULL);
                     if (ptr != NULL) {
-                        HeapUnlock(heap);
+                        HeapUnlock(handle);
                         return (glong) ptr;
                     }
-                    HeapUnlock(heap);
-                    return 0;
+                    HeapUnlock(handle);
+                }
+                for (HANDLE &heap: privateHeap) {
+                    if (heap != NULL) {
+                        handle = heap;
+                        HeapLock(heap);
+                        LPVOID ptr = HeapAlloc(handle, HEAP_ZERO_MEMORY, sizeInBytes + 1ULL);
+                        if (ptr != NULL) {
+                            HeapUnlock(heap);
+                            return (glong) ptr;
+                        }
+                        HeapUnlock(heap);
+                    } else {
+                        handle = heap = HeapCreate(0, sizeInBytes, 0);
+                        if (handle == NULL) {
+                            handle = heap = HeapCreate(HEAP_GENERATE_EXCEPTIONS, sizeInBytes, sizeInBytes + Unsafe::ADDRESS_SIZE);
+                        }
+                        if (handle == NULL)
+                            return 0;
+                        HeapLock(heap);
+                        LPVOID ptr = HeapAlloc(handle, HEAP_ZERO_MEMORY, sizeInBytes + 1ULL);
+                        if (ptr != NULL) {
+                            HeapUnlock(heap);
+                            return (glong) ptr;
+                        }
+                        HeapUnlock(heap);
+                        return 0;
+                    }
                 }
+                return 0;
             }
-            return 0;
+        }
+
+        glong Unsafe::allocateMemoryImpl(glong sizeInBytes) {
+            glong const address = allocateHeap(sizeInBytes);
+            if (address != 0) {
+                InterlockedExchangeAdd64(&allocatedBlocks, 1);
+                InterlockedExchangeAdd64(&allocatedBytes, sizeInBytes);
+            }
+            return address;
         }
 
         glong Unsafe::reallocateMemoryImpl(glong address, glong sizeInBytes) {
@@ -136,9 +152,11 @@ namespace core {
                 if (heap == NULL)
                     break;
                 HeapLock(heap);
+                SIZE_T const oldSize = HeapSize(heap, 0, (LPCVOID) address);
                 LPVOID ptr = HeapReAlloc(heap, HEAP_ZERO_MEMORY, (LPVOID) address, sizeInBytes + 1ULL);
                 if (ptr != NULL) {
                     HeapUnlock(heap);
+                    InterlockedExchangeAdd64(&allocatedBytes, sizeInBytes + 1LL - (LONG64) oldSize);
                     return (glong) ptr;
                 }
                 HeapUnlock(heap);
@@ -168,12 +186,35 @@ namespace core {
                 }
                 if(HeapFree(heap, 0, (LPVOID) address) != 0){
                     HeapUnlock(heap);
+                    InterlockedExchangeAdd64(&allocatedBlocks, -1);
+                    InterlockedExchangeAdd64(&allocatedBytes, 1LL - (LONG64) Size);
                     return;
                 }
                 HeapUnlock(heap);
             }
         }
 
+        glong Unsafe::allocatedMemorySize() {
+            return (glong) InterlockedCompareExchange64(&allocatedBytes, 0, 0);
+        }
+
+        glong Unsafe::allocatedMemoryBlocks(gint sizeClass) {
+            if (sizeClass != 0)
+                IllegalArgumentException("Invalid size class").throws(__trace("core.private.Unsafe"));
+            return (glong) InterlockedCompareExchange64(&allocatedBlocks, 0, 0);
+        }
+
+        gint Unsafe::memorySizeClassCount() {
+            // the blocks are allocated by the system heaps, without size classes
+            return 0;
+        }
+
+        glong Unsafe::memorySizeClassLimit(gint sizeClass) {
+            if (sizeClass != 0)
+                IllegalArgumentException("Invalid size class").throws(__trace("core.private.Unsafe"));
+            return Long::MAX_VALUE;
+        }
+
         void Unsafe::setMemoryImpl(glong address, glong sizeInBytes, gbyte value) {
             if (value == 0)
                 ZeroMemory ((HLOCAL) address, sizeInBytes);
@@ -227,5 +268,48 @@ namespace core {
             );
         }
 
+        namespace {
+
+            /**
+             * The routine and argument of thread started with Unsafe::startThread.
+             */
+            struct ThreadStart {
+                void (*routine)(glong);
+                glong argument;
+            };
+
+            DWORD WINAPI startRoutine(LPVOID start) {
+                ThreadStart const s = *(ThreadStart *) start;
+                delete (ThreadStart *) start;
+                s.routine(s.argument);
+                return 0;
+            }
+        }
+
+        gint Unsafe::availableProcessors() {
+            SYSTEM_INFO info = {};
+            GetSystemInfo(&info);
+            return info.dwNumberOfProcessors < 1 ? 1 : (gint) info.dwNumberOfProcessors;
+        }
+
+        glong Unsafe::startThread(void (*routine)(glong), glong argument) {
+            ThreadStart *start = new ThreadStart{routine, argument};
+            HANDLE thread = CreateThread(NULL, 0, &startRoutine, start, 0, NULL);
+            if (thread == NULL) {
+                delete start;
+                return 0;
+            }
+            return (glong) thread;
+        }
+
+        void Unsafe::joinThread(glong thread) {
+            WaitForSingleObject((HANDLE) thread, INFINITE);
+            CloseHandle((HANDLE) thread);
+        }
+
+        void Unsafe::yieldThread() {
+            SwitchToThread();
+        }
+
     }
 }